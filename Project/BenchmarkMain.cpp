@@ -0,0 +1,996 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: BenchmarkMain.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Entry point for the stress benchmarks. Each benchmark builds a worst-case load for one
+		system and reports how long its update takes per tick:
+
+			OpenConquerBenchmark <projectiles|steering|culling|audio|particles|ui|influence|orders|placement|terrain> [--count N] [--ticks N] [--threads N]
+				[--wav PATH]
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+#include "Source/AI/InfluenceMap.h"
+#include "Source/Audio/AudioMixer.h"
+#include "Source/Audio/WavFileAudioOutput.h"
+#include "Source/Camera/Camera.h"
+#include "Source/Combat/ProjectileSystem.h"
+#include "Source/Culling/LooseQuadtree.h"
+#include "Source/Orders/OrderSystem.h"
+#include "Source/Particles/ParticleSystem.h"
+#include "Source/Simulation/OccupancyMap.h"
+#include "Source/Simulation/Random.h"
+#include "Source/Simulation/SpatialGrid.h"
+#include "Source/Simulation/World.h"
+#include "Source/Steering/SteeringSystem.h"
+#include "Source/Terrain/TerrainStreamer.h"
+#include "Source/Threading/JobSystem.h"
+#include "Source/UI/UiLayer.h"
+
+// Description: Collects per-tick timings and prints a summary of them.
+class Timings
+{
+private:
+	std::vector<double> m_Milliseconds; // The time each tick took.
+
+public:
+	// Description: Records the time of one tick.
+	// Parameters: 
+	//    double _milliseconds, the time the tick took.
+	void Add(double _milliseconds)
+	{
+		m_Milliseconds.push_back(_milliseconds);
+	}
+
+	// Description: Prints the average, median, 99th percentile and worst tick.
+	// Parameters: 
+	//    const char* _name, what was timed.
+	void Print(const char* _name)
+	{
+		if (m_Milliseconds.empty())
+			return;
+
+		std::vector<double> sorted(m_Milliseconds);
+		std::sort(sorted.begin(), sorted.end());
+
+		double total = 0.0;
+		for (double milliseconds : sorted)
+			total += milliseconds;
+
+		printf("%s: avg=%.3f ms p50=%.3f ms p99=%.3f ms max=%.3f ms over %zu ticks\n",
+			_name,
+			total / sorted.size(),
+			sorted[sorted.size() / 2],
+			sorted[std::min(sorted.size() - 1, sorted.size() * 99 / 100)],
+			sorted.back(),
+			sorted.size()
+		);
+	}
+};
+
+// Description: Two armies face each other while a constant number of projectiles fly between them.
+// Parameters: 
+//    uint32_t _count, the number of projectiles kept in flight.
+//    uint32_t _ticks, the number of ticks to time.
+//    OC::JobSystem& _jobs, splits hit detection across threads.
+static void BenchmarkProjectiles(uint32_t _count, uint32_t _ticks, OC::JobSystem& _jobs)
+{
+	constexpr uint32_t UNITS_PER_ARMY = 5000;
+	constexpr float ARMY_GAP = 400.0f;
+	constexpr float SPEED = 300.0f;
+
+	OC::Random random(1);
+	OC::UnitData units;
+	OC::SpatialGrid grid;
+	OC::ProjectileSystem projectiles(_count);
+
+	// Units are unkillable so the load stays the same for every tick.
+	for (uint32_t i = 0; i < UNITS_PER_ARMY; ++i)
+	{
+		float x = static_cast<float>(i % 100) * 10.0f;
+		float y = static_cast<float>(i / 100) * 10.0f;
+
+		units.Add(0, x, y, 0.0f, 1e30f);
+		units.Add(1, x, y + ARMY_GAP + 500.0f, 0.0f, 1e30f);
+	}
+
+	grid.Build(units);
+
+	Timings timings;
+	uint64_t hits = 0;
+
+	for (uint32_t tick = 0; tick < _ticks; ++tick)
+	{
+		// Top up the projectiles lost to hits and expiry. Half fly each way.
+		while (projectiles.Count() < _count)
+		{
+			uint8_t team = static_cast<uint8_t>(random.Next() & 1);
+			float x = random.NextFloat(0.0f, 1000.0f);
+			float y = random.NextFloat(500.0f, 500.0f + ARMY_GAP);
+			float angle = random.NextFloat(-0.5f, 0.5f) + (team == 0 ? 1.5707963f : -1.5707963f);
+
+			projectiles.Spawn(team, x, y, cosf(angle) * SPEED, sinf(angle) * SPEED, 1.0f, 5.0f);
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		projectiles.Update(units, grid, OC::TICK_SECONDS, &_jobs);
+		timings.Add(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+
+		hits += projectiles.GetLastHitCount();
+	}
+
+	printf("Projectiles: %u in flight, %u units, %u threads, %.1f hits/tick\n",
+		_count,
+		units.Count(),
+		_jobs.GetWorkerCount() + 1,
+		static_cast<double>(hits) / _ticks
+	);
+	timings.Print("ProjectileSystem::Update");
+}
+
+// Description: Two crowds swap places through a single point, the worst case for local avoidance.
+// Parameters: 
+//    uint32_t _count, the number of units in each crowd.
+//    uint32_t _ticks, the number of ticks to time.
+//    OC::JobSystem& _jobs, steers chunks of units in parallel.
+static void BenchmarkSteering(uint32_t _count, uint32_t _ticks, OC::JobSystem& _jobs)
+{
+	constexpr float SPACING = 14.0f;
+	constexpr float CROWD_GAP = 600.0f;
+
+	OC::UnitData units;
+	OC::SpatialGrid grid;
+	OC::SteeringSystem steering;
+
+	// Each crowd is a square block aimed at the far side of the other one, through the middle.
+	const uint32_t side = static_cast<uint32_t>(ceilf(sqrtf(static_cast<float>(_count))));
+
+	for (uint32_t i = 0; i < _count; ++i)
+	{
+		float x = static_cast<float>(i % side) * SPACING;
+		float y = static_cast<float>(i / side) * SPACING;
+
+		OC::UnitId left = units.Add(0, x, y, 40.0f, 100.0f);
+		OC::UnitId right = units.Add(1, x + CROWD_GAP + side * SPACING, y, 40.0f, 100.0f);
+
+		units.goalX[left] = units.positionX[right];
+		units.goalY[left] = y;
+		units.goalX[right] = x;
+		units.goalY[right] = y;
+	}
+
+	Timings timings;
+
+	for (uint32_t tick = 0; tick < _ticks; ++tick)
+	{
+		auto start = std::chrono::steady_clock::now();
+		grid.Build(units);
+		steering.Update(units, grid, OC::TICK_SECONDS, &_jobs);
+		timings.Add(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	}
+
+	printf("Steering: %u units, %u threads\n", units.Count(), _jobs.GetWorkerCount() + 1);
+	timings.Print("SpatialGrid::Build + SteeringSystem::Update");
+}
+
+// Description: Units wander a large map while the camera pans and zooms across it. Each tick every unit
+//    is moved in the quadtree and the camera's view is queried, then the same view is found by testing
+//    every unit, to check the query and compare the cost.
+// Parameters: 
+//    uint32_t _count, the number of units.
+//    uint32_t _ticks, the number of ticks to time.
+static void BenchmarkCulling(uint32_t _count, uint32_t _ticks)
+{
+	constexpr float MAP_SIZE = 16384.0f;
+	constexpr float UNIT_SIZE = 6.0f;
+	constexpr float SPEED = 40.0f;
+
+	OC::Random random(1);
+	OC::LooseQuadtree quadtree({ 0.0f, 0.0f, MAP_SIZE, MAP_SIZE });
+	OC::Camera camera(1920, 1080);
+	std::vector<float> positionX(_count), positionY(_count), headingX(_count), headingY(_count);
+	std::vector<OC::CullHandle> handles(_count);
+
+	auto boundsOf = [&](uint32_t _unit)
+	{
+		return OC::Rect{
+			positionX[_unit] - UNIT_SIZE * 0.5f, positionY[_unit] - UNIT_SIZE * 0.5f,
+			positionX[_unit] + UNIT_SIZE * 0.5f, positionY[_unit] + UNIT_SIZE * 0.5f
+		};
+	};
+
+	for (uint32_t i = 0; i < _count; ++i)
+	{
+		float angle = random.NextFloat(0.0f, 6.2831853f);
+		positionX[i] = random.NextFloat(0.0f, MAP_SIZE);
+		positionY[i] = random.NextFloat(0.0f, MAP_SIZE);
+		headingX[i] = cosf(angle) * SPEED * OC::TICK_SECONDS;
+		headingY[i] = sinf(angle) * SPEED * OC::TICK_SECONDS;
+		handles[i] = quadtree.Insert(boundsOf(i), i);
+	}
+
+	std::vector<uint32_t> culled, scanned;
+	Timings updateTimings, queryTimings, scanTimings;
+	uint64_t visible = 0;
+	uint32_t mismatches = 0;
+
+	for (uint32_t tick = 0; tick < _ticks; ++tick)
+	{
+		// The camera circles the map, zooming between 1:1 and as far out as it goes.
+		camera.SetPosition(MAP_SIZE * (0.5f + 0.3f * cosf(tick * 0.01f)), MAP_SIZE * (0.5f + 0.3f * sinf(tick * 0.01f)));
+		camera.SetZoom(0.125f + 0.875f * (0.5f + 0.5f * sinf(tick * 0.023f)));
+		const OC::Rect view = camera.GetVisibleBounds();
+
+		auto start = std::chrono::steady_clock::now();
+		for (uint32_t i = 0; i < _count; ++i)
+		{
+			// Units turn back at the edges of the map.
+			if (positionX[i] + headingX[i] < 0.0f || positionX[i] + headingX[i] > MAP_SIZE)
+				headingX[i] = -headingX[i];
+			if (positionY[i] + headingY[i] < 0.0f || positionY[i] + headingY[i] > MAP_SIZE)
+				headingY[i] = -headingY[i];
+
+			positionX[i] += headingX[i];
+			positionY[i] += headingY[i];
+			quadtree.Update(handles[i], boundsOf(i));
+		}
+		auto updated = std::chrono::steady_clock::now();
+		quadtree.Query(view, culled);
+		auto queried = std::chrono::steady_clock::now();
+
+		scanned.clear();
+		for (uint32_t i = 0; i < _count; ++i)
+		{
+			if (boundsOf(i).Overlaps(view))
+				scanned.push_back(i);
+		}
+		auto scannedEnd = std::chrono::steady_clock::now();
+
+		updateTimings.Add(std::chrono::duration<double, std::milli>(updated - start).count());
+		queryTimings.Add(std::chrono::duration<double, std::milli>(queried - updated).count());
+		scanTimings.Add(std::chrono::duration<double, std::milli>(scannedEnd - queried).count());
+		visible += culled.size();
+
+		// The scan finds units in id order. The query must find exactly the same ones.
+		std::sort(culled.begin(), culled.end());
+		mismatches += culled != scanned ? 1 : 0;
+	}
+
+	printf("Culling: %u units, %.0f visible on average, %u ticks where the query and the scan disagreed\n",
+		_count,
+		static_cast<double>(visible) / _ticks,
+		mismatches
+	);
+	updateTimings.Print("Moving every unit + LooseQuadtree::Update");
+	queryTimings.Print("LooseQuadtree::Query");
+	scanTimings.Print("Scan of every unit");
+}
+
+// Description: A battle's worth of gunfire loops around a listener sweeping across the field, so the
+//    set of real voices keeps changing. A tick is one mixed block. The sweep can then be played again
+//    in real time on the mixer's thread and recorded to a file.
+// Parameters: 
+//    uint32_t _count, the number of voices playing.
+//    uint32_t _ticks, the number of blocks to time.
+//    const char* _wavPath, the WAV file to record to, or nullptr to skip recording.
+static void BenchmarkAudio(uint32_t _count, uint32_t _ticks, const char* _wavPath)
+{
+	constexpr float FIELD_SIZE = 4000.0f;
+	constexpr uint32_t SOUND_COUNT = 8;
+
+	OC::Random random(1);
+	OC::MixerSettings settings;
+	settings.maxVoices = std::max(settings.maxVoices, _count);
+	settings.commandCapacity = std::max(settings.commandCapacity, _count);
+
+	OC::AudioMixer mixer(settings);
+	OC::SoundId sounds[SOUND_COUNT];
+
+	// Noise bursts of different lengths stand in for gunfire.
+	for (OC::SoundId& sound : sounds)
+	{
+		std::vector<float> samples(settings.sampleRate / 4 + random.NextBelow(settings.sampleRate / 2));
+
+		for (size_t i = 0; i < samples.size(); ++i)
+			samples[i] = random.NextFloat(-1.0f, 1.0f) * (1.0f - static_cast<float>(i) / samples.size());
+
+		sound = mixer.AddSound(std::move(samples));
+	}
+
+	for (uint32_t i = 0; i < _count; ++i)
+	{
+		float x = random.NextFloat(0.0f, FIELD_SIZE);
+		float y = random.NextFloat(0.0f, FIELD_SIZE);
+		mixer.PlayAt(sounds[random.NextBelow(SOUND_COUNT)], x, y, random.NextFloat(0.2f, 1.0f), true);
+	}
+
+	std::vector<float> block(settings.blockFrames * 2);
+	Timings timings;
+	uint64_t realVoices = 0;
+
+	for (uint32_t tick = 0; tick < _ticks; ++tick)
+	{
+		float sweep = static_cast<float>(tick) / _ticks;
+		mixer.SetListener(sweep * FIELD_SIZE, FIELD_SIZE * 0.5f);
+
+		auto start = std::chrono::steady_clock::now();
+		mixer.MixBlock(block.data());
+		timings.Add(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+
+		realVoices += mixer.GetRealVoiceCount();
+	}
+
+	printf("Audio: %u voices, %.1f real on average, %.3f ms of audio per block\n",
+		_count,
+		static_cast<double>(realVoices) / _ticks,
+		1000.0 * settings.blockFrames / settings.sampleRate
+	);
+	timings.Print("AudioMixer::MixBlock");
+
+	if (!_wavPath)
+		return;
+
+	// The game thread moves the listener at a frame rate while the mixer's thread mixes on its own
+	// clock, so commands cross the queue the way they do in the game.
+	constexpr uint32_t RECORD_SECONDS = 5;
+	constexpr uint32_t UPDATES_PER_SECOND = 60;
+
+	OC::WavFileAudioOutput output(_wavPath, settings.sampleRate);
+
+	if (!output.IsOpen())
+	{
+		fprintf(stderr, "%s: could not be written\n", _wavPath);
+		return;
+	}
+
+	// Every gun at once would clip, so the recording is turned down.
+	const uint32_t updates = RECORD_SECONDS * UPDATES_PER_SECOND;
+	const auto start = std::chrono::steady_clock::now();
+	mixer.SetMasterGain(0.05f);
+	mixer.Start(output);
+
+	for (uint32_t update = 0; update < updates; ++update)
+	{
+		mixer.SetListener(static_cast<float>(update) / updates * FIELD_SIZE, FIELD_SIZE * 0.5f);
+		std::this_thread::sleep_until(start + std::chrono::microseconds(1000000ull * (update + 1) / UPDATES_PER_SECOND));
+	}
+
+	mixer.Stop();
+
+	printf("Recorded %.2f s of audio to %s on the mixer's thread, %u commands dropped\n",
+		static_cast<double>(output.GetFramesWritten()) / settings.sampleRate,
+		_wavPath,
+		mixer.GetDroppedCommandCount()
+	);
+}
+
+// Description: Explosions keep a full-screen battle topped up with particles while smoke drifts
+//    from burning wrecks. A tick is one rendered frame: an update plus the vertex stream.
+// Parameters: 
+//    uint32_t _count, the number of particles kept alive.
+//    uint32_t _ticks, the number of frames to time.
+//    OC::JobSystem& _jobs, updates chunks of particles in parallel.
+static void BenchmarkParticles(uint32_t _count, uint32_t _ticks, OC::JobSystem& _jobs)
+{
+	constexpr unsigned int SCREEN_WIDTH = 1920;
+	constexpr unsigned int SCREEN_HEIGHT = 1080;
+	constexpr float FRAME_SECONDS = 1.0f / 60.0f;
+	constexpr uint32_t BURST_SIZE = 2000;
+	constexpr uint32_t WRECK_COUNT = 200;
+
+	OC::Random random(1);
+	OC::ParticleSystem particles(_count);
+	OC::Camera camera(SCREEN_WIDTH, SCREEN_HEIGHT);
+	camera.SetPosition(SCREEN_WIDTH * 0.5f, SCREEN_HEIGHT * 0.5f);
+
+	OC::ParticleEffect explosion;
+	explosion.minLifetime = 0.5f;
+	explosion.maxLifetime = 1.5f;
+	explosion.minSpeed = 50.0f;
+	explosion.maxSpeed = 250.0f;
+	explosion.drag = 2.0f;
+	explosion.startSize = 3.0f;
+	explosion.endSize = 1.0f;
+	explosion.startColor = OC::PackColor(255, 220, 120, 255);
+	explosion.endColor = OC::PackColor(200, 40, 0, 0);
+
+	OC::ParticleEffect smoke;
+	smoke.minLifetime = 2.0f;
+	smoke.maxLifetime = 4.0f;
+	smoke.minSpeed = 5.0f;
+	smoke.maxSpeed = 20.0f;
+	smoke.spawnRadius = 8.0f;
+	smoke.drag = 0.5f;
+	smoke.lift = -15.0f;
+	smoke.startSize = 4.0f;
+	smoke.endSize = 16.0f;
+	smoke.startColor = OC::PackColor(60, 60, 60, 200);
+	smoke.endColor = OC::PackColor(120, 120, 120, 0);
+
+	OC::EffectId explosionEffect = particles.AddEffect(explosion);
+	OC::EffectId smokeEffect = particles.AddEffect(smoke);
+
+	for (uint32_t i = 0; i < WRECK_COUNT; ++i)
+		particles.StartEmitter(smokeEffect, random.NextFloat(0.0f, SCREEN_WIDTH), random.NextFloat(0.0f, SCREEN_HEIGHT), 500.0f);
+
+	std::vector<OC::ParticleVertex> vertices;
+	Timings updateTimings, vertexTimings;
+	uint64_t visible = 0;
+
+	for (uint32_t tick = 0; tick < _ticks; ++tick)
+	{
+		while (particles.Count() + BURST_SIZE <= _count)
+			particles.Burst(explosionEffect, random.NextFloat(0.0f, SCREEN_WIDTH), random.NextFloat(0.0f, SCREEN_HEIGHT), BURST_SIZE);
+
+		auto start = std::chrono::steady_clock::now();
+		particles.Update(FRAME_SECONDS, &_jobs);
+		auto updated = std::chrono::steady_clock::now();
+		particles.BuildVertices(camera, vertices, &_jobs);
+		auto built = std::chrono::steady_clock::now();
+
+		updateTimings.Add(std::chrono::duration<double, std::milli>(updated - start).count());
+		vertexTimings.Add(std::chrono::duration<double, std::milli>(built - updated).count());
+		visible += vertices.size();
+	}
+
+	printf("Particles: %u alive, %.0f visible on average, %u threads\n",
+		particles.Count(),
+		static_cast<double>(visible) / _ticks,
+		_jobs.GetWorkerCount() + 1
+	);
+	updateTimings.Print("ParticleSystem::Update");
+	vertexTimings.Print("ParticleSystem::BuildVertices");
+}
+
+// Description: Builds a HUD with changing counters, unit cards and a tooltip that follows the cursor,
+//    and times building its quads each frame.
+// Parameters: 
+//    uint32_t _count, the number of unit cards.
+//    uint32_t _ticks, the number of frames to run.
+static void BenchmarkUi(uint32_t _count, uint32_t _ticks)
+{
+	constexpr uint32_t RESOURCE_COUNT = 4;
+	constexpr uint32_t CARD_COLUMNS = 20;
+	constexpr float CARD_WIDTH = 90.0f;
+	constexpr float CARD_HEIGHT = 40.0f;
+	static const char* const RESOURCE_NAMES[RESOURCE_COUNT] = { "Gold", "Wood", "Stone", "Food" };
+	static const char* const TOOLTIPS[] =
+	{
+		"Barracks: trains infantry. Requires a town hall. Costs 150 gold and 100 wood.",
+		"Siege workshop: builds catapults and rams. Slow to build, but breaks walls quickly.",
+		"Watchtower: sees far and shoots at enemies in range. Upgrade to stone for more health."
+	};
+
+	OC::Random random(1);
+	OC::UiLayer ui;
+	char text[64];
+
+	// The resource bar along the top, updated every frame.
+	OC::WidgetId resources[RESOURCE_COUNT];
+	ui.AddPanel(0.0f, 0.0f, 1920.0f, 28.0f, OC::PackColor(20, 20, 30, 220));
+	for (uint32_t i = 0; i < RESOURCE_COUNT; ++i)
+		resources[i] = ui.AddLabel(10.0f + i * 200.0f, 6.0f, "", 16, OC::PackColor(255, 220, 120, 255));
+
+	// Unit cards along the bottom. A few units take damage each frame.
+	std::vector<OC::WidgetId> health(_count);
+	std::vector<uint32_t> hitPoints(_count, 100);
+	for (uint32_t i = 0; i < _count; ++i)
+	{
+		float x = (i % CARD_COLUMNS) * (CARD_WIDTH + 4.0f);
+		float y = 800.0f + (i / CARD_COLUMNS) * (CARD_HEIGHT + 4.0f);
+		ui.AddPanel(x, y, CARD_WIDTH, CARD_HEIGHT, OC::PackColor(30, 40, 30, 200));
+		snprintf(text, sizeof(text), "Soldier %u", i);
+		ui.AddLabel(x + 4.0f, y + 4.0f, text, 10, OC::PackColor(255, 255, 255, 255));
+		health[i] = ui.AddLabel(x + 4.0f, y + 20.0f, "HP 100", 12, OC::PackColor(120, 255, 120, 255));
+	}
+
+	// A tooltip that follows the cursor and changes every second.
+	OC::WidgetId tooltipPanel = ui.AddPanel(0.0f, 0.0f, 0.0f, 0.0f, OC::PackColor(0, 0, 0, 200));
+	OC::WidgetId tooltip = ui.AddLabel(0.0f, 0.0f, "", 14, OC::PackColor(255, 255, 255, 255), 300.0f);
+
+	std::vector<OC::UiQuad> quads;
+	Timings timings;
+
+	for (uint32_t tick = 0; tick < _ticks; ++tick)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		for (uint32_t i = 0; i < RESOURCE_COUNT; ++i)
+		{
+			snprintf(text, sizeof(text), "%s: %u", RESOURCE_NAMES[i], tick * (i + 1) * 3);
+			ui.SetText(resources[i], text);
+		}
+
+		for (uint32_t hit = 0; hit < _count / 10; ++hit)
+		{
+			uint32_t unit = random.NextBelow(_count);
+			hitPoints[unit] = hitPoints[unit] > 0 ? hitPoints[unit] - 1 : 100;
+			snprintf(text, sizeof(text), "HP %u", hitPoints[unit]);
+			ui.SetText(health[unit], text);
+		}
+
+		float cursorX = 960.0f + 400.0f * sinf(tick * 0.05f);
+		float cursorY = 400.0f + 200.0f * cosf(tick * 0.05f);
+		ui.SetText(tooltip, TOOLTIPS[(tick / 60) % 3]);
+		ui.SetPosition(tooltip, cursorX + 20.0f, cursorY + 20.0f);
+
+		float width, height;
+		ui.GetSize(tooltip, width, height);
+		ui.SetPosition(tooltipPanel, cursorX + 14.0f, cursorY + 14.0f);
+		ui.SetSize(tooltipPanel, width + 12.0f, height + 12.0f);
+
+		ui.Build(quads);
+		ui.TakeAtlasImage();
+
+		timings.Add(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	}
+
+	const OC::GlyphAtlas& atlas = ui.GetAtlas();
+	printf("UI: %u unit cards, %zu quads, %.1f widgets rebuilt per frame, atlas hits=%llu misses=%llu evictions=%llu\n",
+		_count,
+		quads.size(),
+		static_cast<double>(ui.GetRebuildCount()) / _ticks,
+		static_cast<unsigned long long>(atlas.GetHitCount()),
+		static_cast<unsigned long long>(atlas.GetMissCount()),
+		static_cast<unsigned long long>(atlas.GetEvictionCount())
+	);
+	timings.Print("UiLayer::Build");
+}
+
+// Description: Two armies of squads hold their halves of the map. Each tick a few squads advance and
+//    take damage, so only the tiles around them need updating. The same load is then timed again with
+//    a full rebuild every tick.
+// Parameters: 
+//    uint32_t _count, the number of units in each army.
+//    uint32_t _ticks, the number of ticks to time.
+//    OC::JobSystem& _jobs, stamps and spreads in parallel.
+static void BenchmarkInfluence(uint32_t _count, uint32_t _ticks, OC::JobSystem& _jobs)
+{
+	constexpr uint32_t SQUAD_SIZE = 50;
+	constexpr float SQUAD_RADIUS = 80.0f;
+	constexpr uint32_t SQUADS_PER_TICK = 4; // Squads that change each tick, across both armies.
+
+	OC::Random random(1);
+	OC::UnitData units;
+	OC::InfluenceMap influence;
+	const OC::InfluenceSettings& settings = influence.GetSettings();
+	const float mapWidth = settings.width * settings.cellSize;
+	const float mapHeight = settings.height * settings.cellSize;
+
+	// Squads are added whole, so a squad is a run of ids. Each army fills its half of the map.
+	for (uint32_t i = 0; i < 2 * _count; i += SQUAD_SIZE)
+	{
+		uint8_t team = static_cast<uint8_t>((i / SQUAD_SIZE) & 1);
+		float x = settings.originX + random.NextFloat(SQUAD_RADIUS, mapWidth * 0.5f - SQUAD_RADIUS) + team * mapWidth * 0.5f;
+		float y = settings.originY + random.NextFloat(SQUAD_RADIUS, mapHeight - SQUAD_RADIUS);
+
+		for (uint32_t j = 0; j < SQUAD_SIZE && i + j < 2 * _count; ++j)
+			units.Add(team, x + random.NextFloat(-SQUAD_RADIUS, SQUAD_RADIUS), y + random.NextFloat(-SQUAD_RADIUS, SQUAD_RADIUS), 40.0f, 100.0f);
+	}
+
+	const uint32_t squadCount = (units.Count() + SQUAD_SIZE - 1) / SQUAD_SIZE;
+	Timings incremental, full;
+	uint64_t tiles = 0;
+
+	influence.Update(units, &_jobs);
+
+	for (uint32_t pass = 0; pass < 2; ++pass)
+	{
+		for (uint32_t tick = 0; tick < _ticks; ++tick)
+		{
+			for (uint32_t i = 0; i < SQUADS_PER_TICK; ++i)
+			{
+				uint32_t squad = random.NextBelow(squadCount);
+
+				for (OC::UnitId unit = squad * SQUAD_SIZE; unit < std::min((squad + 1) * SQUAD_SIZE, units.Count()); ++unit)
+				{
+					units.positionX[unit] += units.team[unit] == 0 ? 8.0f : -8.0f;
+					units.health[unit] = std::max(units.health[unit] - 1.0f, 1.0f);
+				}
+			}
+
+			if (pass == 1)
+				influence.Invalidate();
+
+			auto start = std::chrono::steady_clock::now();
+			influence.Update(units, &_jobs);
+			(pass == 0 ? incremental : full).Add(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+
+			if (pass == 0)
+				tiles += influence.GetLastTileCount();
+		}
+	}
+
+	printf("Influence: %u units, %ux%u cells, %u teams, %u threads, %.1f of %u tiles spread/tick\n",
+		units.Count(),
+		settings.width, settings.height,
+		settings.teamCount,
+		_jobs.GetWorkerCount() + 1,
+		static_cast<double>(tiles) / _ticks,
+		settings.teamCount * (settings.width / OC::InfluenceMap::TILE_SIZE) * (settings.height / OC::InfluenceMap::TILE_SIZE)
+	);
+	incremental.Print("InfluenceMap::Update (incremental)");
+	full.Print("InfluenceMap::Update (full rebuild)");
+}
+
+// Description: Finds the least total cost of giving every row a column of its own, with the Hungarian
+//    algorithm. O(n^3), so only for small problems.
+// Parameters: 
+//    const std::vector<double>& _cost, the cost of giving each row each column, row by row.
+//    uint32_t _size, the number of rows and columns.
+// Returns: The least total cost.
+static double MinimumAssignmentCost(const std::vector<double>& _cost, uint32_t _size)
+{
+	// Rows and columns count from 1, so column 0 can stand for the row being added.
+	std::vector<double> rowPotential(_size + 1, 0.0), columnPotential(_size + 1, 0.0), slack(_size + 1);
+	std::vector<uint32_t> columnRow(_size + 1, 0), way(_size + 1, 0);
+	std::vector<uint8_t> used(_size + 1);
+
+	for (uint32_t row = 1; row <= _size; ++row)
+	{
+		columnRow[0] = row;
+		uint32_t column = 0;
+		std::fill(slack.begin(), slack.end(), INFINITY);
+		std::fill(used.begin(), used.end(), 0);
+
+		// Grow a tree of tight edges from the new row until it reaches a free column.
+		do
+		{
+			used[column] = 1;
+			const uint32_t current = columnRow[column];
+			double delta = INFINITY;
+			uint32_t next = 0;
+
+			for (uint32_t j = 1; j <= _size; ++j)
+			{
+				if (used[j])
+					continue;
+
+				const double reduced = _cost[static_cast<size_t>(current - 1) * _size + (j - 1)] - rowPotential[current] - columnPotential[j];
+				if (reduced < slack[j])
+				{
+					slack[j] = reduced;
+					way[j] = column;
+				}
+
+				if (slack[j] < delta)
+				{
+					delta = slack[j];
+					next = j;
+				}
+			}
+
+			for (uint32_t j = 0; j <= _size; ++j)
+			{
+				if (used[j])
+				{
+					rowPotential[columnRow[j]] += delta;
+					columnPotential[j] -= delta;
+				}
+				else
+					slack[j] -= delta;
+			}
+
+			column = next;
+		} while (columnRow[column] != 0);
+
+		// Shift the matches along the path back to the new row.
+		do
+		{
+			const uint32_t previous = way[column];
+			columnRow[column] = columnRow[previous];
+			column = previous;
+		} while (column != 0);
+	}
+
+	double total = 0.0;
+	for (uint32_t j = 1; j <= _size; ++j)
+		total += _cost[static_cast<size_t>(columnRow[j] - 1) * _size + (j - 1)];
+
+	return total;
+}
+
+// Description: Selects a scattered army and orders it back and forth across the map, timing the
+//    formation layout and slot assignment of each order. Small armies also compare the walk to their
+//    slots with the best possible assignment of units to the same slots.
+// Parameters: 
+//    uint32_t _count, the number of units selected.
+//    uint32_t _ticks, the number of orders to time.
+static void BenchmarkOrders(uint32_t _count, uint32_t _ticks)
+{
+	constexpr float MAP_SIZE = 8000.0f;
+	constexpr float ARMY_RADIUS = 600.0f;
+	constexpr uint32_t EXACT_LIMIT = 512; // The largest army compared with the exact assignment.
+	constexpr uint32_t EXACT_ORDERS = 10; // The orders compared with it.
+
+	OC::Random random(1);
+	OC::UnitData units;
+	OC::OrderSystem orders(0);
+	std::vector<OC::Command> commands;
+
+	units.Reserve(_count);
+	for (uint32_t i = 0; i < _count; ++i)
+		units.Add(0, MAP_SIZE * 0.5f + random.NextFloat(-ARMY_RADIUS, ARMY_RADIUS), MAP_SIZE * 0.5f + random.NextFloat(-ARMY_RADIUS, ARMY_RADIUS), 40.0f, 100.0f);
+
+	orders.Select(units, OC::Rect{ 0.0f, 0.0f, MAP_SIZE, MAP_SIZE });
+
+	Timings timings;
+	double walk = 0.0, optimal = 0.0;
+	uint32_t compared = 0;
+	std::vector<double> cost;
+
+	for (uint32_t tick = 0; tick < _ticks; ++tick)
+	{
+		float targetX = random.NextFloat(0.0f, MAP_SIZE), targetY = random.NextFloat(0.0f, MAP_SIZE);
+		commands.clear();
+
+		auto start = std::chrono::steady_clock::now();
+		orders.Move(units, targetX, targetY, tick, commands);
+		timings.Add(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+
+		// How far units walk to their slots, against the least total walk to the same slots.
+		const uint32_t size = static_cast<uint32_t>(commands.size());
+
+		if (compared < EXACT_ORDERS && size <= EXACT_LIMIT)
+		{
+			cost.resize(static_cast<size_t>(size) * size);
+
+			for (uint32_t i = 0; i < size; ++i)
+			{
+				const OC::UnitId unit = commands[i].unit;
+				walk += hypot(commands[i].x - units.positionX[unit], commands[i].y - units.positionY[unit]);
+
+				for (uint32_t j = 0; j < size; ++j)
+					cost[static_cast<size_t>(i) * size + j] = hypot(commands[j].x - units.positionX[unit], commands[j].y - units.positionY[unit]);
+			}
+
+			optimal += MinimumAssignmentCost(cost, size);
+			++compared;
+		}
+
+		// The army then arrives, so the next order starts from a formation.
+		for (const OC::Command& command : commands)
+		{
+			units.positionX[command.unit] = command.x;
+			units.positionY[command.unit] = command.y;
+		}
+	}
+
+	if (compared)
+		printf("Orders: %u units, walk %.4fx the optimal assignment over the first %u orders\n", _count, optimal > 0.0 ? walk / optimal : 1.0, compared);
+	else
+		printf("Orders: %u units, too many to compare with the optimal assignment (at most %u)\n", _count, EXACT_LIMIT);
+	timings.Print("OrderSystem::Move");
+}
+
+// Description: Fills a map with terrain, buildings and wandering units, then each tick moves the units,
+//    places and destroys a building, checks footprints the way a placement preview and AI base planners
+//    do, and searches around a few bases for every place a building fits.
+// Parameters: 
+//    uint32_t _count, the number of units.
+//    uint32_t _ticks, the number of ticks to time.
+static void BenchmarkPlacement(uint32_t _count, uint32_t _ticks)
+{
+	constexpr uint32_t CHECKS_PER_TICK = 5000;
+	constexpr uint32_t BASES = 8;
+	constexpr int32_t BASE_RADIUS = 24; // In tiles.
+	constexpr uint32_t BUILDING_SIZE = 3;
+
+	OC::Random random(1);
+	OC::OccupancyMap occupancy;
+	const OC::OccupancySettings& settings = occupancy.GetSettings();
+	const float mapWidth = settings.width * settings.tileSize, mapHeight = settings.height * settings.tileSize;
+	std::vector<int32_t> buildings;
+	std::vector<uint32_t> fits;
+
+	for (uint32_t i = 0; i < settings.width * settings.height / 256; ++i)
+		occupancy.Fill(OC::OccupancyLayer::TERRAIN, random.NextBelow(settings.width), random.NextBelow(settings.height), 1 + random.NextBelow(8), 1 + random.NextBelow(8), true);
+
+	for (uint32_t i = 0; i < settings.width * settings.height / 128; ++i)
+		occupancy.Fill(OC::OccupancyLayer::RESOURCES, random.NextBelow(settings.width), random.NextBelow(settings.height), 1, 1, true);
+
+	OC::UnitData units;
+	units.Reserve(_count);
+	for (uint32_t i = 0; i < _count; ++i)
+		units.Add(static_cast<uint8_t>(i & 1), settings.originX + random.NextFloat(0.0f, mapWidth), settings.originY + random.NextFloat(0.0f, mapHeight), 40.0f, 100.0f);
+
+	occupancy.UpdateUnits(units);
+
+	Timings unitTimings, checkTimings, searchTimings;
+	uint64_t moved = 0, passed = 0, found = 0;
+
+	for (uint32_t tick = 0; tick < _ticks; ++tick)
+	{
+		// A third of the units move a little, as they would in one tick.
+		for (OC::UnitId unit = tick % 3; unit < units.Count(); unit += 3)
+		{
+			units.positionX[unit] += random.NextFloat(-4.0f, 4.0f);
+			units.positionY[unit] += random.NextFloat(-4.0f, 4.0f);
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		moved += occupancy.UpdateUnits(units);
+		auto updated = std::chrono::steady_clock::now();
+
+		// Place a building where it fits and, once there are plenty, destroy the oldest.
+		int32_t x = static_cast<int32_t>(random.NextBelow(settings.width)), y = static_cast<int32_t>(random.NextBelow(settings.height));
+		if (occupancy.CanPlace(x, y, BUILDING_SIZE, BUILDING_SIZE))
+		{
+			occupancy.Fill(OC::OccupancyLayer::BUILDINGS, x, y, BUILDING_SIZE, BUILDING_SIZE, true);
+			buildings.push_back(x);
+			buildings.push_back(y);
+		}
+
+		if (buildings.size() > 2 * 500)
+		{
+			occupancy.Fill(OC::OccupancyLayer::BUILDINGS, buildings[0], buildings[1], BUILDING_SIZE, BUILDING_SIZE, false);
+			buildings.erase(buildings.begin(), buildings.begin() + 2);
+		}
+
+		auto checkStart = std::chrono::steady_clock::now();
+		for (uint32_t i = 0; i < CHECKS_PER_TICK; ++i)
+		{
+			uint32_t size = 2 + (i & 3);
+			passed += occupancy.CanPlace(static_cast<int32_t>(random.NextBelow(settings.width)), static_cast<int32_t>(random.NextBelow(settings.height)), size, size) ? 1 : 0;
+		}
+		auto checked = std::chrono::steady_clock::now();
+
+		for (uint32_t base = 0; base < BASES; ++base)
+		{
+			int32_t baseX = static_cast<int32_t>(settings.width * (base + 1) / (BASES + 1)), baseY = static_cast<int32_t>(settings.height / 2);
+			found += occupancy.FindPlacements(baseX - BASE_RADIUS, baseY - BASE_RADIUS, baseX + BASE_RADIUS, baseY + BASE_RADIUS, 4, 4, OC::ALL_LAYERS, fits);
+		}
+		auto searched = std::chrono::steady_clock::now();
+
+		unitTimings.Add(std::chrono::duration<double, std::milli>(updated - start).count());
+		checkTimings.Add(std::chrono::duration<double, std::milli>(checked - checkStart).count());
+		searchTimings.Add(std::chrono::duration<double, std::milli>(searched - checked).count());
+	}
+
+	printf("Placement: %u units, %ux%u tiles, %.0f units changed tiles/tick, %.1f%% of checks fit, %.0f fits/tick in %u bases\n",
+		_count,
+		settings.width, settings.height,
+		static_cast<double>(moved) / _ticks,
+		100.0 * passed / (static_cast<double>(_ticks) * CHECKS_PER_TICK),
+		static_cast<double>(found) / _ticks,
+		BASES
+	);
+	unitTimings.Print("OccupancyMap::UpdateUnits");
+	checkTimings.Print("OccupancyMap::CanPlace (5000 footprints)");
+	searchTimings.Print("OccupancyMap::FindPlacements (8 bases)");
+}
+
+// Description: The camera flies across the open world one chunk per tick, twice. The first flight
+//    generates every chunk, the second reads them back from the cache the first wrote.
+// Parameters: 
+//    uint32_t _count, the number of chunks kept ready around the camera. Rounded down to a square.
+//    uint32_t _ticks, the number of ticks to time per flight.
+//    OC::JobSystem& _jobs, generates chunks across threads.
+static void BenchmarkTerrain(uint32_t _count, uint32_t _ticks, OC::JobSystem& _jobs)
+{
+	namespace fs = std::filesystem;
+
+	std::error_code error;
+	const fs::path cachePath = fs::temp_directory_path(error) / "OpenConquerTerrainBenchmark";
+	fs::remove_all(cachePath, error);
+
+	OC::TerrainSettings terrain;
+	OC::StreamerSettings settings;
+	settings.cachePath = cachePath.string();
+	settings.loadRadius = static_cast<uint32_t>((sqrtf(static_cast<float>(_count)) - 1.0f) / 2.0f);
+	settings.keepRadius = settings.loadRadius;
+
+	const uint32_t side = 2 * settings.loadRadius + 1;
+	const float chunkWidth = settings.tileSize * OC::CHUNK_SIZE;
+	const char* names[2] = { "TerrainStreamer (generated)", "TerrainStreamer (cached)" };
+
+	for (uint32_t flight = 0; flight < 2; ++flight)
+	{
+		OC::TerrainStreamer streamer(terrain, settings, &_jobs);
+		Timings timings;
+		auto flightStart = std::chrono::steady_clock::now();
+
+		// Each tick waits for the new column of chunks, so it times making them rather than queueing them.
+		for (uint32_t tick = 0; tick < _ticks; ++tick)
+		{
+			auto start = std::chrono::steady_clock::now();
+			streamer.Update(tick * chunkWidth, 0.0f);
+			streamer.Wait();
+			streamer.Update(tick * chunkWidth, 0.0f);
+			timings.Add(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+		}
+
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - flightStart).count();
+		uint32_t generated, cacheHits, cacheFailures;
+		streamer.GetCounts(generated, cacheHits, cacheFailures);
+
+		printf("Terrain: %ux%u chunks around the camera, %u generated, %u from the cache, %u not cached, %.1f chunks/s on %u threads\n",
+			side, side,
+			generated,
+			cacheHits,
+			cacheFailures,
+			(generated + cacheHits) / seconds,
+			_jobs.GetWorkerCount() + 1
+		);
+		timings.Print(names[flight]);
+	}
+
+	fs::remove_all(cachePath, error);
+}
+
+// Description: Prints how to use the benchmark.
+static void PrintUsage()
+{
+	printf("Usage: OpenConquerBenchmark <projectiles|steering|culling|audio|particles|ui|influence|orders|placement|terrain> [--count N] [--ticks N] [--threads N]\n"
+		"                            [--wav PATH]\n");
+}
+
+int main(int _argc, char** _argv)
+{
+	const char* benchmark = nullptr;
+	uint32_t count = 0;
+	uint32_t ticks = 0;
+	unsigned int workerCount = 0;
+	const char* wavPath = nullptr;
+
+	for (int i = 1; i < _argc; ++i)
+	{
+		if (strcmp(_argv[i], "--count") == 0 && i + 1 < _argc)
+			count = static_cast<uint32_t>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--ticks") == 0 && i + 1 < _argc)
+			ticks = static_cast<uint32_t>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--threads") == 0 && i + 1 < _argc)
+			workerCount = static_cast<unsigned int>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--wav") == 0 && i + 1 < _argc)
+			wavPath = _argv[++i];
+		else if (!benchmark && _argv[i][0] != '-')
+			benchmark = _argv[i];
+		else
+		{
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	// --threads counts the calling thread, the job system doesn't.
+	OC::JobSystem jobs(workerCount > 0 ? workerCount - 1 : 0);
+
+	if (benchmark && strcmp(benchmark, "projectiles") == 0)
+		BenchmarkProjectiles(count ? count : 50000, ticks ? ticks : 200, jobs);
+	else if (benchmark && strcmp(benchmark, "steering") == 0)
+		BenchmarkSteering(count ? count : 2000, ticks ? ticks : 600, jobs);
+	else if (benchmark && strcmp(benchmark, "culling") == 0)
+		BenchmarkCulling(count ? count : 100000, ticks ? ticks : 600);
+	else if (benchmark && strcmp(benchmark, "audio") == 0)
+		BenchmarkAudio(count ? count : 1000, ticks ? ticks : 2000, wavPath);
+	else if (benchmark && strcmp(benchmark, "particles") == 0)
+		BenchmarkParticles(count ? count : 1000000, ticks ? ticks : 300, jobs);
+	else if (benchmark && strcmp(benchmark, "ui") == 0)
+		BenchmarkUi(count ? count : 100, ticks ? ticks : 1000);
+	else if (benchmark && strcmp(benchmark, "influence") == 0)
+		BenchmarkInfluence(count ? count : 5000, ticks ? ticks : 300, jobs);
+	else if (benchmark && strcmp(benchmark, "orders") == 0)
+		BenchmarkOrders(count ? count : 500, ticks ? ticks : 1000);
+	else if (benchmark && strcmp(benchmark, "placement") == 0)
+		BenchmarkPlacement(count ? count : 5000, ticks ? ticks : 1000);
+	else if (benchmark && strcmp(benchmark, "terrain") == 0)
+		BenchmarkTerrain(count ? count : 81, ticks ? ticks : 100, jobs);
+	else
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,91 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: CookerMain.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Entry point for the asset cooker. Turns a folder of source images into the textures
+		the game loads, on every core, skipping assets that haven't changed since they were last cooked:
+
+			OpenConquerCooker [--threads N] [--force] [--uncompressed] [--padding N] [--max-atlas N]
+				<source folder> <output folder>
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Source/Content/AssetCooker.h"
+#include "Source/Threading/JobSystem.h"
+
+// Description: Prints how to use the cooker.
+static void PrintUsage()
+{
+	printf("Usage: OpenConquerCooker [--threads N] [--force] [--uncompressed] [--padding N] [--max-atlas N]\n"
+		"                         <source folder> <output folder>\n");
+}
+
+int main(int _argc, char** _argv)
+{
+	OC::CookerSettings settings;
+	unsigned int workerCount = 0;
+	const char* paths[2] = { nullptr, nullptr };
+
+	for (int i = 1; i < _argc; ++i)
+	{
+		if (strcmp(_argv[i], "--threads") == 0 && i + 1 < _argc)
+			workerCount = static_cast<unsigned int>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--force") == 0)
+			settings.force = true;
+		else if (strcmp(_argv[i], "--uncompressed") == 0)
+			settings.compress = false;
+		else if (strcmp(_argv[i], "--padding") == 0 && i + 1 < _argc)
+			settings.atlasPadding = static_cast<uint32_t>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--max-atlas") == 0 && i + 1 < _argc)
+			settings.atlasMaxSize = static_cast<uint32_t>(strtoul(_argv[++i], nullptr, 10));
+		else if (_argv[i][0] != '-' && !paths[1])
+			paths[paths[0] ? 1 : 0] = _argv[i];
+		else
+		{
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	if (!paths[1] || settings.atlasMaxSize == 0 || settings.atlasMaxSize > 32768)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	settings.sourcePath = paths[0];
+	settings.outputPath = paths[1];
+
+	// --threads counts the calling thread, the job system doesn't.
+	OC::JobSystem jobs(workerCount > 0 ? workerCount - 1 : 0);
+	OC::CookerReport report;
+	std::string error;
+
+	auto start = std::chrono::steady_clock::now();
+
+	if (!OC::AssetCooker::Cook(settings, report, error, &jobs))
+	{
+		fprintf(stderr, "%s\n", error.c_str());
+		return 1;
+	}
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	for (const OC::CookedAsset& asset : report.assets)
+	{
+		if (asset.result == OC::CookResult::COOKED)
+			printf("Cooked %s (%.1f ms)\n", asset.outputPath.c_str(), asset.milliseconds);
+		else if (asset.result == OC::CookResult::FAILED)
+			fprintf(stderr, "%s\n", asset.error.c_str());
+	}
+
+	printf("%u cooked, %u up to date, %u failed in %.2f s on %u threads\n", report.cooked, report.skipped, report.failed,
+		seconds, jobs.GetWorkerCount() + 1);
+	return report.failed > 0 ? 1 : 0;
+}
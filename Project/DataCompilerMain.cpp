@@ -0,0 +1,49 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: DataCompilerMain.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Entry point for the definition compiler. Turns the text definitions of every weapon,
+		unit and building into the binary file the game and server map at startup:
+
+			OpenConquerDataCompiler <input.txt> <output.ocdb>
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <stdio.h>
+#include <string>
+#include "Source/Data/DefinitionCompiler.h"
+#include "Source/Data/DefinitionDatabase.h"
+
+int main(int _argc, char** _argv)
+{
+	if (_argc != 3)
+	{
+		printf("Usage: OpenConquerDataCompiler <input.txt> <output.ocdb>\n");
+		return 1;
+	}
+
+	std::string error;
+
+	if (!OC::DefinitionCompiler::CompileFile(_argv[1], _argv[2], error))
+	{
+		fprintf(stderr, "%s\n", error.c_str());
+		return 1;
+	}
+
+	// Load what was written, so a file that compiles but can't be loaded never gets past the build.
+	OC::DefinitionDatabase definitions;
+
+	if (!definitions.Open(_argv[2]))
+	{
+		fprintf(stderr, "%s: was written but doesn't load\n", _argv[2]);
+		return 1;
+	}
+
+	printf("%s: %u weapons, %u units, %u buildings\n", _argv[2],
+		definitions.GetCount(OC::DefinitionKind::WEAPON),
+		definitions.GetCount(OC::DefinitionKind::UNIT),
+		definitions.GetCount(OC::DefinitionKind::BUILDING));
+	return 0;
+}
@@ -0,0 +1,249 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: RenderMain.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Entry point for the replay renderer. Runs a match from a command script headless,
+		draws every tick with the software renderer and captures the frames, as PNG files or one raw
+		stream for a video encoder. Nothing waits on a display, so replays render as fast as the
+		simulation, drawing and encoders allow:
+
+			OpenConquerRender [--out FOLDER] [--format png|raw] [--size WIDTHxHEIGHT] [--scale S]
+				[--every N] [--encoders N] [--seed N] [--ticks N] [--threads N] [--defs PATH] script|-
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <chrono>
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "Source/Camera/Camera.h"
+#include "Source/Data/DefinitionDatabase.h"
+#include "Source/Renderer/SoftwareRenderer.h"
+#include "Source/Simulation/CommandScript.h"
+#include "Source/Simulation/World.h"
+#include "Source/Threading/JobSystem.h"
+#include "Source/UI/UiLayer.h"
+
+// Description: Prints how to use the replay renderer.
+static void PrintUsage()
+{
+	printf("Usage: OpenConquerRender [--out FOLDER] [--format png|raw] [--size WIDTHxHEIGHT] [--scale S]\n"
+		"                         [--every N] [--encoders N] [--seed N] [--ticks N] [--threads N] [--defs PATH] script|-\n");
+}
+
+// Description: Points the camera at every living unit, with a margin around them.
+// Parameters: 
+//    const OC::UnitData& _units, the units.
+//    uint32_t _width, the width of the frame, in pixels.
+//    uint32_t _height, the height of the frame, in pixels.
+//    OC::Camera& _camera, the camera.
+static void FrameUnits(const OC::UnitData& _units, uint32_t _width, uint32_t _height, OC::Camera& _camera)
+{
+	OC::Rect bounds = { FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+	for (OC::UnitId unit = 0; unit < _units.Count(); ++unit)
+	{
+		if (!_units.IsAlive(unit))
+			continue;
+
+		bounds.minX = fminf(bounds.minX, _units.positionX[unit]);
+		bounds.minY = fminf(bounds.minY, _units.positionY[unit]);
+		bounds.maxX = fmaxf(bounds.maxX, _units.positionX[unit]);
+		bounds.maxY = fmaxf(bounds.maxY, _units.positionY[unit]);
+	}
+
+	if (bounds.minX > bounds.maxX)
+		return;
+
+	const float margin = 1.2f;
+	const float width = fmaxf(bounds.maxX - bounds.minX, 100.0f) * margin, height = fmaxf(bounds.maxY - bounds.minY, 100.0f) * margin;
+	const float zoom = fminf(_width / width, _height / height);
+
+	_camera.SetZoomLimits(fminf(zoom, 0.125f), fmaxf(zoom, 4.0f));
+	_camera.SetZoom(zoom);
+	_camera.SetPosition((bounds.minX + bounds.maxX) * 0.5f, (bounds.minY + bounds.maxY) * 0.5f);
+}
+
+int main(int _argc, char** _argv)
+{
+	OC::CaptureSettings captureSettings;
+	captureSettings.folder = "Replay";
+	uint32_t width = 1280, height = 720;
+	float scale = 1.0f;
+	uint64_t seed = 1;
+	uint64_t tickLimit = 60 * OC::TICKS_PER_SECOND; // A minute of game time.
+	unsigned int workerCount = 0;
+	const char* definitionsPath = nullptr;
+	const char* scriptPath = nullptr;
+
+	for (int i = 1; i < _argc; ++i)
+	{
+		if (strcmp(_argv[i], "--out") == 0 && i + 1 < _argc)
+			captureSettings.folder = _argv[++i];
+		else if (strcmp(_argv[i], "--format") == 0 && i + 1 < _argc)
+		{
+			++i;
+			if (strcmp(_argv[i], "png") == 0)
+				captureSettings.format = OC::CaptureFormat::PNG;
+			else if (strcmp(_argv[i], "raw") == 0)
+				captureSettings.format = OC::CaptureFormat::RAW;
+			else
+			{
+				PrintUsage();
+				return 1;
+			}
+		}
+		else if (strcmp(_argv[i], "--size") == 0 && i + 1 < _argc)
+		{
+			char* end;
+			width = static_cast<uint32_t>(strtoul(_argv[++i], &end, 10));
+			height = *end == 'x' ? static_cast<uint32_t>(strtoul(end + 1, nullptr, 10)) : 0;
+		}
+		else if (strcmp(_argv[i], "--scale") == 0 && i + 1 < _argc)
+			scale = strtof(_argv[++i], nullptr);
+		else if (strcmp(_argv[i], "--every") == 0 && i + 1 < _argc)
+			captureSettings.interval = static_cast<uint32_t>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--encoders") == 0 && i + 1 < _argc)
+			captureSettings.encoderThreads = static_cast<uint32_t>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--seed") == 0 && i + 1 < _argc)
+			seed = strtoull(_argv[++i], nullptr, 10);
+		else if (strcmp(_argv[i], "--ticks") == 0 && i + 1 < _argc)
+			tickLimit = strtoull(_argv[++i], nullptr, 10);
+		else if (strcmp(_argv[i], "--threads") == 0 && i + 1 < _argc)
+			workerCount = static_cast<unsigned int>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--defs") == 0 && i + 1 < _argc)
+			definitionsPath = _argv[++i];
+		else if (!scriptPath && (_argv[i][0] != '-' || strcmp(_argv[i], "-") == 0))
+			scriptPath = _argv[i];
+		else
+		{
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	if (!scriptPath || width == 0 || height == 0 || !(scale > 0.0f && scale <= 1.0f) || captureSettings.interval == 0 ||
+		captureSettings.encoderThreads == 0 || tickLimit == 0)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	// Load the definitions and the match. Without a definition file, the built-in ones are used.
+	OC::DefinitionDatabase definitions;
+
+	if (definitionsPath && !definitions.Open(definitionsPath))
+	{
+		fprintf(stderr, "%s: not a valid definition file\n", definitionsPath);
+		return 1;
+	}
+
+	const OC::DefinitionDatabase* usedDefinitions = definitionsPath ? &definitions : nullptr;
+	std::vector<OC::Command> commands;
+	unsigned int errorLine = 0;
+
+	if (!OC::CommandScript::Load(scriptPath, commands, errorLine, usedDefinitions))
+	{
+		if (errorLine)
+			fprintf(stderr, "%s:%u: invalid command or unknown unit\n", scriptPath, errorLine);
+		else
+			fprintf(stderr, "%s: could not be opened\n", scriptPath);
+
+		return 1;
+	}
+
+	// --threads counts the calling thread, the job system doesn't. Encoders run on threads of their own.
+	OC::JobSystem jobs(workerCount > 0 ? workerCount - 1 : 0);
+	OC::World world(seed, &jobs, usedDefinitions);
+	world.Queue(commands);
+
+	// Frames wait for the encoders rather than being dropped, so every tick ends up in the replay.
+	captureSettings.queueFrames = 2 * captureSettings.encoderThreads + 2;
+	OC::SoftwareRenderer renderer(width, height);
+	renderer.SetResolutionScale(scale);
+
+	if (!renderer.StartCapture(captureSettings))
+	{
+		fprintf(stderr, "%s: could not be written\n", captureSettings.folder.c_str());
+		return 1;
+	}
+
+	// Units are drawn as dots in their team's color, with the tick and game time in the corner.
+	static const uint32_t TEAM_COLORS[] = {
+		OC::PackColor(60, 200, 60, 255), OC::PackColor(220, 60, 60, 255), OC::PackColor(240, 200, 40, 255), OC::PackColor(200, 80, 220, 255),
+		OC::PackColor(40, 220, 220, 255), OC::PackColor(250, 140, 40, 255), OC::PackColor(240, 240, 240, 255), OC::PackColor(30, 30, 30, 255)
+	};
+	constexpr uint32_t TEAM_COLOR_COUNT = sizeof(TEAM_COLORS) / sizeof(TEAM_COLORS[0]);
+
+	OC::Camera camera(width, height);
+	std::vector<OC::ParticleVertex> unitVertices;
+	OC::UiLayer ui;
+	std::vector<OC::UiQuad> uiQuads;
+	char hudText[64];
+	ui.AddPanel(4.0f, 4.0f, 220.0f, 24.0f, OC::PackColor(0, 0, 0, 160));
+	OC::WidgetId tickLabel = ui.AddLabel(10.0f, 10.0f, "", 12, OC::PackColor(255, 255, 255, 255));
+
+	double drawMilliseconds = 0.0;
+	auto start = std::chrono::steady_clock::now();
+
+	while (world.GetTick() < tickLimit && !world.HasEnded())
+	{
+		world.Tick();
+
+		// The camera frames the armies once they've spawned and stays put, so the replay doesn't shake.
+		if (world.GetTick() == 1)
+			FrameUnits(world.GetUnits(), width, height, camera);
+
+		auto drawStart = std::chrono::steady_clock::now();
+		const OC::UnitData& units = world.GetUnits();
+		unitVertices.clear();
+
+		for (OC::UnitId unit = 0; unit < units.Count(); ++unit)
+		{
+			if (!units.IsAlive(unit))
+				continue;
+
+			OC::ParticleVertex vertex;
+			camera.WorldToScreen(units.positionX[unit], units.positionY[unit], vertex.x, vertex.y);
+			vertex.size = fmaxf(6.0f * camera.GetZoom(), 2.0f);
+			vertex.color = TEAM_COLORS[units.team[unit] % TEAM_COLOR_COUNT];
+			unitVertices.push_back(vertex);
+		}
+
+		snprintf(hudText, sizeof(hudText), "Tick %llu  %.1f s", static_cast<unsigned long long>(world.GetTick()), world.GetTick() * OC::TICK_SECONDS);
+		ui.SetText(tickLabel, hudText);
+		ui.Build(uiQuads);
+
+		renderer.SubmitParticles(unitVertices.data(), static_cast<uint32_t>(unitVertices.size()));
+		renderer.SubmitUi(uiQuads.data(), static_cast<uint32_t>(uiQuads.size()), ui.TakeAtlasImage());
+		renderer.Present();
+		drawMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - drawStart).count();
+	}
+
+	// Wait for the last frames to be written.
+	renderer.StopCapture();
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	OC::CaptureStats stats = renderer.GetCaptureStats();
+
+	printf("Rendered %llu ticks at %ux%u (drawn at %.0f%%) in %.3f s, %.3f ms drawing per tick\n",
+		static_cast<unsigned long long>(world.GetTick()),
+		width, height,
+		scale * 100.0f,
+		seconds,
+		world.GetTick() > 0 ? drawMilliseconds / world.GetTick() : 0.0
+	);
+	printf("Frames: %llu written to %s, %llu dropped, %llu failed, %.1f frames/s\n",
+		static_cast<unsigned long long>(stats.written),
+		captureSettings.folder.c_str(),
+		static_cast<unsigned long long>(stats.dropped),
+		static_cast<unsigned long long>(stats.failed),
+		stats.written / seconds
+	);
+
+	return stats.failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,296 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: ScenarioMain.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Entry point for the scenario generator. Builds a battle from a seed, runs it headless
+		and reports how long ticks took and how much memory the process needed, to find the scale the
+		engine stops keeping up at:
+
+			OpenConquerScenario [--units N] [--teams N] [--squad N] [--map SIZE] [--mix UNIT:WEIGHT,...]
+				[--seed N] [--ticks N] [--threads N] [--defs PATH] [--write SCRIPT]
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "Source/Data/DefinitionDatabase.h"
+#include "Source/Metrics/ProcessMemory.h"
+#include "Source/Simulation/CommandScript.h"
+#include "Source/Simulation/ScenarioGenerator.h"
+#include "Source/Simulation/World.h"
+#include "Source/Threading/JobSystem.h"
+
+// Description: Prints how to use the scenario generator.
+static void PrintUsage()
+{
+	printf("Usage: OpenConquerScenario [--units N] [--teams N] [--squad N] [--map SIZE] [--mix UNIT:WEIGHT,...]\n"
+		"                           [--seed N] [--ticks N] [--threads N] [--defs PATH] [--write SCRIPT]\n");
+}
+
+// Description: Reads a mix of units like "soldier:3,tank:1". A unit without a weight has a weight of 1.
+// Parameters: 
+//    const char* _text, the mix.
+//    const OC::DefinitionDatabase& _definitions, the definitions units are looked up in.
+//    std::vector<OC::ScenarioUnit>& _outComposition, receives the mix.
+// Returns: true, if every unit was found and had a whole, positive weight.
+static bool ParseMix(const char* _text, const OC::DefinitionDatabase& _definitions, std::vector<OC::ScenarioUnit>& _outComposition)
+{
+	std::string text = _text;
+	size_t start = 0;
+	uint64_t totalWeight = 0;
+
+	while (start <= text.size())
+	{
+		size_t end = text.find(',', start);
+		std::string entry = text.substr(start, end == std::string::npos ? std::string::npos : end - start);
+		size_t colon = entry.find(':');
+
+		OC::ScenarioUnit unit;
+		unit.type = _definitions.Find(OC::DefinitionKind::UNIT, entry.substr(0, colon).c_str());
+		unit.weight = 1;
+
+		if (unit.type == OC::NO_DEFINITION)
+		{
+			fprintf(stderr, "%s: unknown unit\n", entry.substr(0, colon).c_str());
+			return false;
+		}
+
+		if (colon != std::string::npos)
+		{
+			const char* weight = entry.c_str() + colon + 1;
+			char* weightEnd = nullptr;
+			unsigned long long value = strtoull(weight, &weightEnd, 10);
+
+			// strtoull skips whitespace and takes a sign, so the weight must start with a digit.
+			if (*weight < '0' || *weight > '9' || *weightEnd != '\0' || value == 0 || value > UINT32_MAX)
+			{
+				fprintf(stderr, "%s: the weight must be a whole number from 1 to %u\n", entry.c_str(), UINT32_MAX);
+				return false;
+			}
+
+			unit.weight = static_cast<uint32_t>(value);
+		}
+
+		totalWeight += unit.weight;
+		_outComposition.push_back(unit);
+
+		if (end == std::string::npos)
+			break;
+
+		start = end + 1;
+	}
+
+	// Squads are picked by a 32-bit draw over the total weight.
+	if (totalWeight == 0 || totalWeight > UINT32_MAX)
+	{
+		fprintf(stderr, "%s: the weights must add up to between 1 and %u\n", _text, UINT32_MAX);
+		return false;
+	}
+
+	return true;
+}
+
+// Description: Prints the distribution of tick times as percentiles and a histogram of doubling buckets.
+// Parameters: 
+//    std::vector<double>& _milliseconds, the time each tick took. Sorted in place.
+static void PrintTickTimes(std::vector<double>& _milliseconds)
+{
+	std::sort(_milliseconds.begin(), _milliseconds.end());
+
+	const size_t count = _milliseconds.size();
+	auto percentile = [&](double _share) { return _milliseconds[std::min(count - 1, static_cast<size_t>(_share * count))]; };
+
+	double total = 0.0;
+	for (double milliseconds : _milliseconds)
+		total += milliseconds;
+
+	// Ticks slower than the time they simulate can't be run in real time.
+	const double budget = OC::TICK_SECONDS * 1000.0;
+	size_t overBudget = static_cast<size_t>(_milliseconds.end() - std::upper_bound(_milliseconds.begin(), _milliseconds.end(), budget));
+
+	printf("Tick time: mean=%.3f ms p50=%.3f ms p90=%.3f ms p99=%.3f ms max=%.3f ms\n",
+		total / count,
+		percentile(0.5),
+		percentile(0.9),
+		percentile(0.99),
+		_milliseconds.back()
+	);
+	printf("Over the %.0f ms real-time budget: %zu of %zu ticks (%.1f%%)\n", budget, overBudget, count, 100.0 * overBudget / count);
+
+	// Buckets double from 1/16 ms, with the first and last catching everything beyond them.
+	constexpr uint32_t BUCKETS = 14;
+	constexpr uint32_t BAR_WIDTH = 50;
+	size_t buckets[BUCKETS] = {};
+
+	for (double milliseconds : _milliseconds)
+	{
+		uint32_t bucket = 0;
+		for (double limit = 0.0625; bucket + 1 < BUCKETS && milliseconds >= limit; limit *= 2.0)
+			++bucket;
+
+		++buckets[bucket];
+	}
+
+	const size_t largest = *std::max_element(buckets, buckets + BUCKETS);
+	uint32_t first = 0, last = BUCKETS - 1;
+	while (buckets[first] == 0)
+		++first;
+	while (buckets[last] == 0)
+		--last;
+
+	for (uint32_t bucket = first; bucket <= last; ++bucket)
+	{
+		char bar[BAR_WIDTH + 1];
+		size_t length = (buckets[bucket] * BAR_WIDTH + largest - 1) / largest;
+		memset(bar, '#', length);
+		bar[length] = '\0';
+
+		if (bucket + 1 == BUCKETS)
+			printf("  >= %7g ms %8zu %s\n", 0.0625 * (1u << (bucket - 1)), buckets[bucket], bar);
+		else
+			printf("  <  %7g ms %8zu %s\n", 0.0625 * (1u << bucket), buckets[bucket], bar);
+	}
+}
+
+int main(int _argc, char** _argv)
+{
+	OC::ScenarioSettings settings;
+	const char* mix = nullptr;
+	uint64_t tickLimit = 60 * OC::TICKS_PER_SECOND; // A minute of game time.
+	unsigned int workerCount = 0;
+	const char* definitionsPath = nullptr;
+	const char* scriptPath = nullptr;
+
+	for (int i = 1; i < _argc; ++i)
+	{
+		if (strcmp(_argv[i], "--units") == 0 && i + 1 < _argc)
+			settings.unitCount = static_cast<uint32_t>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--teams") == 0 && i + 1 < _argc)
+			settings.teamCount = static_cast<uint32_t>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--squad") == 0 && i + 1 < _argc)
+			settings.squadSize = static_cast<uint32_t>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--map") == 0 && i + 1 < _argc)
+			settings.mapSize = strtof(_argv[++i], nullptr);
+		else if (strcmp(_argv[i], "--mix") == 0 && i + 1 < _argc)
+			mix = _argv[++i];
+		else if (strcmp(_argv[i], "--seed") == 0 && i + 1 < _argc)
+			settings.seed = strtoull(_argv[++i], nullptr, 10);
+		else if (strcmp(_argv[i], "--ticks") == 0 && i + 1 < _argc)
+			tickLimit = strtoull(_argv[++i], nullptr, 10);
+		else if (strcmp(_argv[i], "--threads") == 0 && i + 1 < _argc)
+			workerCount = static_cast<unsigned int>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--defs") == 0 && i + 1 < _argc)
+			definitionsPath = _argv[++i];
+		else if (strcmp(_argv[i], "--write") == 0 && i + 1 < _argc)
+			scriptPath = _argv[++i];
+		else
+		{
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	if (settings.unitCount == 0 || settings.teamCount == 0 || settings.teamCount > 256 || settings.squadSize == 0 ||
+		!(settings.mapSize > 0.0f) || tickLimit == 0)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	// Load the definitions units are drawn from. Without a file, the built-in ones are used.
+	OC::DefinitionDatabase definitions;
+
+	if (definitionsPath && !definitions.Open(definitionsPath))
+	{
+		fprintf(stderr, "%s: not a valid definition file\n", definitionsPath);
+		return 1;
+	}
+
+	const OC::DefinitionDatabase* usedDefinitions = definitionsPath ? &definitions : nullptr;
+
+	if (mix && !ParseMix(mix, usedDefinitions ? *usedDefinitions : OC::DefinitionDatabase::GetBuiltIn(), settings.composition))
+		return 1;
+
+	// Generate the battle.
+	std::vector<OC::Command> commands;
+	uint32_t squads = OC::ScenarioGenerator::Generate(settings, commands, usedDefinitions);
+
+	if (scriptPath && !OC::CommandScript::Save(scriptPath, commands, usedDefinitions))
+	{
+		fprintf(stderr, "%s: could not be written\n", scriptPath);
+		return 1;
+	}
+
+	// --threads counts the calling thread, the job system doesn't.
+	OC::JobSystem jobs(workerCount > 0 ? workerCount - 1 : 0);
+	OC::World world(settings.seed, &jobs, usedDefinitions);
+	world.Queue(commands);
+
+	printf("Scenario: seed=%llu units=%u teams=%u squads=%u map=%.0f threads=%u\n",
+		static_cast<unsigned long long>(settings.seed),
+		settings.unitCount,
+		settings.teamCount,
+		squads,
+		settings.mapSize,
+		jobs.GetWorkerCount() + 1
+	);
+
+	// Run the battle, timing every tick. The first spawns every unit, so it's reported on its own.
+	std::vector<double> milliseconds;
+	milliseconds.reserve(static_cast<size_t>(tickLimit));
+	double spawnMilliseconds = 0.0;
+	auto start = std::chrono::steady_clock::now();
+
+	while (world.GetTick() < tickLimit && !world.HasEnded())
+	{
+		auto tickStart = std::chrono::steady_clock::now();
+		world.Tick();
+		double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - tickStart).count();
+
+		if (world.GetTick() == 1)
+			spawnMilliseconds = elapsed;
+		else
+			milliseconds.push_back(elapsed);
+	}
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	printf("Simulated %llu ticks (%.1f s of game time) in %.3f s, spawning took %.3f ms\n",
+		static_cast<unsigned long long>(world.GetTick()),
+		world.GetTick() * OC::TICK_SECONDS,
+		seconds,
+		spawnMilliseconds
+	);
+
+	if (!milliseconds.empty())
+		PrintTickTimes(milliseconds);
+
+	// Report how the battle went and what it cost.
+	const OC::UnitData& units = world.GetUnits();
+	std::vector<uint32_t> alive(settings.teamCount, 0);
+
+	for (OC::UnitId unit = 0; unit < units.Count(); ++unit)
+		alive[units.team[unit]] += units.IsAlive(unit) ? 1 : 0;
+
+	printf("Alive:");
+	for (uint32_t team = 0; team < settings.teamCount; ++team)
+		printf(" team %u=%u", team, alive[team]);
+	printf("\n");
+
+	uint64_t peak = OC::ProcessMemory::GetPeakResidentBytes();
+	printf("Memory: peak resident %.1f MB (%.0f bytes per unit), resident now %.1f MB\n",
+		peak / (1024.0 * 1024.0),
+		static_cast<double>(peak) / settings.unitCount,
+		OC::ProcessMemory::GetResidentBytes() / (1024.0 * 1024.0)
+	);
+
+	return 0;
+}
@@ -0,0 +1,202 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: ServerMain.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Entry point for the headless server. Runs matches from a command script without a
+		window or renderer:
+
+			OpenConquerServer [--matches N] [--seed N] [--ticks N] [--threads N] [--ai-budget US]
+				[--load PATH] [--autosave TICKS PATH] [--metrics PATH] [--metrics-port PORT]
+				[--metrics-interval MS] [--defs PATH] [--tick-budget MS] [script|-]
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <chrono>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Source/Data/DefinitionDatabase.h"
+#include "Source/Metrics/MetricsExporter.h"
+#include "Source/Server/Server.h"
+#include "Source/Simulation/CommandScript.h"
+
+// Description: Prints how to use the server.
+static void PrintUsage()
+{
+	printf("Usage: OpenConquerServer [--matches N] [--seed N] [--ticks N] [--threads N] [--ai-budget US]\n"
+		"                         [--load PATH] [--autosave TICKS PATH] [--metrics PATH] [--metrics-port PORT]\n"
+		"                         [--metrics-interval MS] [--defs PATH] [--tick-budget MS] [script|-]\n");
+}
+
+int main(int _argc, char** _argv)
+{
+	unsigned int matchCount = 1;
+	uint64_t seed = 1;
+	uint64_t tickLimit = 60 * 60 * OC::TICKS_PER_SECOND; // An hour of game time.
+	unsigned int workerCount = 0;
+	OC::AISettings aiSettings;
+	const char* loadPath = nullptr;
+	uint64_t autosaveInterval = 0;
+	const char* autosavePath = nullptr;
+	OC::MetricsExportSettings metricsSettings;
+	const char* definitionsPath = nullptr;
+	float tickBudget = 0.0f;
+	const char* scriptPath = nullptr;
+
+	for (int i = 1; i < _argc; ++i)
+	{
+		if (strcmp(_argv[i], "--matches") == 0 && i + 1 < _argc)
+			matchCount = static_cast<unsigned int>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--seed") == 0 && i + 1 < _argc)
+			seed = strtoull(_argv[++i], nullptr, 10);
+		else if (strcmp(_argv[i], "--ticks") == 0 && i + 1 < _argc)
+			tickLimit = strtoull(_argv[++i], nullptr, 10);
+		else if (strcmp(_argv[i], "--threads") == 0 && i + 1 < _argc)
+			workerCount = static_cast<unsigned int>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--ai-budget") == 0 && i + 1 < _argc)
+			aiSettings.budgetMicroseconds = static_cast<uint32_t>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--load") == 0 && i + 1 < _argc)
+			loadPath = _argv[++i];
+		else if (strcmp(_argv[i], "--autosave") == 0 && i + 2 < _argc)
+		{
+			autosaveInterval = strtoull(_argv[++i], nullptr, 10);
+			autosavePath = _argv[++i];
+		}
+		else if (strcmp(_argv[i], "--metrics") == 0 && i + 1 < _argc)
+			metricsSettings.path = _argv[++i];
+		else if (strcmp(_argv[i], "--metrics-port") == 0 && i + 1 < _argc)
+			metricsSettings.port = static_cast<unsigned short>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--metrics-interval") == 0 && i + 1 < _argc)
+			metricsSettings.intervalMilliseconds = static_cast<unsigned int>(strtoul(_argv[++i], nullptr, 10));
+		else if (strcmp(_argv[i], "--defs") == 0 && i + 1 < _argc)
+			definitionsPath = _argv[++i];
+		else if (strcmp(_argv[i], "--tick-budget") == 0 && i + 1 < _argc)
+			tickBudget = strtof(_argv[++i], nullptr);
+		else if (!scriptPath && (_argv[i][0] != '-' || strcmp(_argv[i], "-") == 0))
+			scriptPath = _argv[i];
+		else
+		{
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	if ((!scriptPath && !loadPath) || matchCount == 0)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	// Load the definitions of every unit and weapon. Without a file, the built-in ones are used.
+	OC::DefinitionDatabase definitions;
+
+	if (definitionsPath && !definitions.Open(definitionsPath))
+	{
+		fprintf(stderr, "%s: not a valid definition file\n", definitionsPath);
+		return 1;
+	}
+
+	const OC::DefinitionDatabase* usedDefinitions = definitionsPath ? &definitions : nullptr;
+
+	// Load the commands every match is driven by.
+	std::vector<OC::Command> commands;
+	unsigned int errorLine = 0;
+
+	if (scriptPath && !OC::CommandScript::Load(scriptPath, commands, errorLine, usedDefinitions))
+	{
+		if (errorLine)
+			fprintf(stderr, "%s:%u: invalid command or unknown unit\n", scriptPath, errorLine);
+		else
+			fprintf(stderr, "%s: could not be opened\n", scriptPath);
+
+		return 1;
+	}
+
+	// The registry outlives the server, which holds on to its metrics.
+	OC::MetricsRegistry metrics;
+	std::unique_ptr<OC::MetricsExporter> metricsExporter;
+
+	// Run the matches.
+	OC::Server server(matchCount, seed, tickLimit, workerCount, usedDefinitions);
+	server.SetAISettings(aiSettings);
+
+	if (tickBudget > 0.0f)
+	{
+		OC::GovernorSettings governorSettings;
+		governorSettings.budgetMilliseconds = tickBudget;
+		server.SetGovernor(governorSettings);
+	}
+
+	if (!metricsSettings.path.empty() || metricsSettings.port)
+	{
+		server.RegisterMetrics(metrics);
+		metricsExporter.reset(new OC::MetricsExporter(metrics, metricsSettings));
+
+		if (metricsSettings.port && !metricsExporter->IsListening())
+			fprintf(stderr, "Metrics could not be served on port %u\n", static_cast<unsigned int>(metricsSettings.port));
+	}
+
+	if (loadPath && !server.Load(loadPath))
+	{
+		fprintf(stderr, "%s.<match>.ocsave: missing or not a valid save\n", loadPath);
+		return 1;
+	}
+
+	if (autosavePath)
+		server.SetAutosave(autosaveInterval, autosavePath);
+
+	server.Queue(commands);
+
+	auto start = std::chrono::steady_clock::now();
+	server.Run();
+	auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	if (unsigned int failures = server.FlushAutosaves())
+		fprintf(stderr, "%u autosaves could not be written\n", failures);
+
+	// Report the outcome of every match.
+	uint64_t totalTicks = 0;
+
+	for (unsigned int i = 0; i < server.GetMatchCount(); ++i)
+	{
+		const OC::World& match = server.GetMatch(i);
+		const OC::UnitData& units = match.GetUnits();
+		const OC::AISystem& ai = match.GetAI();
+		unsigned int alive = 0, engaged = 0, retreating = 0;
+
+		for (OC::UnitId unit = 0; unit < units.Count(); ++unit)
+		{
+			if (!units.IsAlive(unit))
+				continue;
+
+			// Units the AI hasn't seen yet haven't decided to do anything.
+			OC::Behavior behavior = unit < ai.GetUnitCount() ? ai.GetBehavior(unit) : OC::Behavior::IDLE;
+			++alive;
+			engaged += behavior == OC::Behavior::ENGAGE ? 1 : 0;
+			retreating += behavior == OC::Behavior::RETREAT ? 1 : 0;
+		}
+
+		printf("Match %u: seed=%llu ticks=%llu units=%u alive=%u engaged=%u retreating=%u\n",
+			i,
+			static_cast<unsigned long long>(match.GetSeed()),
+			static_cast<unsigned long long>(match.GetTick()),
+			units.Count(),
+			alive,
+			engaged,
+			retreating
+		);
+
+		totalTicks += match.GetTick();
+	}
+
+	printf("Simulated %llu ticks in %.3f s (%.0f ticks/s)\n",
+		static_cast<unsigned long long>(totalTicks),
+		elapsed,
+		elapsed > 0.0 ? totalTicks / elapsed : 0.0
+	);
+
+	return 0;
+}
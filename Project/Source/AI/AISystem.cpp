@@ -0,0 +1,274 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: AISystem.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <assert.h>
+#include <chrono>
+#include <math.h>
+#include "AISystem.h"
+
+namespace OC
+{
+	// private
+
+	void AISystem::Think(UnitData& _units, const SpatialGrid& _grid, UnitId _unit)
+	{
+		const float x = _units.positionX[_unit];
+		const float y = _units.positionY[_unit];
+		const uint8_t team = _units.team[_unit];
+		const WeaponType weapon = m_Definitions.GetUnit(_units.type[_unit]).weapon;
+		const uint32_t maxCandidates = m_Settings.maxCandidates;
+		uint32_t count = 0;
+
+		// Gather neighbours into the scratch arrays.
+		_grid.Query(x, y, m_Settings.senseRadius, [&](UnitId _other, float _dx, float _dy, float _distanceSq)
+		{
+			if (_other == _unit)
+				return true;
+
+			m_CandidateUnit[count] = _other;
+			m_CandidateDX[count] = _dx;
+			m_CandidateDY[count] = _dy;
+			m_CandidateDistance[count] = _distanceSq;
+			m_CandidateHealth[count] = _units.health[_other];
+			m_CandidateEnemy[count] = _units.team[_other] != team ? 1.0f : 0.0f;
+
+			return ++count < maxCandidates;
+		});
+
+		// Score every neighbour. Branch-free so the loop vectorizes.
+		float* distance = m_CandidateDistance.data();
+		const float* health = m_CandidateHealth.data();
+		const float* enemy = m_CandidateEnemy.data();
+		const float* dx = m_CandidateDX.data();
+		const float* dy = m_CandidateDY.data();
+		float threat = 0.0f, support = 0.0f;
+		float awayX = 0.0f, awayY = 0.0f;
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			distance[i] = sqrtf(distance[i]) + 1.0f;
+
+			float strength = health[i] / distance[i];
+			threat += enemy[i] * strength;
+			support += (1.0f - enemy[i]) * strength;
+
+			// Points away from enemies, stronger for close and healthy ones.
+			float push = enemy[i] * strength / distance[i];
+			awayX -= dx[i] * push;
+			awayY -= dy[i] * push;
+		}
+
+		// Prefer close, weakened enemies. Ties go to the lowest id so the choice is deterministic. Unarmed
+		// units have nothing to attack with, so they never pick a target.
+		UnitId target = INVALID_UNIT;
+		float bestScore = 0.0f;
+
+		for (uint32_t i = 0; weapon != NO_DEFINITION && i < count; ++i)
+		{
+			float score = enemy[i] * (200.0f - health[i]) / distance[i];
+
+			if (score > bestScore || (score == bestScore && score > 0.0f && m_CandidateUnit[i] < target))
+			{
+				bestScore = score;
+				target = m_CandidateUnit[i];
+			}
+		}
+
+		m_Threat[_unit] = threat;
+
+		// Decide what to do. Unarmed units can't fight back, so they retreat whatever their health.
+		if ((weapon == NO_DEFINITION || _units.health[_unit] < m_Settings.retreatHealth) && threat > support && (awayX != 0.0f || awayY != 0.0f))
+		{
+			float length = sqrtf(awayX * awayX + awayY * awayY);
+
+			m_Behavior[_unit] = Behavior::RETREAT;
+			m_Target[_unit] = INVALID_UNIT;
+			_units.goalX[_unit] = x + awayX / length * m_Settings.senseRadius;
+			_units.goalY[_unit] = y + awayY / length * m_Settings.senseRadius;
+		}
+		else if (target != INVALID_UNIT)
+		{
+			float toX = _units.positionX[target] - x;
+			float toY = _units.positionY[target] - y;
+			float length = sqrtf(toX * toX + toY * toY);
+			float approach = length - m_Definitions.GetWeapon(weapon).range * m_Settings.rangeShare;
+
+			m_Behavior[_unit] = Behavior::ENGAGE;
+			m_Target[_unit] = target;
+
+			// Close in until the target is inside the weapon's range, then hold.
+			if (approach > 0.0f)
+			{
+				_units.goalX[_unit] = x + toX / length * approach;
+				_units.goalY[_unit] = y + toY / length * approach;
+			}
+			else
+			{
+				_units.goalX[_unit] = x;
+				_units.goalY[_unit] = y;
+			}
+		}
+		else
+		{
+			// Nothing to do. Existing orders stand.
+			m_Behavior[_unit] = Behavior::IDLE;
+			m_Target[_unit] = INVALID_UNIT;
+		}
+	}
+
+	// public
+
+	AISystem::AISystem(const DefinitionDatabase& _definitions, const AISettings& _settings) :
+		m_Definitions(_definitions),
+		m_Settings(_settings),
+		m_Behavior(), m_Target(), m_Threat(),
+		m_Cursor(0),
+		m_LastThinkCount(0),
+		m_CandidateUnit(), m_CandidateDX(), m_CandidateDY(),
+		m_CandidateDistance(), m_CandidateHealth(), m_CandidateEnemy()
+	{
+		SetSettings(_settings);
+	}
+
+	void AISystem::Track(uint32_t _unitCount)
+	{
+		assert(_unitCount >= m_Behavior.size()); // Error: Units are never removed.
+
+		m_Behavior.resize(_unitCount, Behavior::IDLE);
+		m_Target.resize(_unitCount, INVALID_UNIT);
+		m_Threat.resize(_unitCount, 0.0f);
+	}
+
+	void AISystem::Update(UnitData& _units, const SpatialGrid& _grid)
+	{
+		constexpr uint32_t BATCH_SIZE = 64; // Units re-thought between budget checks.
+
+		const uint32_t count = _units.Count();
+
+		Track(count);
+		m_LastThinkCount = 0;
+
+		if (count == 0)
+			return;
+
+		// Re-think a slice of the units, round-robin.
+		const uint32_t thinks = std::min(
+			(count + m_Settings.thinkInterval - 1) / m_Settings.thinkInterval,
+			m_Settings.maxThinksPerTick
+		);
+		const auto start = std::chrono::steady_clock::now();
+
+		while (m_LastThinkCount < thinks)
+		{
+			const uint32_t batch = std::min(BATCH_SIZE, thinks - m_LastThinkCount);
+
+			for (uint32_t i = 0; i < batch; ++i)
+			{
+				if (m_Cursor >= count)
+					m_Cursor = 0;
+
+				if (_units.IsAlive(m_Cursor))
+					Think(_units, _grid, m_Cursor);
+
+				++m_Cursor;
+			}
+
+			m_LastThinkCount += batch;
+
+			if (m_Settings.budgetMicroseconds &&
+				std::chrono::steady_clock::now() - start >= std::chrono::microseconds(m_Settings.budgetMicroseconds))
+				break;
+		}
+	}
+
+	void AISystem::Save(SaveWriter& _save) const
+	{
+		_save.BeginChunk(MakeChunkId('A', 'I', 'S', 'T'), 1);
+		_save.WriteArray(m_Behavior);
+		_save.WriteArray(m_Target);
+		_save.WriteArray(m_Threat);
+		_save.Write(m_Cursor);
+		_save.EndChunk();
+	}
+
+	bool AISystem::Load(SaveReader& _save, uint32_t _unitCount)
+	{
+		uint16_t version;
+
+		if (!_save.OpenChunk(MakeChunkId('A', 'I', 'S', 'T'), version) || version != 1 ||
+			!_save.ReadArray(m_Behavior) || !_save.ReadArray(m_Target) || !_save.ReadArray(m_Threat) || !_save.Read(m_Cursor))
+			return false;
+
+		// The AI may not have seen units spawned on the tick of the save yet, but never more units than exist.
+		if (m_Behavior.size() > _unitCount || m_Target.size() != m_Behavior.size() || m_Threat.size() != m_Behavior.size() ||
+			m_Cursor > _unitCount)
+			return false;
+
+		for (size_t i = 0; i < m_Behavior.size(); ++i)
+		{
+			if (m_Behavior[i] >= Behavior::_COUNT || (m_Target[i] != INVALID_UNIT && m_Target[i] >= _unitCount))
+				return false;
+		}
+
+		return true;
+	}
+
+	const AISettings& AISystem::GetSettings() const
+	{
+		return m_Settings;
+	}
+
+	void AISystem::SetSettings(const AISettings& _settings)
+	{
+		assert(_settings.thinkInterval > 0); // Error: Units must re-think eventually.
+		assert(_settings.maxThinksPerTick > 0); // Error: At least one unit must re-think per tick.
+		assert(_settings.maxCandidates > 0); // Error: Units must be able to see at least one neighbour.
+		assert(_settings.rangeShare > 0.0f && _settings.rangeShare <= 1.0f); // Error: Units must close in to within their weapon's range.
+
+		m_Settings = _settings;
+
+		m_CandidateUnit.resize(m_Settings.maxCandidates);
+		m_CandidateDX.resize(m_Settings.maxCandidates);
+		m_CandidateDY.resize(m_Settings.maxCandidates);
+		m_CandidateDistance.resize(m_Settings.maxCandidates);
+		m_CandidateHealth.resize(m_Settings.maxCandidates);
+		m_CandidateEnemy.resize(m_Settings.maxCandidates);
+	}
+
+	uint32_t AISystem::GetUnitCount() const
+	{
+		return static_cast<uint32_t>(m_Behavior.size());
+	}
+
+	Behavior AISystem::GetBehavior(UnitId _unit) const
+	{
+		assert(_unit < m_Behavior.size()); // Error: Invalid unit.
+
+		return m_Behavior[_unit];
+	}
+
+	const std::vector<UnitId>& AISystem::GetTargets() const
+	{
+		return m_Target;
+	}
+
+	float AISystem::GetThreat(UnitId _unit) const
+	{
+		assert(_unit < m_Threat.size()); // Error: Invalid unit.
+
+		return m_Threat[_unit];
+	}
+
+	uint32_t AISystem::GetLastThinkCount() const
+	{
+		return m_LastThinkCount;
+	}
+}
@@ -0,0 +1,135 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: AISystem.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Decides what units do on their own: which enemy to target, how threatened they are and
+		when to retreat. Armed units close in until their target is inside their weapon's range. Unarmed
+		units never engage, and back away from any threat stronger than their support. Thinking is time-sliced. Each tick only a slice of the units re-think, in batches,
+		so the cost per tick is capped no matter how many units there are. Neighbours are gathered from
+		the spatial grid into small SoA scratch arrays and scored in tight loops. A time budget can also
+		cut a tick's thinking short, but that makes matches depend on machine speed, so leave it off when
+		replays must match.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <vector>
+#include "../Data/DefinitionDatabase.h"
+#include "../Serialization/SaveGame.h"
+#include "../Simulation/SpatialGrid.h"
+#include "../Simulation/Units.h"
+
+namespace OC
+{
+	enum class Behavior : uint8_t
+	{
+		IDLE,		// No enemies nearby. Follows orders.
+		ENGAGE,		// Closing in on, or firing at, its target.
+		RETREAT,	// Badly hurt and outnumbered. Moving away from the threat.
+		_COUNT
+	};
+
+	struct AISettings
+	{
+		float senseRadius = 250.0f; // How far units look for enemies and allies.
+		float rangeShare = 0.9f; // How close units get to their target, as a share of their weapon's range.
+		float retreatHealth = 30.0f; // Units with less health than this retreat when outnumbered.
+		uint32_t thinkInterval = 10; // Every unit re-thinks at least once every this many ticks...
+		uint32_t maxThinksPerTick = 4096; // ...unless that would exceed this many re-thinks in one tick.
+		uint32_t maxCandidates = 64; // The most neighbours considered per re-think.
+		uint32_t budgetMicroseconds = 0; // Stop thinking for the tick after this long. 0 is unlimited.
+	};
+
+	class AISystem
+	{
+	private:
+		const DefinitionDatabase& m_Definitions; // Which weapon each unit carries, and its range.
+		AISettings m_Settings; // Tuning values.
+		std::vector<Behavior> m_Behavior; // What each unit is doing.
+		std::vector<UnitId> m_Target; // The enemy each unit is after, or INVALID_UNIT. May have died since the unit last thought.
+		std::vector<float> m_Threat; // Enemy strength near each unit, weighted by distance.
+		uint32_t m_Cursor; // The next unit to re-think.
+		uint32_t m_LastThinkCount; // The number of units that re-thought last update.
+
+		std::vector<UnitId> m_CandidateUnit; // Neighbours of the unit being thought about...
+		std::vector<float> m_CandidateDX, m_CandidateDY; // ...their offset from it...
+		std::vector<float> m_CandidateDistance; // ...their distance from it...
+		std::vector<float> m_CandidateHealth; // ...their health...
+		std::vector<float> m_CandidateEnemy; // ...and 1 if they are an enemy, 0 if not.
+
+		// Description: Re-thinks one unit.
+		// Parameters: 
+		//    UnitData& _units, every unit in the world.
+		//    const SpatialGrid& _grid, the grid of living units.
+		//    UnitId _unit, the unit to re-think.
+		void Think(UnitData& _units, const SpatialGrid& _grid, UnitId _unit);
+
+	public:
+		// Description: Constructs the AI system.
+		// Parameters: 
+		//    const DefinitionDatabase& _definitions, the units and weapons. Must outlive the system.
+		//    const AISettings& _settings, tuning values.
+		explicit AISystem(const DefinitionDatabase& _definitions, const AISettings& _settings = AISettings());
+
+		// Description: Starts tracking units spawned since the last call. They are idle until they re-think.
+		// Parameters: 
+		//    uint32_t _unitCount, the number of units in the world.
+		void Track(uint32_t _unitCount);
+
+		// Description: Re-thinks the next slice of units. May change their goals.
+		// Parameters: 
+		//    UnitData& _units, every unit in the world.
+		//    const SpatialGrid& _grid, the grid of living units. Must be built from _units.
+		void Update(UnitData& _units, const SpatialGrid& _grid);
+
+		// Description: Adds the state of every unit's AI to a save.
+		// Parameters: 
+		//    SaveWriter& _save, the save to add to.
+		void Save(SaveWriter& _save) const;
+
+		// Description: Restores the state saved by Save.
+		// Parameters: 
+		//    SaveReader& _save, the save to read from.
+		//    uint32_t _unitCount, the number of units in the loaded world.
+		// Returns: true, if the save held valid AI state for that many units.
+		bool Load(SaveReader& _save, uint32_t _unitCount);
+
+		// Description: Returns the tuning values.
+		// Returns: The settings.
+		const AISettings& GetSettings() const;
+
+		// Description: Replaces the tuning values.
+		// Parameters: 
+		//    const AISettings& _settings, the new settings.
+		void SetSettings(const AISettings& _settings);
+
+		// Description: Returns the number of units tracked. Units spawned since the last update or Track
+		//    aren't tracked yet.
+		// Returns: The number of units.
+		uint32_t GetUnitCount() const;
+
+		// Description: Returns what a unit is doing.
+		// Parameters: 
+		//    UnitId _unit, the unit. Must be tracked.
+		// Returns: The unit's behavior.
+		Behavior GetBehavior(UnitId _unit) const;
+
+		// Description: Returns the target of every unit, indexed by unit. Targets are only checked when units
+		//    re-think, so users must check that a target is still alive.
+		// Returns: The targets. INVALID_UNIT where a unit has none.
+		const std::vector<UnitId>& GetTargets() const;
+
+		// Description: Returns how threatened a unit is.
+		// Parameters: 
+		//    UnitId _unit, the unit.
+		// Returns: Enemy strength near the unit, weighted by distance.
+		float GetThreat(UnitId _unit) const;
+
+		// Description: Returns the number of units that re-thought during the last update.
+		// Returns: The number of re-thinks.
+		uint32_t GetLastThinkCount() const;
+	};
+}
@@ -0,0 +1,440 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: InfluenceMap.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+#include "InfluenceMap.h"
+#include "../Math/Simd.h"
+
+namespace OC
+{
+	constexpr uint32_t LAYER_COUNT = static_cast<uint32_t>(InfluenceLayer::_COUNT);
+
+	// private
+
+	float* InfluenceMap::Layer(InfluenceLayer _layer, uint32_t _team)
+	{
+		return m_Layers[_team * LAYER_COUNT + static_cast<uint32_t>(_layer)].data();
+	}
+
+	void InfluenceMap::MarkStamp(const Stamp& _stamp)
+	{
+		const int32_t radius = static_cast<int32_t>(m_Settings.stampRadius);
+		const uint32_t x0 = static_cast<uint32_t>(std::max(_stamp.x - radius, 0)) / TILE_SIZE;
+		const uint32_t y0 = static_cast<uint32_t>(std::max(_stamp.y - radius, 0)) / TILE_SIZE;
+		const uint32_t x1 = static_cast<uint32_t>(std::min(_stamp.x + radius, static_cast<int32_t>(m_Settings.width) - 1)) / TILE_SIZE;
+		const uint32_t y1 = static_cast<uint32_t>(std::min(_stamp.y + radius, static_cast<int32_t>(m_Settings.height) - 1)) / TILE_SIZE;
+		uint8_t* dirty = &m_DirtyPresence[_stamp.team * m_TilesX * m_TilesY];
+
+		for (uint32_t tileY = y0; tileY <= y1; ++tileY)
+			for (uint32_t tileX = x0; tileX <= x1; ++tileX)
+				dirty[tileY * m_TilesX + tileX] = 1;
+	}
+
+	void InfluenceMap::StampTeam(uint32_t _team)
+	{
+		const uint32_t tileCount = m_TilesX * m_TilesY;
+		const uint32_t width = m_Settings.width;
+		const int32_t radius = static_cast<int32_t>(m_Settings.stampRadius);
+		const uint32_t side = 2 * m_Settings.stampRadius + 1;
+		const uint8_t* dirty = &m_DirtyPresence[_team * tileCount];
+		float* presence = Layer(InfluenceLayer::PRESENCE, _team);
+
+		if (std::find(dirty, dirty + tileCount, 1) == dirty + tileCount)
+			return;
+
+		for (uint32_t tile = 0; tile < tileCount; ++tile)
+		{
+			if (!dirty[tile])
+				continue;
+
+			float* corner = &presence[(tile / m_TilesX) * TILE_SIZE * width + (tile % m_TilesX) * TILE_SIZE];
+			for (uint32_t row = 0; row < TILE_SIZE; ++row)
+				memset(corner + row * width, 0, TILE_SIZE * sizeof(float));
+		}
+
+		// Units are stamped in id order into every dirty tile they overlap, clipped to the tile. Each
+		// cell sums the same units in the same order as a full rebuild would, so the result is identical.
+		for (UnitId unit : m_TeamUnits[_team])
+		{
+			const Stamp& stamp = m_Stamps[unit];
+			const int32_t x0 = std::max(stamp.x - radius, 0);
+			const int32_t y0 = std::max(stamp.y - radius, 0);
+			const int32_t x1 = std::min(stamp.x + radius, static_cast<int32_t>(width) - 1);
+			const int32_t y1 = std::min(stamp.y + radius, static_cast<int32_t>(m_Settings.height) - 1);
+			const Simd::Float4 strength = Simd::Set(stamp.strength);
+
+			for (int32_t tileY = y0 / static_cast<int32_t>(TILE_SIZE); tileY <= y1 / static_cast<int32_t>(TILE_SIZE); ++tileY)
+			{
+				for (int32_t tileX = x0 / static_cast<int32_t>(TILE_SIZE); tileX <= x1 / static_cast<int32_t>(TILE_SIZE); ++tileX)
+				{
+					if (!dirty[tileY * m_TilesX + tileX])
+						continue;
+
+					const int32_t left = std::max(x0, tileX * static_cast<int32_t>(TILE_SIZE));
+					const int32_t right = std::min(x1, tileX * static_cast<int32_t>(TILE_SIZE) + static_cast<int32_t>(TILE_SIZE) - 1);
+					const int32_t top = std::max(y0, tileY * static_cast<int32_t>(TILE_SIZE));
+					const int32_t bottom = std::min(y1, tileY * static_cast<int32_t>(TILE_SIZE) + static_cast<int32_t>(TILE_SIZE) - 1);
+					const int32_t span = right - left + 1;
+
+					for (int32_t y = top; y <= bottom; ++y)
+					{
+						const float* kernel = &m_Kernel[(y - stamp.y + radius) * side + (left - stamp.x + radius)];
+						float* out = &presence[y * width + left];
+						int32_t i = 0;
+
+						for (; i + static_cast<int32_t>(Simd::WIDTH) <= span; i += Simd::WIDTH)
+							Simd::Store(out + i, Simd::Add(Simd::Load(out + i), Simd::Mul(Simd::Load(kernel + i), strength)));
+
+						for (; i < span; ++i)
+							out[i] += kernel[i] * stamp.strength;
+					}
+				}
+			}
+		}
+	}
+
+	void InfluenceMap::SpreadTile(uint32_t _team, uint32_t _tile, std::vector<float>& _scratch)
+	{
+		// The tile is blurred inside a window padded by at least one cell per pass. Cells near the edge
+		// of the window come out wrong, since they miss what's beyond it, but the error creeps in by one
+		// cell per pass and never reaches the tile.
+		const uint32_t pad = (m_Settings.blurPasses + Simd::WIDTH - 1) & ~(Simd::WIDTH - 1);
+		const uint32_t size = TILE_SIZE + 2 * pad;
+		// Zeroed guard columns and rows let every pass read its neighbours without checking for edges.
+		const uint32_t stride = size + 2 * Simd::WIDTH;
+		const uint32_t rows = size + 2;
+		const uint32_t width = m_Settings.width;
+		const uint32_t height = m_Settings.height;
+
+		_scratch.assign(2 * rows * stride, 0.0f);
+		float* a = _scratch.data() + stride + Simd::WIDTH;
+		float* b = a + rows * stride;
+
+		// Copy the window of presence. Cells outside the grid stay 0.
+		const int32_t left = static_cast<int32_t>((_tile % m_TilesX) * TILE_SIZE) - static_cast<int32_t>(pad);
+		const int32_t top = static_cast<int32_t>((_tile / m_TilesX) * TILE_SIZE) - static_cast<int32_t>(pad);
+		const int32_t copyLeft = std::max(left, 0);
+		const int32_t copyRight = std::min(left + static_cast<int32_t>(size), static_cast<int32_t>(width));
+		const float* presence = Layer(InfluenceLayer::PRESENCE, _team);
+
+		for (uint32_t y = 0; y < size; ++y)
+		{
+			const int32_t gridY = top + static_cast<int32_t>(y);
+			if (gridY < 0 || gridY >= static_cast<int32_t>(height))
+				continue;
+
+			memcpy(&a[y * stride + (copyLeft - left)], &presence[gridY * width + copyLeft], (copyRight - copyLeft) * sizeof(float));
+		}
+
+		const Simd::Float4 centre = Simd::Set(1.0f - 2.0f * m_Settings.spread);
+		const Simd::Float4 spread = Simd::Set(m_Settings.spread);
+
+		for (uint32_t pass = 0; pass < m_Settings.blurPasses; ++pass)
+		{
+			// Across, from a into b...
+			for (uint32_t y = 0; y < size; ++y)
+			{
+				const float* in = &a[y * stride];
+				float* out = &b[y * stride];
+
+				for (uint32_t x = 0; x < size; x += Simd::WIDTH)
+				{
+					Simd::Float4 sides = Simd::Add(Simd::Load(in + x - 1), Simd::Load(in + x + 1));
+					Simd::Store(out + x, Simd::Add(Simd::Mul(Simd::Load(in + x), centre), Simd::Mul(sides, spread)));
+				}
+			}
+
+			// ...then down, back into a.
+			for (uint32_t y = 0; y < size; ++y)
+			{
+				const float* in = &b[y * stride];
+				float* out = &a[y * stride];
+
+				for (uint32_t x = 0; x < size; x += Simd::WIDTH)
+				{
+					Simd::Float4 sides = Simd::Add(Simd::Load(in + x - stride), Simd::Load(in + x + stride));
+					Simd::Store(out + x, Simd::Add(Simd::Mul(Simd::Load(in + x), centre), Simd::Mul(sides, spread)));
+				}
+			}
+		}
+
+		float* influence = Layer(InfluenceLayer::INFLUENCE, _team);
+		for (uint32_t y = 0; y < TILE_SIZE; ++y)
+			memcpy(&influence[(top + pad + y) * width + left + pad], &a[(pad + y) * stride + pad], TILE_SIZE * sizeof(float));
+	}
+
+	void InfluenceMap::CombineTile(uint32_t _tile)
+	{
+		const uint32_t teamCount = m_Settings.teamCount;
+		const uint32_t width = m_Settings.width;
+		const uint32_t corner = (_tile / m_TilesX) * TILE_SIZE * width + (_tile % m_TilesX) * TILE_SIZE;
+
+		for (uint32_t team = 0; team < teamCount; ++team)
+		{
+			const float* influence = Layer(InfluenceLayer::INFLUENCE, team) + corner;
+			float* threat = Layer(InfluenceLayer::THREAT, team) + corner;
+			float* tension = Layer(InfluenceLayer::TENSION, team) + corner;
+
+			for (uint32_t row = 0; row < TILE_SIZE; ++row)
+			{
+				const uint32_t offset = row * width;
+				memset(threat + offset, 0, TILE_SIZE * sizeof(float));
+
+				for (uint32_t enemy = 0; enemy < teamCount; ++enemy)
+					if (enemy != team)
+						Combine(InfluenceOperation::SUM, threat + offset, Layer(InfluenceLayer::INFLUENCE, enemy) + corner + offset, threat + offset, TILE_SIZE);
+
+				Combine(InfluenceOperation::MIN, influence + offset, threat + offset, tension + offset, TILE_SIZE);
+			}
+		}
+	}
+
+	// public
+
+	InfluenceMap::InfluenceMap(const InfluenceSettings& _settings) :
+		m_Settings(_settings),
+		m_TilesX(_settings.width / TILE_SIZE),
+		m_TilesY(_settings.height / TILE_SIZE),
+		m_Layers(_settings.teamCount * LAYER_COUNT, std::vector<float>(static_cast<size_t>(_settings.width) * _settings.height, 0.0f)),
+		m_Kernel(),
+		m_Stamps(),
+		m_TeamUnits(_settings.teamCount),
+		m_DirtyPresence(_settings.teamCount * m_TilesX * m_TilesY, 0),
+		m_DirtyInfluence(_settings.teamCount * m_TilesX * m_TilesY, 0),
+		m_DirtyCombined(m_TilesX * m_TilesY, 0),
+		m_Work(),
+		m_Invalid(true),
+		m_LastTileCount(0)
+	{
+		assert(_settings.width > 0 && _settings.height > 0 && _settings.width % TILE_SIZE == 0 && _settings.height % TILE_SIZE == 0); // Error: The grid must be a whole number of tiles.
+		assert(_settings.teamCount > 0 && _settings.teamCount <= 256); // Error: Teams are 8-bit.
+		assert(_settings.blurPasses <= TILE_SIZE); // Error: Too many passes to only update neighbouring tiles.
+		assert(_settings.spread >= 0.0f && _settings.spread < 0.5f); // Error: Spreading must not amplify.
+		assert(_settings.cellSize > 0.0f); // Error: Cells must have a size.
+
+		// A cone, reaching 0 just beyond the radius so the outermost cells still get some presence.
+		const int32_t radius = static_cast<int32_t>(_settings.stampRadius);
+		const float reach = static_cast<float>(radius + 1);
+
+		for (int32_t y = -radius; y <= radius; ++y)
+			for (int32_t x = -radius; x <= radius; ++x)
+				m_Kernel.push_back(std::max(0.0f, 1.0f - sqrtf(static_cast<float>(x * x + y * y)) / reach));
+	}
+
+	void InfluenceMap::Update(const UnitData& _units, JobSystem* _jobs)
+	{
+		const uint32_t count = _units.Count();
+		const uint32_t teamCount = m_Settings.teamCount;
+		const uint32_t tileCount = m_TilesX * m_TilesY;
+		const float inverseCellSize = 1.0f / m_Settings.cellSize;
+		const int32_t maxX = static_cast<int32_t>(m_Settings.width) - 1;
+		const int32_t maxY = static_cast<int32_t>(m_Settings.height) - 1;
+
+		if (m_Invalid)
+		{
+			m_Stamps.clear();
+			std::fill(m_DirtyPresence.begin(), m_DirtyPresence.end(), 1);
+			m_Invalid = false;
+		}
+
+		// Units that no longer exist take their presence with them.
+		for (uint32_t unit = count; unit < m_Stamps.size(); ++unit)
+			if (m_Stamps[unit].strength > 0.0f)
+				MarkStamp(m_Stamps[unit]);
+
+		m_Stamps.resize(count, Stamp{ 0, 0, 0.0f, 0 });
+
+		for (std::vector<UnitId>& units : m_TeamUnits)
+			units.clear();
+
+		// Find the units whose stamp changed. Units outside the grid are stamped on its edge.
+		for (UnitId unit = 0; unit < count; ++unit)
+		{
+			Stamp next = { 0, 0, 0.0f, 0 };
+
+			if (_units.IsAlive(unit) && _units.team[unit] < teamCount)
+			{
+				next.x = std::min(std::max(static_cast<int32_t>(floorf((_units.positionX[unit] - m_Settings.originX) * inverseCellSize)), 0), maxX);
+				next.y = std::min(std::max(static_cast<int32_t>(floorf((_units.positionY[unit] - m_Settings.originY) * inverseCellSize)), 0), maxY);
+				next.strength = _units.health[unit] * m_Settings.strengthPerHealth;
+				next.team = _units.team[unit];
+				m_TeamUnits[next.team].push_back(unit);
+			}
+
+			Stamp& previous = m_Stamps[unit];
+			if (previous.x != next.x || previous.y != next.y || previous.strength != next.strength || previous.team != next.team)
+			{
+				if (previous.strength > 0.0f)
+					MarkStamp(previous);
+				if (next.strength > 0.0f)
+					MarkStamp(next);
+
+				previous = next;
+			}
+		}
+
+		// Teams have separate layers, so they can be stamped at the same time.
+		if (_jobs)
+			_jobs->ParallelFor(teamCount, 1, [this](uint32_t _begin, uint32_t _end)
+			{
+				for (uint32_t team = _begin; team < _end; ++team)
+					StampTeam(team);
+			});
+		else
+		{
+			for (uint32_t team = 0; team < teamCount; ++team)
+				StampTeam(team);
+		}
+
+		// Blurring reaches at most a tile, so a tile's influence changes only if its presence or a
+		// neighbour's did.
+		for (uint32_t team = 0; team < teamCount; ++team)
+		{
+			uint8_t* presence = &m_DirtyPresence[team * tileCount];
+			uint8_t* influence = &m_DirtyInfluence[team * tileCount];
+
+			for (uint32_t tile = 0; tile < tileCount; ++tile)
+			{
+				if (!presence[tile])
+					continue;
+
+				const uint32_t tileX = tile % m_TilesX, tileY = tile / m_TilesX;
+				for (uint32_t y = tileY > 0 ? tileY - 1 : 0; y <= std::min(tileY + 1, m_TilesY - 1); ++y)
+					for (uint32_t x = tileX > 0 ? tileX - 1 : 0; x <= std::min(tileX + 1, m_TilesX - 1); ++x)
+						influence[y * m_TilesX + x] = 1;
+
+				presence[tile] = 0;
+			}
+		}
+
+		m_Work.clear();
+		for (uint32_t index = 0; index < teamCount * tileCount; ++index)
+		{
+			if (m_DirtyInfluence[index])
+			{
+				m_Work.push_back(index);
+				m_DirtyCombined[index % tileCount] = 1;
+				m_DirtyInfluence[index] = 0;
+			}
+		}
+
+		m_LastTileCount = static_cast<uint32_t>(m_Work.size());
+
+		auto spread = [this, tileCount](uint32_t _begin, uint32_t _end)
+		{
+			std::vector<float> scratch;
+			for (uint32_t i = _begin; i < _end; ++i)
+				SpreadTile(m_Work[i] / tileCount, m_Work[i] % tileCount, scratch);
+		};
+
+		if (_jobs)
+			_jobs->ParallelFor(static_cast<uint32_t>(m_Work.size()), 8, spread);
+		else if (!m_Work.empty())
+			spread(0, static_cast<uint32_t>(m_Work.size()));
+
+		// Threat and tension read every team, so they wait until every team has spread.
+		m_Work.clear();
+		for (uint32_t tile = 0; tile < tileCount; ++tile)
+		{
+			if (m_DirtyCombined[tile])
+			{
+				m_Work.push_back(tile);
+				m_DirtyCombined[tile] = 0;
+			}
+		}
+
+		auto combine = [this](uint32_t _begin, uint32_t _end)
+		{
+			for (uint32_t i = _begin; i < _end; ++i)
+				CombineTile(m_Work[i]);
+		};
+
+		if (_jobs)
+			_jobs->ParallelFor(static_cast<uint32_t>(m_Work.size()), 8, combine);
+		else if (!m_Work.empty())
+			combine(0, static_cast<uint32_t>(m_Work.size()));
+	}
+
+	void InfluenceMap::Invalidate()
+	{
+		m_Invalid = true;
+	}
+
+	const float* InfluenceMap::GetLayer(InfluenceLayer _layer, uint8_t _team) const
+	{
+		assert(_layer < InfluenceLayer::_COUNT && _team < m_Settings.teamCount); // Error: Invalid layer or team.
+
+		return m_Layers[_team * LAYER_COUNT + static_cast<uint32_t>(_layer)].data();
+	}
+
+	float InfluenceMap::Sample(InfluenceLayer _layer, uint8_t _team, float _x, float _y) const
+	{
+		const float cellX = floorf((_x - m_Settings.originX) / m_Settings.cellSize);
+		const float cellY = floorf((_y - m_Settings.originY) / m_Settings.cellSize);
+
+		if (!(cellX >= 0.0f && cellY >= 0.0f && cellX < m_Settings.width && cellY < m_Settings.height))
+			return 0.0f;
+
+		return GetLayer(_layer, _team)[static_cast<uint32_t>(cellY) * m_Settings.width + static_cast<uint32_t>(cellX)];
+	}
+
+	void InfluenceMap::Combine(InfluenceOperation _operation, const float* _a, const float* _b, float* _out, uint32_t _count)
+	{
+		uint32_t i = 0;
+
+		switch (_operation)
+		{
+		case InfluenceOperation::SUM:
+			for (; i + Simd::WIDTH <= _count; i += Simd::WIDTH)
+				Simd::Store(_out + i, Simd::Add(Simd::Load(_a + i), Simd::Load(_b + i)));
+			for (; i < _count; ++i)
+				_out[i] = _a[i] + _b[i];
+			break;
+		case InfluenceOperation::MIN:
+			for (; i + Simd::WIDTH <= _count; i += Simd::WIDTH)
+				Simd::Store(_out + i, Simd::Min(Simd::Load(_a + i), Simd::Load(_b + i)));
+			for (; i < _count; ++i)
+				_out[i] = std::min(_a[i], _b[i]);
+			break;
+		case InfluenceOperation::MAX:
+			for (; i + Simd::WIDTH <= _count; i += Simd::WIDTH)
+				Simd::Store(_out + i, Simd::Max(Simd::Load(_a + i), Simd::Load(_b + i)));
+			for (; i < _count; ++i)
+				_out[i] = std::max(_a[i], _b[i]);
+			break;
+		default:
+			assert(false); // Error: Unknown operation.
+			break;
+		}
+	}
+
+	uint32_t InfluenceMap::GetWidth() const
+	{
+		return m_Settings.width;
+	}
+
+	uint32_t InfluenceMap::GetHeight() const
+	{
+		return m_Settings.height;
+	}
+
+	const InfluenceSettings& InfluenceMap::GetSettings() const
+	{
+		return m_Settings;
+	}
+
+	uint32_t InfluenceMap::GetLastTileCount() const
+	{
+		return m_LastTileCount;
+	}
+}
@@ -0,0 +1,176 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: InfluenceMap.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Coarse grids of how strongly each team holds every part of the map, for AI that needs
+		to reason about threat and territory rather than single units. Every team has a stack of layers:
+		the raw presence stamped by its units, that presence spread out by a few passes of blur, the
+		sum of every enemy's spread presence, and where the two overlap. The grid is cut into tiles and
+		only tiles that a changed unit touches are recomputed, so a quiet map costs almost nothing.
+		Every tile is computed the same way whether one changed or the whole map did, so incremental
+		updates give exactly the same result as a full rebuild. The world doesn't keep one. Users size a
+		map to cover their map and teams, and update it after the world ticks.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include "../Simulation/Units.h"
+#include "../Threading/JobSystem.h"
+
+namespace OC
+{
+	enum class InfluenceLayer : uint8_t
+	{
+		PRESENCE,	// The team's units, stamped with a linear falloff.
+		INFLUENCE,	// PRESENCE spread out by blurring.
+		THREAT,		// The INFLUENCE of every other team, summed.
+		TENSION,	// The lesser of INFLUENCE and THREAT. High where both sides are strong: the front.
+		_COUNT
+	};
+
+	enum class InfluenceOperation : uint8_t
+	{
+		SUM,	// a + b.
+		MIN,	// The lesser of a and b.
+		MAX		// The greater of a and b.
+	};
+
+	struct InfluenceSettings
+	{
+		float originX = -2048.0f, originY = -2048.0f; // The world position of the grid's top-left corner.
+		float cellSize = 32.0f; // The width and height of a cell, in world units.
+		uint32_t width = 128, height = 128; // The size of the grid, in cells. Multiples of TILE_SIZE.
+		uint32_t teamCount = 2; // Teams tracked. Units of other teams are ignored.
+		uint32_t stampRadius = 4; // How far a unit's presence reaches, in cells.
+		float strengthPerHealth = 0.01f; // Presence at a unit's own cell, per point of its health.
+		uint32_t blurPasses = 2; // How many times presence is spread. At most TILE_SIZE.
+		float spread = 0.25f; // The share of a cell passed to each neighbour per pass. Below 0.5.
+	};
+
+	class InfluenceMap
+	{
+	private:
+		// The cell and strength a unit was last stamped with.
+		struct Stamp
+		{
+			int32_t x, y; // The cell.
+			float strength; // Presence at the cell. 0 if the unit isn't stamped.
+			uint8_t team; // The team stamped.
+		};
+
+		InfluenceSettings m_Settings; // Tuning values.
+		uint32_t m_TilesX, m_TilesY; // The size of the grid, in tiles.
+		std::vector<std::vector<float>> m_Layers; // Every team's layers, team by team, row by row.
+		std::vector<float> m_Kernel; // The falloff of a stamp, (2 * stampRadius + 1) squared.
+		std::vector<Stamp> m_Stamps; // How each unit was last stamped.
+		std::vector<std::vector<UnitId>> m_TeamUnits; // Each team's stamped units, in id order.
+		std::vector<uint8_t> m_DirtyPresence; // Tiles of each team whose presence must be stamped again.
+		std::vector<uint8_t> m_DirtyInfluence; // Tiles of each team whose influence must be spread again.
+		std::vector<uint8_t> m_DirtyCombined; // Tiles whose threat and tension must be combined again.
+		std::vector<uint32_t> m_Work; // Tiles to spread this update, as team * tile count + tile.
+		bool m_Invalid; // If everything must be rebuilt on the next update.
+		uint32_t m_LastTileCount; // Tiles spread during the last update.
+
+		// Description: Returns a layer for writing.
+		// Parameters: 
+		//    InfluenceLayer _layer, the layer.
+		//    uint32_t _team, the team.
+		// Returns: The first cell of the layer.
+		float* Layer(InfluenceLayer _layer, uint32_t _team);
+
+		// Description: Marks the tiles a stamp covers as needing new presence.
+		// Parameters: 
+		//    const Stamp& _stamp, the stamp.
+		void MarkStamp(const Stamp& _stamp);
+
+		// Description: Clears one team's dirty tiles and stamps every unit overlapping them again.
+		// Parameters: 
+		//    uint32_t _team, the team.
+		void StampTeam(uint32_t _team);
+
+		// Description: Spreads one tile's presence into its influence.
+		// Parameters: 
+		//    uint32_t _team, the team.
+		//    uint32_t _tile, the tile.
+		//    std::vector<float>& _scratch, room to blur in. Grown as needed.
+		void SpreadTile(uint32_t _team, uint32_t _tile, std::vector<float>& _scratch);
+
+		// Description: Combines every team's influence into threat and tension for one tile.
+		// Parameters: 
+		//    uint32_t _tile, the tile.
+		void CombineTile(uint32_t _tile);
+
+	public:
+		static constexpr uint32_t TILE_SIZE = 16; // The width and height of a tile, in cells.
+
+		// Description: Constructs an empty influence map.
+		// Parameters: 
+		//    const InfluenceSettings& _settings, tuning values.
+		explicit InfluenceMap(const InfluenceSettings& _settings = InfluenceSettings());
+
+		// Description: InfluenceMap's cannot be created from other InfluenceMap's.
+		InfluenceMap(const InfluenceMap& _map) = delete;
+
+		// Description: InfluenceMap's cannot be assigned to other InfluenceMap's.
+		void operator=(const InfluenceMap& _map) = delete;
+
+		// Description: Brings every layer up to date with the units, recomputing only the tiles around
+		//    units that moved to another cell, changed health, died or appeared.
+		// Parameters: 
+		//    const UnitData& _units, every unit in the world.
+		//    JobSystem* _jobs, stamps teams and spreads tiles in parallel if not nullptr. The result is
+		//        the same either way.
+		void Update(const UnitData& _units, JobSystem* _jobs = nullptr);
+
+		// Description: Makes the next update rebuild everything. Call when the units were replaced
+		//    rather than changed, like after loading a save.
+		void Invalidate();
+
+		// Description: Returns a layer.
+		// Parameters: 
+		//    InfluenceLayer _layer, the layer.
+		//    uint8_t _team, the team.
+		// Returns: GetWidth() * GetHeight() cells, row by row.
+		const float* GetLayer(InfluenceLayer _layer, uint8_t _team) const;
+
+		// Description: Returns the value of a layer at a world position.
+		// Parameters: 
+		//    InfluenceLayer _layer, the layer.
+		//    uint8_t _team, the team.
+		//    float _x, the x position.
+		//    float _y, the y position.
+		// Returns: The value of the cell containing the position, or 0 outside the grid.
+		float Sample(InfluenceLayer _layer, uint8_t _team, float _x, float _y) const;
+
+		// Description: Combines two grids cell by cell. Used to build the combined layers, and for
+		//    combinations of the caller's own, like the threat to a group of allied teams.
+		// Parameters: 
+		//    InfluenceOperation _operation, how cells are combined.
+		//    const float* _a, the first grid.
+		//    const float* _b, the second grid.
+		//    float* _out, receives the result. May be _a or _b.
+		//    uint32_t _count, the number of cells.
+		static void Combine(InfluenceOperation _operation, const float* _a, const float* _b, float* _out, uint32_t _count);
+
+		// Description: Returns the width of the grid.
+		// Returns: The width, in cells.
+		uint32_t GetWidth() const;
+
+		// Description: Returns the height of the grid.
+		// Returns: The height, in cells.
+		uint32_t GetHeight() const;
+
+		// Description: Returns the tuning values.
+		// Returns: The settings.
+		const InfluenceSettings& GetSettings() const;
+
+		// Description: Returns the number of tiles spread during the last update, across every team.
+		// Returns: The number of tiles.
+		uint32_t GetLastTileCount() const;
+	};
+}
@@ -0,0 +1,527 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: AudioMixer.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <assert.h>
+#include <chrono>
+#include "AudioMixer.h"
+#include "../Math/Simd.h"
+
+namespace OC
+{
+	// private
+
+	void AudioMixer::ThreadLoop(AudioOutputInterface* _output)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		const auto blockDuration = std::chrono::duration_cast<Clock::duration>(
+			std::chrono::duration<double>(static_cast<double>(m_Settings.blockFrames) / m_Settings.sampleRate));
+
+		std::vector<float> block(m_Settings.blockFrames * 2);
+		Clock::time_point nextBlock = Clock::now();
+
+		while (m_Running.load(std::memory_order_acquire))
+		{
+			MixBlock(block.data());
+			_output->Write(block.data(), m_Settings.blockFrames);
+
+			// Outputs that don't block, like files, are fed at the rate a sound card would take the mix.
+			if (!_output->IsPaced())
+			{
+				nextBlock += blockDuration;
+				Clock::time_point now = Clock::now();
+
+				if (nextBlock > now)
+					std::this_thread::sleep_until(nextBlock);
+				else if (now - nextBlock > blockDuration * 4)
+					nextBlock = now; // Fell far behind. Don't rush to catch up.
+			}
+		}
+	}
+
+	bool AudioMixer::Send(const Command& _command)
+	{
+		if (m_Commands.Push(_command))
+			return true;
+
+		++m_DroppedCommands;
+		return false;
+	}
+
+	void AudioMixer::ApplyCommands()
+	{
+		Command command;
+
+		while (m_Commands.Pop(command))
+		{
+			switch (command.type)
+			{
+			case CommandType::PLAY:
+			{
+				if (m_VoiceCount == m_Settings.maxVoices)
+				{
+					m_DroppedVoices.fetch_add(1, std::memory_order_relaxed);
+					if (m_DroppedVoicesCounter)
+						m_DroppedVoicesCounter->Add();
+					break;
+				}
+
+				uint32_t index = m_VoiceCount++;
+				m_VoiceIds[index] = command.voice;
+				m_VoiceSounds[index] = command.sound;
+				m_VoiceFrames[index] = 0;
+				m_VoiceLooping[index] = command.looping ? 1 : 0;
+				m_VoiceReal[index] = 0;
+				m_VoiceX[index] = command.x;
+				m_VoiceY[index] = command.y;
+				m_VoicePlaced[index] = command.placed ? 1.0f : 0.0f;
+				m_VoiceGain[index] = command.gain;
+				m_VoicePrevLeft[index] = -1.0f;
+				m_VoicePrevRight[index] = -1.0f;
+				m_VoiceIndices[command.voice] = index;
+				break;
+			}
+
+			case CommandType::STOP:
+			{
+				auto found = m_VoiceIndices.find(command.voice);
+				if (found != m_VoiceIndices.end())
+					RemoveVoice(found->second);
+				break;
+			}
+
+			case CommandType::MOVE:
+			{
+				auto found = m_VoiceIndices.find(command.voice);
+				if (found != m_VoiceIndices.end())
+				{
+					m_VoiceX[found->second] = command.x;
+					m_VoiceY[found->second] = command.y;
+				}
+				break;
+			}
+
+			case CommandType::LISTENER:
+				m_ListenerX = command.x;
+				m_ListenerY = command.y;
+				break;
+
+			case CommandType::MASTER_GAIN:
+				m_MasterGain = command.gain;
+				break;
+			}
+		}
+	}
+
+	void AudioMixer::RemoveVoice(uint32_t _index)
+	{
+		assert(_index < m_VoiceCount); // Error: Invalid voice index.
+
+		m_VoiceIndices.erase(m_VoiceIds[_index]);
+
+		uint32_t last = --m_VoiceCount;
+		if (_index == last)
+			return;
+
+		m_VoiceIds[_index] = m_VoiceIds[last];
+		m_VoiceSounds[_index] = m_VoiceSounds[last];
+		m_VoiceFrames[_index] = m_VoiceFrames[last];
+		m_VoiceLooping[_index] = m_VoiceLooping[last];
+		m_VoiceReal[_index] = m_VoiceReal[last];
+		m_VoiceX[_index] = m_VoiceX[last];
+		m_VoiceY[_index] = m_VoiceY[last];
+		m_VoicePlaced[_index] = m_VoicePlaced[last];
+		m_VoiceGain[_index] = m_VoiceGain[last];
+		m_VoicePrevLeft[_index] = m_VoicePrevLeft[last];
+		m_VoicePrevRight[_index] = m_VoicePrevRight[last];
+		m_VoiceIndices[m_VoiceIds[_index]] = _index;
+	}
+
+	void AudioMixer::UpdateGains()
+	{
+		using namespace Simd;
+
+		const Float4 listenerX = Set(m_ListenerX);
+		const Float4 listenerY = Set(m_ListenerY);
+		const Float4 inverseMaxDistance = Set(1.0f / m_Settings.maxDistance);
+		const Float4 inversePanDistance = Set(1.0f / m_Settings.panDistance);
+		const Float4 zero = Set(0.0f);
+		const Float4 half = Set(0.5f);
+		const Float4 one = Set(1.0f);
+		const Float4 minusOne = Set(-1.0f);
+
+		// The arrays are padded to a whole number of lanes. Lanes past the last voice are ignored.
+		for (uint32_t i = 0; i < m_VoiceCount; i += WIDTH)
+		{
+			// Voices that aren't placed act as if they are at the listener: no attenuation, no pan.
+			Float4 placed = Load(&m_VoicePlaced[i]);
+			Float4 dx = Mul(Sub(Load(&m_VoiceX[i]), listenerX), placed);
+			Float4 dy = Mul(Sub(Load(&m_VoiceY[i]), listenerY), placed);
+			Float4 distance = Sqrt(Add(Mul(dx, dx), Mul(dy, dy)));
+
+			// Falls off with the square of the distance, reaching silence at maxDistance.
+			Float4 attenuation = Max(zero, Sub(one, Mul(distance, inverseMaxDistance)));
+			Float4 loudness = Mul(Load(&m_VoiceGain[i]), Mul(attenuation, attenuation));
+
+			// Constant power panning keeps a voice equally loud as it crosses the screen.
+			Float4 pan = Min(one, Max(minusOne, Mul(dx, inversePanDistance)));
+			Float4 left = Mul(loudness, Sqrt(Sub(half, Mul(half, pan))));
+			Float4 right = Mul(loudness, Sqrt(Add(half, Mul(half, pan))));
+
+			Store(&m_VoiceLoudness[i], loudness);
+			Store(&m_VoiceLeft[i], left);
+			Store(&m_VoiceRight[i], right);
+		}
+	}
+
+	void AudioMixer::MixVoice(uint32_t _index, bool _fadeOut)
+	{
+		using namespace Simd;
+
+		static const float RAMP[WIDTH] = { 0.0f, 1.0f, 2.0f, 3.0f }; // Frame offsets within a Float4.
+
+		const std::vector<float>& sound = m_Sounds[m_VoiceSounds[_index]];
+		const uint32_t length = static_cast<uint32_t>(sound.size());
+		const uint32_t blockFrames = m_Settings.blockFrames;
+
+		float targetLeft = _fadeOut ? 0.0f : m_VoiceLeft[_index];
+		float targetRight = _fadeOut ? 0.0f : m_VoiceRight[_index];
+		float startLeft = m_VoicePrevLeft[_index] < 0.0f ? targetLeft : m_VoicePrevLeft[_index];
+		float startRight = m_VoicePrevRight[_index] < 0.0f ? targetRight : m_VoicePrevRight[_index];
+
+		// Gains ramp linearly across the block so changes don't click.
+		const float stepLeft = (targetLeft - startLeft) / blockFrames;
+		const float stepRight = (targetRight - startRight) / blockFrames;
+		const Float4 ramp = Simd::Load(RAMP);
+		const Float4 stepLeft4 = Set(stepLeft * WIDTH);
+		const Float4 stepRight4 = Set(stepRight * WIDTH);
+
+		uint32_t frame = m_VoiceFrames[_index];
+		uint32_t written = 0;
+
+		while (written < blockFrames)
+		{
+			uint32_t count = std::min(blockFrames - written, length - frame);
+			const float* source = &sound[frame];
+			float* left = &m_Left[written];
+			float* right = &m_Right[written];
+
+			float gainLeft = startLeft + stepLeft * (written + 1);
+			float gainRight = startRight + stepRight * (written + 1);
+			Float4 gainLeft4 = Add(Set(gainLeft), Mul(Set(stepLeft), ramp));
+			Float4 gainRight4 = Add(Set(gainRight), Mul(Set(stepRight), ramp));
+
+			uint32_t i = 0;
+			for (; i + WIDTH <= count; i += WIDTH)
+			{
+				Float4 sample = Simd::Load(source + i);
+				Store(left + i, Add(Simd::Load(left + i), Mul(sample, gainLeft4)));
+				Store(right + i, Add(Simd::Load(right + i), Mul(sample, gainRight4)));
+				gainLeft4 = Add(gainLeft4, stepLeft4);
+				gainRight4 = Add(gainRight4, stepRight4);
+			}
+
+			for (; i < count; ++i)
+			{
+				left[i] += source[i] * (gainLeft + stepLeft * i);
+				right[i] += source[i] * (gainRight + stepRight * i);
+			}
+
+			written += count;
+			frame += count;
+
+			if (frame == length)
+			{
+				if (!m_VoiceLooping[_index])
+					break;
+
+				frame = 0;
+			}
+		}
+
+		m_VoicePrevLeft[_index] = targetLeft;
+		m_VoicePrevRight[_index] = targetRight;
+	}
+
+	void AudioMixer::AdvanceVoices()
+	{
+		const uint32_t blockFrames = m_Settings.blockFrames;
+
+		// Backwards, so removing a voice only moves voices that were already advanced.
+		for (uint32_t i = m_VoiceCount; i-- > 0;)
+		{
+			uint32_t length = static_cast<uint32_t>(m_Sounds[m_VoiceSounds[i]].size());
+			uint64_t frame = static_cast<uint64_t>(m_VoiceFrames[i]) + blockFrames;
+
+			if (frame < length)
+				m_VoiceFrames[i] = static_cast<uint32_t>(frame);
+			else if (m_VoiceLooping[i])
+				m_VoiceFrames[i] = static_cast<uint32_t>(frame % length);
+			else
+				RemoveVoice(i);
+		}
+	}
+
+	// public
+
+	AudioMixer::AudioMixer(const MixerSettings& _settings) :
+		m_Settings(_settings),
+		m_Sounds(),
+		m_Commands(_settings.commandCapacity),
+		m_NextVoice(1),
+		m_DroppedCommands(0),
+		m_VoiceCount(0),
+		m_VoiceIds(), m_VoiceSounds(), m_VoiceFrames(), m_VoiceLooping(), m_VoiceReal(),
+		m_VoiceX(), m_VoiceY(), m_VoicePlaced(), m_VoiceGain(), m_VoiceLoudness(),
+		m_VoiceLeft(), m_VoiceRight(), m_VoicePrevLeft(), m_VoicePrevRight(),
+		m_VoiceIndices(),
+		m_Candidates(),
+		m_Left(), m_Right(),
+		m_ListenerX(0.0f), m_ListenerY(0.0f),
+		m_MasterGain(1.0f),
+		m_Thread(),
+		m_Running(false),
+		m_RealVoiceCount(0),
+		m_VirtualVoiceCount(0),
+		m_DroppedVoices(0),
+		m_MixTimes(nullptr),
+		m_RealVoicesGauge(nullptr),
+		m_VirtualVoicesGauge(nullptr),
+		m_DroppedVoicesCounter(nullptr)
+	{
+		assert(m_Settings.sampleRate > 0 && m_Settings.blockFrames > 0); // Error: Invalid mixer settings.
+		assert(m_Settings.maxVoices > 0 && m_Settings.maxDistance > 0.0f && m_Settings.panDistance > 0.0f); // Error: Invalid mixer settings.
+
+		const uint32_t capacity = (m_Settings.maxVoices + Simd::WIDTH - 1) / Simd::WIDTH * Simd::WIDTH;
+
+		// Padding lanes read as silent, unplaced voices.
+		m_VoiceIds.resize(capacity);
+		m_VoiceSounds.resize(capacity);
+		m_VoiceFrames.resize(capacity);
+		m_VoiceLooping.resize(capacity);
+		m_VoiceReal.resize(capacity);
+		m_VoiceX.resize(capacity);
+		m_VoiceY.resize(capacity);
+		m_VoicePlaced.resize(capacity);
+		m_VoiceGain.resize(capacity);
+		m_VoiceLoudness.resize(capacity);
+		m_VoiceLeft.resize(capacity);
+		m_VoiceRight.resize(capacity);
+		m_VoicePrevLeft.resize(capacity);
+		m_VoicePrevRight.resize(capacity);
+		m_VoiceIndices.reserve(capacity);
+		m_Candidates.reserve(capacity);
+		m_Left.resize(m_Settings.blockFrames);
+		m_Right.resize(m_Settings.blockFrames);
+	}
+
+	AudioMixer::~AudioMixer()
+	{
+		Stop();
+	}
+
+	SoundId AudioMixer::AddSound(std::vector<float>&& _samples)
+	{
+		assert(!m_Running); // Error: Sounds can't be added while the mixer is running.
+
+		if (_samples.empty())
+			return INVALID_SOUND;
+
+		m_Sounds.push_back(std::move(_samples));
+		return static_cast<SoundId>(m_Sounds.size() - 1);
+	}
+
+	void AudioMixer::Start(AudioOutputInterface& _output)
+	{
+		assert(!m_Running); // Error: The mixer is already running.
+
+		m_Running.store(true, std::memory_order_release);
+		m_Thread = std::thread(&AudioMixer::ThreadLoop, this, &_output);
+	}
+
+	void AudioMixer::Stop()
+	{
+		if (!m_Running)
+			return;
+
+		m_Running.store(false, std::memory_order_release);
+		m_Thread.join();
+	}
+
+	void AudioMixer::MixBlock(float* _outSamples)
+	{
+		using namespace Simd;
+
+		auto start = std::chrono::steady_clock::now();
+
+		ApplyCommands();
+		UpdateGains();
+
+		// Only the loudest audible voices are mixed. The rest are virtual.
+		m_Candidates.clear();
+		for (uint32_t i = 0; i < m_VoiceCount; ++i)
+		{
+			if (m_VoiceLoudness[i] >= m_Settings.audibleGain)
+				m_Candidates.push_back(i);
+		}
+
+		if (m_Candidates.size() > m_Settings.maxRealVoices)
+		{
+			std::nth_element(m_Candidates.begin(), m_Candidates.begin() + m_Settings.maxRealVoices, m_Candidates.end(),
+				[this](uint32_t _a, uint32_t _b) { return m_VoiceLoudness[_a] > m_VoiceLoudness[_b]; });
+
+			m_Candidates.resize(m_Settings.maxRealVoices);
+		}
+
+		std::fill(m_Left.begin(), m_Left.end(), 0.0f);
+		std::fill(m_Right.begin(), m_Right.end(), 0.0f);
+
+		// 2 marks voices that were real last block. Any still marked after mixing the real voices
+		// just turned virtual, and fade out over this block. Virtual voices fade back in from silence.
+		for (uint32_t i = 0; i < m_VoiceCount; ++i)
+			m_VoiceReal[i] = m_VoiceReal[i] ? 2 : 0;
+
+		for (uint32_t index : m_Candidates)
+		{
+			MixVoice(index, false);
+			m_VoiceReal[index] = 1;
+		}
+
+		for (uint32_t i = 0; i < m_VoiceCount; ++i)
+		{
+			if (m_VoiceReal[i] == 2)
+			{
+				MixVoice(i, true);
+				m_VoiceReal[i] = 0;
+			}
+			else if (m_VoiceReal[i] == 0)
+			{
+				m_VoicePrevLeft[i] = 0.0f;
+				m_VoicePrevRight[i] = 0.0f;
+			}
+		}
+
+		// Apply the master volume, clip, and interleave.
+		const Float4 masterGain = Set(m_MasterGain);
+		const Float4 one = Set(1.0f);
+		const Float4 minusOne = Set(-1.0f);
+		const uint32_t blockFrames = m_Settings.blockFrames;
+
+		uint32_t frame = 0;
+		for (; frame + WIDTH <= blockFrames; frame += WIDTH)
+		{
+			Store(&m_Left[frame], Min(one, Max(minusOne, Mul(Simd::Load(&m_Left[frame]), masterGain))));
+			Store(&m_Right[frame], Min(one, Max(minusOne, Mul(Simd::Load(&m_Right[frame]), masterGain))));
+		}
+
+		for (; frame < blockFrames; ++frame)
+		{
+			m_Left[frame] = std::min(1.0f, std::max(-1.0f, m_Left[frame] * m_MasterGain));
+			m_Right[frame] = std::min(1.0f, std::max(-1.0f, m_Right[frame] * m_MasterGain));
+		}
+
+		for (frame = 0; frame < blockFrames; ++frame)
+		{
+			_outSamples[frame * 2] = m_Left[frame];
+			_outSamples[frame * 2 + 1] = m_Right[frame];
+		}
+
+		uint32_t realCount = static_cast<uint32_t>(m_Candidates.size());
+		m_RealVoiceCount.store(realCount, std::memory_order_relaxed);
+		m_VirtualVoiceCount.store(m_VoiceCount - realCount, std::memory_order_relaxed);
+
+		AdvanceVoices();
+
+		if (m_MixTimes)
+		{
+			auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+			m_MixTimes->Record(static_cast<uint64_t>(elapsed.count()));
+			m_RealVoicesGauge->Set(realCount);
+			m_VirtualVoicesGauge->Set(m_VirtualVoiceCount.load(std::memory_order_relaxed));
+		}
+	}
+
+	VoiceId AudioMixer::Play(SoundId _sound, float _gain, bool _looping)
+	{
+		assert(_sound < m_Sounds.size()); // Error: Invalid sound.
+
+		VoiceId voice = m_NextVoice;
+		if (!Send(Command{ CommandType::PLAY, false, _looping, voice, _sound, 0.0f, 0.0f, _gain }))
+			return INVALID_VOICE;
+
+		m_NextVoice = m_NextVoice + 1 == INVALID_VOICE ? 1 : m_NextVoice + 1;
+		return voice;
+	}
+
+	VoiceId AudioMixer::PlayAt(SoundId _sound, float _x, float _y, float _gain, bool _looping)
+	{
+		assert(_sound < m_Sounds.size()); // Error: Invalid sound.
+
+		VoiceId voice = m_NextVoice;
+		if (!Send(Command{ CommandType::PLAY, true, _looping, voice, _sound, _x, _y, _gain }))
+			return INVALID_VOICE;
+
+		m_NextVoice = m_NextVoice + 1 == INVALID_VOICE ? 1 : m_NextVoice + 1;
+		return voice;
+	}
+
+	void AudioMixer::StopVoice(VoiceId _voice)
+	{
+		if (_voice != INVALID_VOICE)
+			Send(Command{ CommandType::STOP, false, false, _voice, INVALID_SOUND, 0.0f, 0.0f, 0.0f });
+	}
+
+	void AudioMixer::MoveVoice(VoiceId _voice, float _x, float _y)
+	{
+		if (_voice != INVALID_VOICE)
+			Send(Command{ CommandType::MOVE, false, false, _voice, INVALID_SOUND, _x, _y, 0.0f });
+	}
+
+	void AudioMixer::SetListener(float _x, float _y)
+	{
+		Send(Command{ CommandType::LISTENER, false, false, INVALID_VOICE, INVALID_SOUND, _x, _y, 0.0f });
+	}
+
+	void AudioMixer::SetMasterGain(float _gain)
+	{
+		Send(Command{ CommandType::MASTER_GAIN, false, false, INVALID_VOICE, INVALID_SOUND, 0.0f, 0.0f, _gain });
+	}
+
+	void AudioMixer::RegisterMetrics(MetricsRegistry& _registry)
+	{
+		assert(!m_Running); // Error: Metrics must be registered before the mixer starts.
+
+		m_MixTimes = &_registry.GetHistogram("audio_mix_microseconds", "Time taken to mix one block.");
+		m_RealVoicesGauge = &_registry.GetGauge("audio_voices_real", "Voices mixed in the last block.");
+		m_VirtualVoicesGauge = &_registry.GetGauge("audio_voices_virtual", "Voices skipped in the last block.");
+		m_DroppedVoicesCounter = &_registry.GetCounter("audio_voices_dropped_total", "Voices not started because every voice was in use.");
+	}
+
+	uint32_t AudioMixer::GetRealVoiceCount() const
+	{
+		return m_RealVoiceCount.load(std::memory_order_relaxed);
+	}
+
+	uint32_t AudioMixer::GetVirtualVoiceCount() const
+	{
+		return m_VirtualVoiceCount.load(std::memory_order_relaxed);
+	}
+
+	uint32_t AudioMixer::GetDroppedCommandCount() const
+	{
+		return m_DroppedCommands;
+	}
+
+	const MixerSettings& AudioMixer::GetSettings() const
+	{
+		return m_Settings;
+	}
+}
@@ -0,0 +1,236 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: AudioMixer.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: A software mixer for hundreds of voices. Voices are mono float sounds, optionally placed
+		in the world, panned and attenuated around a listener. Only the loudest voices are mixed; the
+		rest are virtual and only advance their playback position, so a battle with a thousand guns
+		firing costs little more than one with a hundred. Gains and mixing run over 4 voices or samples
+		at a time. The mixer runs on a thread of its own and takes commands from the game thread through
+		a lock-free queue, so playing a sound never waits on mixing.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "AudioOutputInterface.h"
+#include "../Metrics/Metrics.h"
+#include "../Threading/SpscQueue.h"
+
+namespace OC
+{
+	typedef uint32_t SoundId; // Identifies a sound added to the mixer.
+	typedef uint32_t VoiceId; // Identifies one playback of a sound.
+
+	constexpr SoundId INVALID_SOUND = 0xFFFFFFFF; // Returned when a sound couldn't be added.
+	constexpr VoiceId INVALID_VOICE = 0; // Returned when a voice couldn't be queued.
+
+	struct MixerSettings
+	{
+		uint32_t sampleRate = 48000; // Frames per second. Sounds must be recorded at this rate.
+		uint32_t blockFrames = 256; // Frames mixed at a time. Smaller reacts faster, larger costs less.
+		uint32_t maxVoices = 1024; // The most voices playing at once, real or virtual.
+		uint32_t maxRealVoices = 96; // The most voices mixed at once. The quietest of the rest are virtual.
+		float audibleGain = 0.001f; // Voices quieter than this (-60 dB) are virtual.
+		float maxDistance = 1500.0f; // World distance at which placed voices fall silent.
+		float panDistance = 600.0f; // World distance to the side at which placed voices are fully panned.
+		uint32_t commandCapacity = 4096; // The most commands waiting for the mixer.
+	};
+
+	class AudioMixer
+	{
+	private:
+		enum class CommandType : uint8_t
+		{
+			PLAY,
+			STOP,
+			MOVE,
+			LISTENER,
+			MASTER_GAIN
+		};
+
+		struct Command
+		{
+			CommandType type; // What to do.
+			bool placed; // If the voice is placed in the world. PLAY only.
+			bool looping; // If the voice restarts when the sound ends. PLAY only.
+			VoiceId voice; // The voice to change.
+			SoundId sound; // The sound to play. PLAY only.
+			float x, y; // A world position.
+			float gain; // A volume multiplier.
+		};
+
+		MixerSettings m_Settings; // Tuning values.
+		std::vector<std::vector<float>> m_Sounds; // Every sound's samples. Fixed once the mixer starts.
+
+		// Game thread.
+		SpscQueue<Command> m_Commands; // Commands waiting for the mixer.
+		VoiceId m_NextVoice; // The id the next voice is given.
+		uint32_t m_DroppedCommands; // Commands lost because the queue was full.
+
+		// Mixer thread. Voices are stored as arrays sized for maxVoices, rounded up to a whole number of
+		// SIMD lanes so gains can be computed 4 voices at a time without a scalar tail.
+		uint32_t m_VoiceCount; // The number of voices playing.
+		std::vector<VoiceId> m_VoiceIds; // The id of every voice.
+		std::vector<SoundId> m_VoiceSounds; // The sound each voice plays.
+		std::vector<uint32_t> m_VoiceFrames; // The next frame of its sound each voice plays.
+		std::vector<uint8_t> m_VoiceLooping; // If each voice restarts when its sound ends.
+		std::vector<uint8_t> m_VoiceReal; // If each voice was mixed in the last block.
+		std::vector<float> m_VoiceX, m_VoiceY; // The world position of each voice.
+		std::vector<float> m_VoicePlaced; // 1 if the voice is placed in the world, 0 if it plays as is.
+		std::vector<float> m_VoiceGain; // The volume of each voice before attenuation.
+		std::vector<float> m_VoiceLoudness; // The volume of each voice after attenuation.
+		std::vector<float> m_VoiceLeft, m_VoiceRight; // Channel gains each voice is ramping to.
+		std::vector<float> m_VoicePrevLeft, m_VoicePrevRight; // Channel gains each voice was mixed with. Negative for new voices.
+		std::unordered_map<VoiceId, uint32_t> m_VoiceIndices; // The array index of every voice.
+		std::vector<uint32_t> m_Candidates; // Scratch for choosing the real voices.
+		std::vector<float> m_Left, m_Right; // The block being mixed, one array per channel.
+		float m_ListenerX, m_ListenerY; // Where the listener is in the world.
+		float m_MasterGain; // The volume of the whole mix.
+
+		// Either thread.
+		std::thread m_Thread; // Mixes while started.
+		std::atomic<bool> m_Running; // If the mixer's thread is running.
+		std::atomic<uint32_t> m_RealVoiceCount; // Voices mixed in the last block.
+		std::atomic<uint32_t> m_VirtualVoiceCount; // Voices skipped in the last block.
+		std::atomic<uint32_t> m_DroppedVoices; // Voices not started because every voice was in use.
+		Histogram* m_MixTimes; // How long each block took to mix, in microseconds. nullptr until metrics are registered.
+		Gauge* m_RealVoicesGauge; // Mirrors m_RealVoiceCount.
+		Gauge* m_VirtualVoicesGauge; // Mirrors m_VirtualVoiceCount.
+		Counter* m_DroppedVoicesCounter; // Counts voices that couldn't start.
+
+		// Description: Mixes blocks and hands them to the output until stopped.
+		// Parameters: 
+		//    AudioOutputInterface* _output, where the mix goes.
+		void ThreadLoop(AudioOutputInterface* _output);
+
+		// Description: Queues a command for the mixer.
+		// Parameters: 
+		//    const Command& _command, the command.
+		// Returns: false, if the queue was full and the command was dropped.
+		bool Send(const Command& _command);
+
+		// Description: Applies every queued command.
+		void ApplyCommands();
+
+		// Description: Removes a voice. The last voice takes its place.
+		// Parameters: 
+		//    uint32_t _index, the array index of the voice.
+		void RemoveVoice(uint32_t _index);
+
+		// Description: Works out every voice's loudness and channel gains from the listener.
+		void UpdateGains();
+
+		// Description: Mixes one voice into the block, ramping from its previous gains to its new ones.
+		// Parameters: 
+		//    uint32_t _index, the array index of the voice.
+		//    bool _fadeOut, ramps to silence instead, for voices that just became virtual.
+		void MixVoice(uint32_t _index, bool _fadeOut);
+
+		// Description: Advances every voice by a block and removes the ones that finished.
+		void AdvanceVoices();
+
+	public:
+		// Description: Constructs a mixer with no sounds or voices.
+		// Parameters: 
+		//    const MixerSettings& _settings, tuning values.
+		explicit AudioMixer(const MixerSettings& _settings = MixerSettings());
+
+		// Description: AudioMixer's cannot be created from other AudioMixer's.
+		AudioMixer(const AudioMixer& _mixer) = delete;
+
+		// Description: Stops the mixer.
+		~AudioMixer();
+
+		// Description: AudioMixer's cannot be assigned to other AudioMixer's.
+		void operator=(const AudioMixer& _mixer) = delete;
+
+		// Description: Adds a sound. Only allowed while the mixer is stopped.
+		// Parameters: 
+		//    std::vector<float>&& _samples, mono samples from -1 to 1 at the mixer's sample rate. Moved from.
+		// Returns: The id of the sound, or INVALID_SOUND if it has no samples.
+		SoundId AddSound(std::vector<float>&& _samples);
+
+		// Description: Starts mixing on the mixer's thread.
+		// Parameters: 
+		//    AudioOutputInterface& _output, where the mix goes. Must outlive the mixer or the next Stop.
+		void Start(AudioOutputInterface& _output);
+
+		// Description: Stops mixing and waits for the thread to exit. Voices keep their place.
+		void Stop();
+
+		// Description: Mixes one block on the calling thread. Only allowed while the mixer is stopped.
+		// Parameters: 
+		//    float* _outSamples, receives blockFrames interleaved stereo frames.
+		void MixBlock(float* _outSamples);
+
+		// Description: Plays a sound as is, for interface sounds and unit responses. Game thread only.
+		// Parameters: 
+		//    SoundId _sound, the sound to play.
+		//    float _gain, the volume.
+		//    bool _looping, if the sound restarts when it ends, until stopped.
+		// Returns: The voice, or INVALID_VOICE if the command queue was full.
+		VoiceId Play(SoundId _sound, float _gain = 1.0f, bool _looping = false);
+
+		// Description: Plays a sound from a place in the world. Game thread only.
+		// Parameters: 
+		//    SoundId _sound, the sound to play.
+		//    float _x, the world x position.
+		//    float _y, the world y position.
+		//    float _gain, the volume before attenuation.
+		//    bool _looping, if the sound restarts when it ends, until stopped.
+		// Returns: The voice, or INVALID_VOICE if the command queue was full.
+		VoiceId PlayAt(SoundId _sound, float _x, float _y, float _gain = 1.0f, bool _looping = false);
+
+		// Description: Stops a voice. Voices that already finished are ignored. Game thread only.
+		// Parameters: 
+		//    VoiceId _voice, the voice to stop.
+		void StopVoice(VoiceId _voice);
+
+		// Description: Moves a placed voice. Game thread only.
+		// Parameters: 
+		//    VoiceId _voice, the voice to move.
+		//    float _x, the world x position.
+		//    float _y, the world y position.
+		void MoveVoice(VoiceId _voice, float _x, float _y);
+
+		// Description: Moves the listener, usually to the centre of the camera. Game thread only.
+		// Parameters: 
+		//    float _x, the world x position.
+		//    float _y, the world y position.
+		void SetListener(float _x, float _y);
+
+		// Description: Sets the volume of the whole mix. Game thread only.
+		// Parameters: 
+		//    float _gain, the volume.
+		void SetMasterGain(float _gain);
+
+		// Description: Registers the mixer's metrics and starts updating them.
+		// Parameters: 
+		//    MetricsRegistry& _registry, the registry to add the metrics to. Must outlive the mixer.
+		void RegisterMetrics(MetricsRegistry& _registry);
+
+		// Description: Returns the number of voices mixed in the last block.
+		// Returns: The number of real voices.
+		uint32_t GetRealVoiceCount() const;
+
+		// Description: Returns the number of voices skipped in the last block.
+		// Returns: The number of virtual voices.
+		uint32_t GetVirtualVoiceCount() const;
+
+		// Description: Returns the number of commands lost because the queue was full.
+		// Returns: The number of commands. Game thread only.
+		uint32_t GetDroppedCommandCount() const;
+
+		// Description: Returns the mixer's tuning values.
+		// Returns: The settings.
+		const MixerSettings& GetSettings() const;
+	};
+}
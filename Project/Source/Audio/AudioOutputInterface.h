@@ -0,0 +1,45 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: AudioOutputInterface.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: The interface that all audio outputs share. The mixer hands every mixed block to an
+		output, which might be a sound device, a file, or nothing at all.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+namespace OC
+{
+	class AudioOutputInterface
+	{
+	public:
+		// Description: Constructs the output.
+		AudioOutputInterface() {}
+
+		// Description: Outputs cannot be created from other outputs.
+		AudioOutputInterface(const AudioOutputInterface& _output) = delete;
+
+		// Description: Closes the output.
+		virtual ~AudioOutputInterface() = default;
+
+		// Description: Outputs cannot be assigned to other outputs.
+		virtual void operator=(const AudioOutputInterface& _output) = delete;
+
+		// Description: Plays or stores a block of mixed audio. Called from the mixer's thread.
+		// Parameters: 
+		//    const float* _samples, interleaved stereo samples from -1 to 1.
+		//    uint32_t _frameCount, the number of left/right pairs in _samples.
+		// Returns: false, if the output failed. The mixer keeps running either way.
+		virtual bool Write(const float* _samples, uint32_t _frameCount) = 0;
+
+		// Description: Returns if Write blocks until the device needs more audio, the way a sound card
+		//    does. The mixer paces itself by the clock when it doesn't.
+		// Returns: true, if the output sets the pace.
+		virtual bool IsPaced() const = 0;
+	};
+}
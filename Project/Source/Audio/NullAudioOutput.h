@@ -0,0 +1,52 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: NullAudioOutput.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: An audio output that throws the audio away. Lets the mixer run on servers and test
+		machines without a sound device.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include "AudioOutputInterface.h"
+
+namespace OC
+{
+	class NullAudioOutput final : public AudioOutputInterface
+	{
+	private:
+		uint64_t m_FramesWritten; // The number of frames thrown away.
+
+	public:
+		// Description: Constructs the output.
+		NullAudioOutput() : m_FramesWritten(0) {}
+
+		// Description: Throws a block of audio away.
+		// Parameters: 
+		//    const float* _samples, interleaved stereo samples from -1 to 1.
+		//    uint32_t _frameCount, the number of left/right pairs in _samples.
+		// Returns: true.
+		bool Write(const float* _samples, uint32_t _frameCount)
+		{
+			m_FramesWritten += _frameCount;
+			return true;
+		}
+
+		// Description: Returns if Write blocks until the device needs more audio.
+		// Returns: false.
+		bool IsPaced() const
+		{
+			return false;
+		}
+
+		// Description: Returns the number of frames written so far.
+		// Returns: The number of frames.
+		uint64_t GetFramesWritten() const
+		{
+			return m_FramesWritten;
+		}
+	};
+}
@@ -0,0 +1,103 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: WavFileAudioOutput.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include "WavFileAudioOutput.h"
+
+namespace OC
+{
+	// private
+
+	void WavFileAudioOutput::WriteHeader()
+	{
+		constexpr uint32_t CHANNELS = 2;
+		constexpr uint32_t BYTES_PER_SAMPLE = 2;
+
+		uint32_t dataSize = static_cast<uint32_t>(m_FramesWritten * CHANNELS * BYTES_PER_SAMPLE);
+		uint32_t riffSize = 36 + dataSize;
+		uint32_t formatSize = 16;
+		uint16_t formatTag = 1; // PCM.
+		uint16_t channels = CHANNELS;
+		uint32_t byteRate = m_SampleRate * CHANNELS * BYTES_PER_SAMPLE;
+		uint16_t blockAlign = CHANNELS * BYTES_PER_SAMPLE;
+		uint16_t bitsPerSample = BYTES_PER_SAMPLE * 8;
+
+		// WAV is little-endian, as is every platform the game runs on.
+		fseek(m_File, 0, SEEK_SET);
+		fwrite("RIFF", 1, 4, m_File);
+		fwrite(&riffSize, 4, 1, m_File);
+		fwrite("WAVEfmt ", 1, 8, m_File);
+		fwrite(&formatSize, 4, 1, m_File);
+		fwrite(&formatTag, 2, 1, m_File);
+		fwrite(&channels, 2, 1, m_File);
+		fwrite(&m_SampleRate, 4, 1, m_File);
+		fwrite(&byteRate, 4, 1, m_File);
+		fwrite(&blockAlign, 2, 1, m_File);
+		fwrite(&bitsPerSample, 2, 1, m_File);
+		fwrite("data", 1, 4, m_File);
+		fwrite(&dataSize, 4, 1, m_File);
+		fseek(m_File, 0, SEEK_END);
+	}
+
+	// public
+
+	WavFileAudioOutput::WavFileAudioOutput(const char* _path, uint32_t _sampleRate) :
+		m_File(nullptr),
+		m_SampleRate(_sampleRate),
+		m_FramesWritten(0),
+		m_Converted()
+	{
+		m_File = fopen(_path, "wb");
+
+		if (m_File)
+			WriteHeader(); // Rewritten with the real sizes on close.
+	}
+
+	WavFileAudioOutput::~WavFileAudioOutput()
+	{
+		if (m_File)
+		{
+			WriteHeader();
+			fclose(m_File);
+			m_File = nullptr;
+		}
+	}
+
+	bool WavFileAudioOutput::IsOpen() const
+	{
+		return m_File != nullptr;
+	}
+
+	bool WavFileAudioOutput::Write(const float* _samples, uint32_t _frameCount)
+	{
+		if (!m_File)
+			return false;
+
+		m_Converted.resize(_frameCount * 2);
+
+		for (uint32_t i = 0; i < _frameCount * 2; ++i)
+		{
+			float sample = _samples[i] < -1.0f ? -1.0f : (_samples[i] > 1.0f ? 1.0f : _samples[i]);
+			m_Converted[i] = static_cast<int16_t>(sample * 32767.0f);
+		}
+
+		m_FramesWritten += _frameCount;
+		return fwrite(m_Converted.data(), sizeof(int16_t), m_Converted.size(), m_File) == m_Converted.size();
+	}
+
+	bool WavFileAudioOutput::IsPaced() const
+	{
+		return false;
+	}
+
+	uint64_t WavFileAudioOutput::GetFramesWritten() const
+	{
+		return m_FramesWritten;
+	}
+}
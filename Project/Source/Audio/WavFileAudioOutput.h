@@ -0,0 +1,60 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: WavFileAudioOutput.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: An audio output that records the mix to a 16-bit stereo WAV file, for listening to
+		what a headless run sounded like.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <vector>
+#include "AudioOutputInterface.h"
+
+namespace OC
+{
+	class WavFileAudioOutput final : public AudioOutputInterface
+	{
+	private:
+		FILE* m_File; // The file being written. nullptr if it couldn't be opened.
+		uint32_t m_SampleRate; // Frames per second.
+		uint64_t m_FramesWritten; // The number of frames in the file so far.
+		std::vector<int16_t> m_Converted; // Scratch for converting a block to 16-bit.
+
+		// Description: Writes the RIFF header for the frames written so far.
+		void WriteHeader();
+
+	public:
+		// Description: Creates the file.
+		// Parameters: 
+		//    const char* _path, the file to write.
+		//    uint32_t _sampleRate, frames per second.
+		WavFileAudioOutput(const char* _path, uint32_t _sampleRate);
+
+		// Description: Finishes the header and closes the file.
+		~WavFileAudioOutput();
+
+		// Description: Returns if the file was opened.
+		// Returns: true, if open.
+		bool IsOpen() const;
+
+		// Description: Appends a block of audio to the file.
+		// Parameters: 
+		//    const float* _samples, interleaved stereo samples from -1 to 1.
+		//    uint32_t _frameCount, the number of left/right pairs in _samples.
+		// Returns: false, if the file isn't open or couldn't be written.
+		bool Write(const float* _samples, uint32_t _frameCount);
+
+		// Description: Returns if Write blocks until the device needs more audio.
+		// Returns: false.
+		bool IsPaced() const;
+
+		// Description: Returns the number of frames written so far.
+		// Returns: The number of frames.
+		uint64_t GetFramesWritten() const;
+	};
+}
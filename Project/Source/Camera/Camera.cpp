@@ -0,0 +1,126 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Camera.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <float.h>
+#include <math.h>
+#include "Camera.h"
+
+namespace OC
+{
+	// private
+
+	void Camera::Clamp()
+	{
+		m_X = m_X < m_Bounds.minX ? m_Bounds.minX : (m_X > m_Bounds.maxX ? m_Bounds.maxX : m_X);
+		m_Y = m_Y < m_Bounds.minY ? m_Bounds.minY : (m_Y > m_Bounds.maxY ? m_Bounds.maxY : m_Y);
+	}
+
+	// public
+
+	Camera::Camera(unsigned int _width, unsigned int _height) :
+		m_X(0.0f), m_Y(0.0f),
+		m_Zoom(1.0f),
+		m_MinZoom(0.125f), m_MaxZoom(4.0f),
+		m_Width(_width), m_Height(_height),
+		m_Bounds{ -FLT_MAX, -FLT_MAX, FLT_MAX, FLT_MAX }
+	{}
+
+	void Camera::SetViewport(unsigned int _width, unsigned int _height)
+	{
+		m_Width = _width;
+		m_Height = _height;
+	}
+
+	void Camera::SetPosition(float _x, float _y)
+	{
+		m_X = _x;
+		m_Y = _y;
+		Clamp();
+	}
+
+	void Camera::SetBounds(const Rect& _bounds)
+	{
+		assert(_bounds.minX <= _bounds.maxX && _bounds.minY <= _bounds.maxY); // Error: Inverted bounds.
+
+		m_Bounds = _bounds;
+		Clamp();
+	}
+
+	void Camera::SetZoomLimits(float _minZoom, float _maxZoom)
+	{
+		assert(_minZoom > 0.0f && _minZoom <= _maxZoom); // Error: Invalid zoom limits.
+
+		m_MinZoom = _minZoom;
+		m_MaxZoom = _maxZoom;
+		m_Zoom = m_Zoom < m_MinZoom ? m_MinZoom : (m_Zoom > m_MaxZoom ? m_MaxZoom : m_Zoom);
+	}
+
+	void Camera::SetZoom(float _zoom)
+	{
+		m_Zoom = _zoom < m_MinZoom ? m_MinZoom : (_zoom > m_MaxZoom ? m_MaxZoom : _zoom);
+	}
+
+	void Camera::Pan(int _deltaX, int _deltaY)
+	{
+		// Moving the cursor right drags the world right, which moves the camera left.
+		m_X -= static_cast<float>(_deltaX) / m_Zoom;
+		m_Y -= static_cast<float>(_deltaY) / m_Zoom;
+		Clamp();
+	}
+
+	void Camera::Zoom(int _steps, int _cursorX, int _cursorY)
+	{
+		constexpr float ZOOM_PER_STEP = 1.1f;
+
+		if (_steps == 0)
+			return;
+
+		// Remember what's under the cursor before zooming...
+		float beforeX, beforeY;
+		ScreenToWorld(_cursorX, _cursorY, beforeX, beforeY);
+
+		m_Zoom *= powf(ZOOM_PER_STEP, static_cast<float>(_steps));
+		m_Zoom = m_Zoom < m_MinZoom ? m_MinZoom : (m_Zoom > m_MaxZoom ? m_MaxZoom : m_Zoom);
+
+		// ...and move the camera so it's still there afterwards.
+		float afterX, afterY;
+		ScreenToWorld(_cursorX, _cursorY, afterX, afterY);
+
+		m_X += beforeX - afterX;
+		m_Y += beforeY - afterY;
+		Clamp();
+	}
+
+	void Camera::ScreenToWorld(int _screenX, int _screenY, float& _outX, float& _outY) const
+	{
+		_outX = m_X + (static_cast<float>(_screenX) - m_Width * 0.5f) / m_Zoom;
+		_outY = m_Y + (static_cast<float>(_screenY) - m_Height * 0.5f) / m_Zoom;
+	}
+
+	void Camera::WorldToScreen(float _x, float _y, float& _outScreenX, float& _outScreenY) const
+	{
+		_outScreenX = (_x - m_X) * m_Zoom + m_Width * 0.5f;
+		_outScreenY = (_y - m_Y) * m_Zoom + m_Height * 0.5f;
+	}
+
+	Rect Camera::GetVisibleBounds() const
+	{
+		const float halfWidth = m_Width * 0.5f / m_Zoom;
+		const float halfHeight = m_Height * 0.5f / m_Zoom;
+
+		return Rect{ m_X - halfWidth, m_Y - halfHeight, m_X + halfWidth, m_Y + halfHeight };
+	}
+
+	float Camera::GetZoom() const
+	{
+		return m_Zoom;
+	}
+}
@@ -0,0 +1,104 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Camera.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: A 2D camera looking down on the world. Converts between screen pixels and world units,
+		pans by dragging the cursor and zooms toward the cursor with the mouse wheel. It works on plain
+		cursor and wheel values, so it's fed from Input::GetCursorDelta and Input::GetWheelDelta without
+		depending on a platform.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include "../Math/Rect.h"
+
+namespace OC
+{
+	class Camera
+	{
+	private:
+		float m_X, m_Y; // The world position at the centre of the screen.
+		float m_Zoom; // Screen pixels per world unit.
+		float m_MinZoom, m_MaxZoom; // How far the camera can zoom out and in.
+		unsigned int m_Width, m_Height; // The size of the view in pixels.
+		Rect m_Bounds; // The area the centre of the camera is kept inside.
+
+		// Description: Keeps the centre of the camera inside its bounds.
+		void Clamp();
+
+	public:
+		// Description: Constructs a camera centred on the world origin at 1:1 zoom.
+		// Parameters: 
+		//    unsigned int _width, the width of the view in pixels.
+		//    unsigned int _height, the height of the view in pixels.
+		Camera(unsigned int _width, unsigned int _height);
+
+		// Description: Resizes the view, e.g. after the window is resized.
+		// Parameters: 
+		//    unsigned int _width, the width of the view in pixels.
+		//    unsigned int _height, the height of the view in pixels.
+		void SetViewport(unsigned int _width, unsigned int _height);
+
+		// Description: Centres the camera on a world position.
+		// Parameters: 
+		//    float _x, the x position in world units.
+		//    float _y, the y position in world units.
+		void SetPosition(float _x, float _y);
+
+		// Description: Limits where the centre of the camera can go, usually the map.
+		// Parameters: 
+		//    const Rect& _bounds, the area in world units.
+		void SetBounds(const Rect& _bounds);
+
+		// Description: Limits how far the camera can zoom.
+		// Parameters: 
+		//    float _minZoom, the fewest screen pixels per world unit (zoomed out).
+		//    float _maxZoom, the most screen pixels per world unit (zoomed in).
+		void SetZoomLimits(float _minZoom, float _maxZoom);
+
+		// Description: Sets the zoom, within the zoom limits.
+		// Parameters: 
+		//    float _zoom, screen pixels per world unit.
+		void SetZoom(float _zoom);
+
+		// Description: Drags the world along with the cursor.
+		// Parameters: 
+		//    int _deltaX, how far the cursor moved on the x-axis, in pixels.
+		//    int _deltaY, how far the cursor moved on the y-axis, in pixels.
+		void Pan(int _deltaX, int _deltaY);
+
+		// Description: Zooms in or out, keeping the world position under the cursor in place.
+		// Parameters: 
+		//    int _steps, wheel steps. Positive zooms in.
+		//    int _cursorX, the x position of the cursor, in pixels.
+		//    int _cursorY, the y position of the cursor, in pixels.
+		void Zoom(int _steps, int _cursorX, int _cursorY);
+
+		// Description: Converts a screen position to a world position.
+		// Parameters: 
+		//    int _screenX, the x position in pixels.
+		//    int _screenY, the y position in pixels.
+		//    float& _outX, the x position in world units.
+		//    float& _outY, the y position in world units.
+		void ScreenToWorld(int _screenX, int _screenY, float& _outX, float& _outY) const;
+
+		// Description: Converts a world position to a screen position.
+		// Parameters: 
+		//    float _x, the x position in world units.
+		//    float _y, the y position in world units.
+		//    float& _outScreenX, the x position in pixels.
+		//    float& _outScreenY, the y position in pixels.
+		void WorldToScreen(float _x, float _y, float& _outScreenX, float& _outScreenY) const;
+
+		// Description: Returns the part of the world the camera can see.
+		// Returns: The visible area in world units.
+		Rect GetVisibleBounds() const;
+
+		// Description: Returns the zoom.
+		// Returns: Screen pixels per world unit.
+		float GetZoom() const;
+	};
+}
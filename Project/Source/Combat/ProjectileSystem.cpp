@@ -0,0 +1,298 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: ProjectileSystem.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <assert.h>
+#include <math.h>
+#include "../Math/Simd.h"
+#include "ProjectileSystem.h"
+
+namespace OC
+{
+	// private
+
+	void ProjectileSystem::Advance(float _seconds)
+	{
+		using namespace Simd;
+
+		float* x = m_X.data();
+		float* y = m_Y.data();
+		float* life = m_Life.data();
+		const float* velocityX = m_VelocityX.data();
+		const float* velocityY = m_VelocityY.data();
+		const uint32_t count = m_Count;
+		const uint32_t wideCount = count - count % WIDTH;
+		const Float4 seconds = Set(_seconds);
+
+		uint32_t i = 0;
+
+		for (; i < wideCount; i += WIDTH)
+		{
+			Store(x + i, Add(Simd::Load(x + i), Mul(Simd::Load(velocityX + i), seconds)));
+			Store(y + i, Add(Simd::Load(y + i), Mul(Simd::Load(velocityY + i), seconds)));
+			Store(life + i, Sub(Simd::Load(life + i), seconds));
+		}
+
+		for (; i < count; ++i)
+		{
+			x[i] += velocityX[i] * _seconds;
+			y[i] += velocityY[i] * _seconds;
+			life[i] -= _seconds;
+		}
+	}
+
+	void ProjectileSystem::FindHits(const UnitData& _units, const SpatialGrid& _grid, float _seconds,
+		uint32_t _begin, uint32_t _end, std::vector<Hit>& _outHits)
+	{
+		const float hitRadiusSq = m_HitRadius * m_HitRadius;
+
+		for (uint32_t i = _begin; i < _end; ++i)
+		{
+			// Sweep the path travelled this update so fast projectiles can't skip over units.
+			const float pathX = m_VelocityX[i] * _seconds;
+			const float pathY = m_VelocityY[i] * _seconds;
+			const float pathLengthSq = pathX * pathX + pathY * pathY;
+			const float startX = m_X[i] - pathX;
+			const float startY = m_Y[i] - pathY;
+			const float centreX = startX + pathX * 0.5f;
+			const float centreY = startY + pathY * 0.5f;
+			const float searchRadius = sqrtf(pathLengthSq) * 0.5f + m_HitRadius;
+			const uint8_t team = m_Team[i];
+
+			// The closest unit along the path is hit. Ties go to the first unit visited.
+			UnitId hit = INVALID_UNIT;
+			float hitT = 2.0f;
+
+			_grid.Query(centreX, centreY, searchRadius, [&](UnitId _unit, float, float, float)
+			{
+				if (_units.team[_unit] == team)
+					return true;
+
+				// Closest point on the path to the unit.
+				float toX = _units.positionX[_unit] - startX;
+				float toY = _units.positionY[_unit] - startY;
+				float t = pathLengthSq > 0.0f ? (toX * pathX + toY * pathY) / pathLengthSq : 0.0f;
+				t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+
+				float offsetX = toX - pathX * t;
+				float offsetY = toY - pathY * t;
+
+				if (offsetX * offsetX + offsetY * offsetY <= hitRadiusSq && t < hitT)
+				{
+					hit = _unit;
+					hitT = t;
+				}
+
+				return true;
+			});
+
+			if (hit != INVALID_UNIT)
+			{
+				_outHits.push_back(Hit{ hit, m_Damage[i] });
+				m_Alive[i] = 0;
+			}
+			else if (m_Life[i] <= 0.0f)
+			{
+				m_Alive[i] = 0;
+			}
+		}
+	}
+
+	void ProjectileSystem::Compact()
+	{
+		uint32_t kept = 0;
+
+		for (uint32_t i = 0; i < m_Count; ++i)
+		{
+			if (!m_Alive[i])
+				continue;
+
+			if (kept != i)
+			{
+				m_X[kept] = m_X[i];
+				m_Y[kept] = m_Y[i];
+				m_VelocityX[kept] = m_VelocityX[i];
+				m_VelocityY[kept] = m_VelocityY[i];
+				m_Life[kept] = m_Life[i];
+				m_Damage[kept] = m_Damage[i];
+				m_Team[kept] = m_Team[i];
+				m_Alive[kept] = 1;
+			}
+
+			++kept;
+		}
+
+		m_Count = kept;
+	}
+
+	// public
+
+	ProjectileSystem::ProjectileSystem(uint32_t _capacity, float _hitRadius) :
+		m_Count(0),
+		m_HitRadius(_hitRadius),
+		m_X(_capacity), m_Y(_capacity),
+		m_VelocityX(_capacity), m_VelocityY(_capacity),
+		m_Life(_capacity),
+		m_Damage(_capacity),
+		m_Team(_capacity),
+		m_Alive(_capacity),
+		m_ChunkHits(),
+		m_Hits(),
+		m_LastKillCount(0)
+	{
+		assert(_hitRadius > 0.0f); // Error: Projectiles would never hit anything.
+	}
+
+	void ProjectileSystem::Spawn(uint8_t _team, float _x, float _y, float _velocityX, float _velocityY, float _damage, float _life)
+	{
+		// Grow the pool when it's full. It never shrinks, so a busy battle only allocates while warming up.
+		if (m_Count == m_X.size())
+		{
+			size_t capacity = std::max<size_t>(64, m_X.size() * 2);
+
+			m_X.resize(capacity);
+			m_Y.resize(capacity);
+			m_VelocityX.resize(capacity);
+			m_VelocityY.resize(capacity);
+			m_Life.resize(capacity);
+			m_Damage.resize(capacity);
+			m_Team.resize(capacity);
+			m_Alive.resize(capacity);
+		}
+
+		const uint32_t i = m_Count++;
+		m_X[i] = _x;
+		m_Y[i] = _y;
+		m_VelocityX[i] = _velocityX;
+		m_VelocityY[i] = _velocityY;
+		m_Life[i] = _life;
+		m_Damage[i] = _damage;
+		m_Team[i] = _team;
+		m_Alive[i] = 1;
+	}
+
+	void ProjectileSystem::Update(UnitData& _units, const SpatialGrid& _grid, float _seconds, JobSystem* _jobs)
+	{
+		constexpr uint32_t CHUNK_SIZE = 2048; // Projectiles per hit detection job.
+
+		Advance(_seconds);
+
+		// Find hits, a chunk at a time. Each chunk has its own list, so no locking is needed.
+		const uint32_t chunkCount = (m_Count + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+		if (m_ChunkHits.size() < chunkCount)
+			m_ChunkHits.resize(chunkCount);
+
+		auto findHits = [this, &_units, &_grid, _seconds](uint32_t _begin, uint32_t _end)
+		{
+			std::vector<Hit>& hits = m_ChunkHits[_begin / CHUNK_SIZE];
+			hits.clear();
+			FindHits(_units, _grid, _seconds, _begin, _end, hits);
+		};
+
+		if (_jobs)
+			_jobs->ParallelFor(m_Count, CHUNK_SIZE, findHits);
+		else
+		{
+			for (uint32_t begin = 0; begin < m_Count; begin += CHUNK_SIZE)
+				findHits(begin, std::min(begin + CHUNK_SIZE, m_Count));
+		}
+
+		// Merge the hits in chunk order, which is projectile order no matter how the chunks ran.
+		m_Hits.clear();
+
+		for (uint32_t chunk = 0; chunk < chunkCount; ++chunk)
+			m_Hits.insert(m_Hits.end(), m_ChunkHits[chunk].begin(), m_ChunkHits[chunk].end());
+
+		// Group the hits by unit so each unit's health is touched once, in projectile order.
+		std::stable_sort(m_Hits.begin(), m_Hits.end(), [](const Hit& _a, const Hit& _b) { return _a.unit < _b.unit; });
+
+		float* health = _units.health.data();
+		m_LastKillCount = 0;
+
+		for (const Hit& hit : m_Hits)
+		{
+			const bool wasAlive = health[hit.unit] > 0.0f;
+			health[hit.unit] -= hit.damage;
+			m_LastKillCount += wasAlive && health[hit.unit] <= 0.0f ? 1 : 0;
+		}
+
+		Compact();
+	}
+
+	void ProjectileSystem::Save(SaveWriter& _save) const
+	{
+		// Only the part of the pool in use.
+		_save.BeginChunk(MakeChunkId('P', 'R', 'O', 'J'), 1);
+		_save.WriteArray(m_X.data(), m_Count);
+		_save.WriteArray(m_Y.data(), m_Count);
+		_save.WriteArray(m_VelocityX.data(), m_Count);
+		_save.WriteArray(m_VelocityY.data(), m_Count);
+		_save.WriteArray(m_Life.data(), m_Count);
+		_save.WriteArray(m_Damage.data(), m_Count);
+		_save.WriteArray(m_Team.data(), m_Count);
+		_save.EndChunk();
+	}
+
+	bool ProjectileSystem::Load(SaveReader& _save)
+	{
+		uint16_t version;
+		std::vector<float> x, y, velocityX, velocityY, life, damage;
+		std::vector<uint8_t> team;
+
+		if (!_save.OpenChunk(MakeChunkId('P', 'R', 'O', 'J'), version) || version != 1 ||
+			!_save.ReadArray(x) || !_save.ReadArray(y) || !_save.ReadArray(velocityX) || !_save.ReadArray(velocityY) ||
+			!_save.ReadArray(life) || !_save.ReadArray(damage) || !_save.ReadArray(team))
+			return false;
+
+		const size_t count = x.size();
+
+		if (y.size() != count || velocityX.size() != count || velocityY.size() != count ||
+			life.size() != count || damage.size() != count || team.size() != count)
+			return false;
+
+		Clear();
+
+		for (size_t i = 0; i < count; ++i)
+			Spawn(team[i], x[i], y[i], velocityX[i], velocityY[i], damage[i], life[i]);
+
+		return true;
+	}
+
+	void ProjectileSystem::Clear()
+	{
+		m_Count = 0;
+	}
+
+	uint32_t ProjectileSystem::Count() const
+	{
+		return m_Count;
+	}
+
+	uint32_t ProjectileSystem::GetLastHitCount() const
+	{
+		return static_cast<uint32_t>(m_Hits.size());
+	}
+
+	uint32_t ProjectileSystem::GetLastKillCount() const
+	{
+		return m_LastKillCount;
+	}
+
+	const float* ProjectileSystem::GetX() const
+	{
+		return m_X.data();
+	}
+
+	const float* ProjectileSystem::GetY() const
+	{
+		return m_Y.data();
+	}
+}
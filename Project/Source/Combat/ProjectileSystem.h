@@ -0,0 +1,123 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: ProjectileSystem.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Every projectile in flight, stored as a pool of SoA arrays that only ever grows. Each
+		update advances them with a SIMD kernel, sweeps their path against the spatial grid for hits, and
+		applies the damage in a fixed order so results don't depend on how the work was split up.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <vector>
+#include "../Serialization/SaveGame.h"
+#include "../Simulation/SpatialGrid.h"
+#include "../Simulation/Units.h"
+#include "../Threading/JobSystem.h"
+
+namespace OC
+{
+	class ProjectileSystem
+	{
+	private:
+		struct Hit
+		{
+			UnitId unit; // The unit that was hit.
+			float damage; // The damage to apply.
+		};
+
+		uint32_t m_Count; // The number of projectiles in flight. The rest of the pool is free.
+		float m_HitRadius; // How close a projectile must pass to a unit to hit it.
+		std::vector<float> m_X, m_Y; // Position.
+		std::vector<float> m_VelocityX, m_VelocityY; // Velocity in world units per second.
+		std::vector<float> m_Life; // Seconds until the projectile expires.
+		std::vector<float> m_Damage; // Damage dealt on hit.
+		std::vector<uint8_t> m_Team; // The team that fired it. Projectiles pass through their own team.
+		std::vector<uint8_t> m_Alive; // 0 once the projectile hit something or expired.
+		std::vector<std::vector<Hit>> m_ChunkHits; // Hits found by each chunk, merged in chunk order.
+		std::vector<Hit> m_Hits; // Every hit of the last update.
+		uint32_t m_LastKillCount; // Units killed during the last update.
+
+		// Description: Moves every projectile and ages it.
+		// Parameters: 
+		//    float _seconds, the time to advance by.
+		void Advance(float _seconds);
+
+		// Description: Finds what projectiles in a range hit during the last advance.
+		// Parameters: 
+		//    const UnitData& _units, every unit in the world.
+		//    const SpatialGrid& _grid, the grid of living units.
+		//    float _seconds, the time that was advanced by.
+		//    uint32_t _begin, the first projectile to check.
+		//    uint32_t _end, one past the last projectile to check.
+		//    std::vector<Hit>& _outHits, the list to append hits to, in projectile order.
+		void FindHits(const UnitData& _units, const SpatialGrid& _grid, float _seconds,
+			uint32_t _begin, uint32_t _end, std::vector<Hit>& _outHits);
+
+		// Description: Removes dead projectiles, keeping the others in order.
+		void Compact();
+
+	public:
+		// Description: Constructs an empty pool.
+		// Parameters: 
+		//    uint32_t _capacity, the number of projectiles to make room for up front.
+		//    float _hitRadius, how close a projectile must pass to a unit to hit it.
+		explicit ProjectileSystem(uint32_t _capacity = 4096, float _hitRadius = 8.0f);
+
+		// Description: Fires a projectile.
+		// Parameters: 
+		//    uint8_t _team, the team that fired it.
+		//    float _x, the x position it starts at.
+		//    float _y, the y position it starts at.
+		//    float _velocityX, the x velocity in world units per second.
+		//    float _velocityY, the y velocity in world units per second.
+		//    float _damage, the damage dealt on hit.
+		//    float _life, seconds until the projectile expires.
+		void Spawn(uint8_t _team, float _x, float _y, float _velocityX, float _velocityY, float _damage, float _life);
+
+		// Description: Advances every projectile, then applies the damage of every hit.
+		// Parameters: 
+		//    UnitData& _units, every unit in the world.
+		//    const SpatialGrid& _grid, the grid of living units.
+		//    float _seconds, the time to advance by.
+		//    JobSystem* _jobs, splits hit detection across threads if not nullptr.
+		void Update(UnitData& _units, const SpatialGrid& _grid, float _seconds, JobSystem* _jobs = nullptr);
+
+		// Description: Adds every projectile in flight to a save.
+		// Parameters: 
+		//    SaveWriter& _save, the save to add to.
+		void Save(SaveWriter& _save) const;
+
+		// Description: Replaces the projectiles in flight with the ones saved by Save.
+		// Parameters: 
+		//    SaveReader& _save, the save to read from.
+		// Returns: true, if the save held valid projectiles.
+		bool Load(SaveReader& _save);
+
+		// Description: Removes every projectile.
+		void Clear();
+
+		// Description: Returns the number of projectiles in flight.
+		// Returns: The number of projectiles.
+		uint32_t Count() const;
+
+		// Description: Returns the number of hits during the last update.
+		// Returns: The number of hits.
+		uint32_t GetLastHitCount() const;
+
+		// Description: Returns the number of units killed during the last update.
+		// Returns: The number of units whose health ran out.
+		uint32_t GetLastKillCount() const;
+
+		// Description: Returns the x positions of the projectiles in flight. Count() long.
+		// Returns: The x positions.
+		const float* GetX() const;
+
+		// Description: Returns the y positions of the projectiles in flight. Count() long.
+		// Returns: The y positions.
+		const float* GetY() const;
+	};
+}
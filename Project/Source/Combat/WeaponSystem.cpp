@@ -0,0 +1,103 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: WeaponSystem.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <math.h>
+#include "WeaponSystem.h"
+
+namespace OC
+{
+	// public
+
+	WeaponSystem::WeaponSystem(const DefinitionDatabase& _definitions) :
+		m_Definitions(_definitions),
+		m_Cooldown(),
+		m_LastShotCount(0)
+	{
+	}
+
+	void WeaponSystem::Update(const UnitData& _units, const std::vector<UnitId>& _targets, ProjectileSystem& _projectiles, float _seconds)
+	{
+		const uint32_t count = _units.Count();
+		const UnitDef* unitDefs = m_Definitions.GetUnits();
+		const WeaponDef* weaponDefs = m_Definitions.GetWeapons();
+
+		assert(_targets.size() >= count); // Error: Every unit needs a target entry.
+
+		m_Cooldown.resize(count, 0.0f);
+		m_LastShotCount = 0;
+
+		float* cooldown = m_Cooldown.data();
+
+		for (uint32_t i = 0; i < count; ++i)
+			cooldown[i] -= _seconds;
+
+		for (UnitId unit = 0; unit < count; ++unit)
+		{
+			const UnitId target = _targets[unit];
+
+			if (cooldown[unit] > 0.0f || target == INVALID_UNIT || !_units.IsAlive(unit) || !_units.IsAlive(target))
+				continue;
+
+			const WeaponType weaponType = unitDefs[_units.type[unit]].weapon;
+
+			if (weaponType == NO_DEFINITION)
+				continue;
+
+			const WeaponDef& weapon = weaponDefs[weaponType];
+			float dx = _units.positionX[target] - _units.positionX[unit];
+			float dy = _units.positionY[target] - _units.positionY[unit];
+			float distanceSq = dx * dx + dy * dy;
+
+			if (distanceSq > weapon.range * weapon.range || distanceSq == 0.0f)
+				continue;
+
+			float scale = weapon.projectileSpeed / sqrtf(distanceSq);
+			// Projectiles live long enough to reach a target at the edge of range, with some slack.
+			float life = weapon.range / weapon.projectileSpeed * 1.5f;
+
+			_projectiles.Spawn(
+				_units.team[unit],
+				_units.positionX[unit], _units.positionY[unit],
+				dx * scale, dy * scale,
+				weapon.damage,
+				life
+			);
+
+			cooldown[unit] = weapon.cooldown;
+			++m_LastShotCount;
+		}
+	}
+
+	void WeaponSystem::Save(SaveWriter& _save) const
+	{
+		_save.BeginChunk(MakeChunkId('W', 'E', 'A', 'P'), 1);
+		_save.WriteArray(m_Cooldown);
+		_save.EndChunk();
+	}
+
+	bool WeaponSystem::Load(SaveReader& _save, uint32_t _unitCount)
+	{
+		uint16_t version;
+
+		return _save.OpenChunk(MakeChunkId('W', 'E', 'A', 'P'), version) && version == 1 &&
+			   _save.ReadArray(m_Cooldown) && m_Cooldown.size() <= _unitCount;
+	}
+
+	const DefinitionDatabase& WeaponSystem::GetDefinitions() const
+	{
+		return m_Definitions;
+	}
+
+	uint32_t WeaponSystem::GetLastShotCount() const
+	{
+		return m_LastShotCount;
+	}
+}
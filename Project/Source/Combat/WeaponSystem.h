@@ -0,0 +1,70 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: WeaponSystem.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Fires projectiles at the targets the AI picked, once the target is in range and the
+		weapon has cooled down. Every unit fires the weapon its definition names, and units without one
+		never fire.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <vector>
+#include "../Data/DefinitionDatabase.h"
+#include "../Serialization/SaveGame.h"
+#include "../Simulation/Units.h"
+#include "ProjectileSystem.h"
+
+namespace OC
+{
+	class WeaponSystem
+	{
+	private:
+		const DefinitionDatabase& m_Definitions; // The weapons, and which unit carries which.
+		std::vector<float> m_Cooldown; // Seconds until each unit can fire again.
+		uint32_t m_LastShotCount; // The number of shots fired during the last update.
+
+	public:
+		// Description: Constructs the weapon system.
+		// Parameters: 
+		//    const DefinitionDatabase& _definitions, the weapons and units. Must outlive the system.
+		explicit WeaponSystem(const DefinitionDatabase& _definitions);
+
+		// Description: WeaponSystem's cannot be created from other WeaponSystem's.
+		WeaponSystem(const WeaponSystem& _system) = delete;
+
+		// Description: WeaponSystem's cannot be assigned to other WeaponSystem's.
+		void operator=(const WeaponSystem& _system) = delete;
+
+		// Description: Cools weapons down and fires the ones that are ready and in range of their target.
+		// Parameters: 
+		//    const UnitData& _units, every unit in the world.
+		//    const std::vector<UnitId>& _targets, the target of each unit, or INVALID_UNIT.
+		//    ProjectileSystem& _projectiles, receives the projectiles fired.
+		//    float _seconds, the time since the last update.
+		void Update(const UnitData& _units, const std::vector<UnitId>& _targets, ProjectileSystem& _projectiles, float _seconds);
+
+		// Description: Adds every unit's weapon cooldown to a save.
+		// Parameters: 
+		//    SaveWriter& _save, the save to add to.
+		void Save(SaveWriter& _save) const;
+
+		// Description: Restores the state saved by Save.
+		// Parameters: 
+		//    SaveReader& _save, the save to read from.
+		//    uint32_t _unitCount, the number of units in the loaded world.
+		// Returns: true, if the save held valid weapon state for that many units.
+		bool Load(SaveReader& _save, uint32_t _unitCount);
+
+		// Description: Returns the definitions weapons are looked up in.
+		// Returns: The definitions.
+		const DefinitionDatabase& GetDefinitions() const;
+
+		// Description: Returns the number of shots fired during the last update.
+		// Returns: The number of shots.
+		uint32_t GetLastShotCount() const;
+	};
+}
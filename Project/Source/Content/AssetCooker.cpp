@@ -0,0 +1,490 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: AssetCooker.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <assert.h>
+#include <chrono>
+#include <filesystem>
+#include <stdio.h>
+#include <string.h>
+#include "AssetCooker.h"
+#include "AtlasPacker.h"
+#include "BlockCompression.h"
+#include "CookedTexture.h"
+#include "Image.h"
+#include "../Serialization/AtomicFile.h"
+#include "../Serialization/Hash64.h"
+#include "../Threading/JobSystem.h"
+
+namespace OC
+{
+	namespace AssetCooker
+	{
+		namespace fs = std::filesystem;
+
+		static const char* const ATLAS_EXTENSION = ".atlas"; // Folders with this extension are packed into one atlas.
+		static const char* const COOKED_EXTENSION = ".octex"; // The extension of every cooked texture.
+
+		// A texture to cook, from one image or from a folder of sprites.
+		struct Asset
+		{
+			fs::path output; // The cooked file.
+			std::vector<fs::path> sources; // The images, sorted by name for atlases.
+			bool atlas; // If the sources are packed into an atlas.
+			uint64_t bytes; // The total size of the sources, to cook the largest first.
+		};
+
+		// Description: Reads a whole file.
+		// Parameters: 
+		//    const fs::path& _path, the file.
+		//    std::vector<uint8_t>& _outBytes, replaced with the file's bytes.
+		// Returns: true, if the file was read.
+		static bool ReadFile(const fs::path& _path, std::vector<uint8_t>& _outBytes)
+		{
+			std::error_code error;
+			uintmax_t size = fs::file_size(_path, error);
+			if (error)
+				return false;
+
+			FILE* file = fopen(_path.string().c_str(), "rb");
+			if (!file)
+				return false;
+
+			_outBytes.resize(static_cast<size_t>(size));
+			bool read = fread(_outBytes.data(), 1, _outBytes.size(), file) == _outBytes.size();
+			fclose(file);
+			return read;
+		}
+
+		// Description: Checks if a cooked texture was cooked from the same sources and settings.
+		// Parameters: 
+		//    const fs::path& _path, the cooked texture.
+		//    uint64_t _hash, the hash of the sources and settings.
+		// Returns: true, if the file is complete and its hash matches.
+		static bool IsUpToDate(const fs::path& _path, uint64_t _hash)
+		{
+			FILE* file = fopen(_path.string().c_str(), "rb");
+			if (!file)
+				return false;
+
+			CookedTextureHeader header;
+			bool read = fread(&header, sizeof(header), 1, file) == 1;
+			fclose(file);
+
+			std::error_code error;
+			uintmax_t size = fs::file_size(_path, error);
+
+			return read && !error && header.magic == COOKED_TEXTURE_MAGIC && header.version == COOKED_TEXTURE_VERSION &&
+				header.sourceHash == _hash && header.fileSize == size;
+		}
+
+		// Description: Expands a grayscale image to opaque RGBA.
+		// Parameters: 
+		//    Image& _image, the image. Left alone if it is already RGBA.
+		static void ExpandToRgba(Image& _image)
+		{
+			if (_image.channels == 4)
+				return;
+
+			std::vector<uint8_t> rgba(_image.pixels.size() * 4);
+			for (size_t i = 0; i < _image.pixels.size(); ++i)
+			{
+				rgba[i * 4] = rgba[i * 4 + 1] = rgba[i * 4 + 2] = _image.pixels[i];
+				rgba[i * 4 + 3] = 0xFF;
+			}
+
+			_image.pixels.swap(rgba);
+			_image.channels = 4;
+		}
+
+		// Description: Packs decoded sprites into one atlas image, extruding every sprite's edges into its padding.
+		// Parameters: 
+		//    std::vector<Image>& _sprites, the sprites. Expanded to RGBA.
+		//    const Asset& _asset, the atlas, for the sprites' names.
+		//    const CookerSettings& _settings, the padding and the largest size.
+		//    Image& _outAtlas, replaced with the atlas.
+		//    std::vector<CookedSprite>& _outSprites, replaced with where every sprite is.
+		//    std::string& _outError, receives why the sprites couldn't be packed.
+		// Returns: true, if the sprites were packed.
+		static bool BuildAtlas(std::vector<Image>& _sprites, const Asset& _asset, const CookerSettings& _settings,
+			Image& _outAtlas, std::vector<CookedSprite>& _outSprites, std::string& _outError)
+		{
+			const size_t count = _sprites.size();
+			std::vector<uint32_t> widths(count), heights(count);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				ExpandToRgba(_sprites[i]);
+				widths[i] = _sprites[i].width;
+				heights[i] = _sprites[i].height;
+			}
+
+			std::vector<PackedRect> rects;
+			uint32_t width, height;
+
+			if (!AtlasPacker::Pack(widths, heights, _settings.atlasPadding, _settings.atlasMaxSize, rects, width, height))
+			{
+				_outError = "sprites don't fit in an atlas of " + std::to_string(_settings.atlasMaxSize) + " pixels";
+				return false;
+			}
+
+			_outAtlas.width = width;
+			_outAtlas.height = height;
+			_outAtlas.channels = 4;
+			_outAtlas.pixels.assign(static_cast<size_t>(width) * height * 4, 0);
+			_outSprites.resize(count);
+
+			const int32_t padding = static_cast<int32_t>(_settings.atlasPadding);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const Image& sprite = _sprites[i];
+				const int32_t spriteWidth = static_cast<int32_t>(sprite.width), spriteHeight = static_cast<int32_t>(sprite.height);
+
+				// The padding repeats the nearest edge pixel, so filtering and mips never pull in a neighbour.
+				for (int32_t y = -padding; y < spriteHeight + padding; ++y)
+				{
+					const int32_t sourceY = std::min(std::max(y, 0), spriteHeight - 1);
+					uint8_t* destination = &_outAtlas.pixels[(static_cast<size_t>(rects[i].y + y) * width + rects[i].x - padding) * 4];
+
+					for (int32_t x = -padding; x < spriteWidth + padding; ++x, destination += 4)
+					{
+						const int32_t sourceX = std::min(std::max(x, 0), spriteWidth - 1);
+						memcpy(destination, &sprite.pixels[(static_cast<size_t>(sourceY) * spriteWidth + sourceX) * 4], 4);
+					}
+				}
+
+				CookedSprite& cooked = _outSprites[i];
+				memset(&cooked, 0, sizeof(cooked));
+				std::string name = _asset.sources[i].stem().string();
+				memcpy(cooked.name, name.c_str(), name.size());
+				cooked.x = static_cast<uint16_t>(rects[i].x);
+				cooked.y = static_cast<uint16_t>(rects[i].y);
+				cooked.width = static_cast<uint16_t>(sprite.width);
+				cooked.height = static_cast<uint16_t>(sprite.height);
+			}
+
+			return true;
+		}
+
+		// Description: Writes a file, creating its folder if needed and replacing any old file in one step.
+		// Parameters: 
+		//    const fs::path& _path, the destination.
+		//    const std::vector<uint8_t>& _bytes, the contents.
+		// Returns: true, if the file was written.
+		static bool WriteFile(const fs::path& _path, const std::vector<uint8_t>& _bytes)
+		{
+			std::error_code error;
+			fs::create_directories(_path.parent_path(), error);
+
+			return AtomicFile::Write(_path.string(), _bytes.data(), _bytes.size());
+		}
+
+		// Description: Cooks one asset, unless its output is up to date.
+		// Parameters: 
+		//    const Asset& _asset, the asset.
+		//    const CookerSettings& _settings, how to cook it.
+		//    CookedAsset& _outResult, receives what happened.
+		//    JobSystem* _jobs, encodes large textures across workers when given.
+		static void CookAsset(const Asset& _asset, const CookerSettings& _settings, CookedAsset& _outResult, JobSystem* _jobs)
+		{
+			_outResult.result = CookResult::FAILED;
+
+			if (_asset.sources.empty())
+			{
+				_outResult.error = _asset.output.string() + ": the atlas has no images";
+				return;
+			}
+
+			// Everything that changes the output goes into the hash: the encoders' version, the settings
+			// and, for atlases, the names sprites are looked up by.
+			const uint32_t settings[4] = { COOKED_TEXTURE_VERSION, _settings.compress ? 1u : 0u, _settings.atlasPadding, _settings.atlasMaxSize };
+			uint64_t hash = Hash64(settings, sizeof(settings));
+			std::vector<std::vector<uint8_t>> files(_asset.sources.size());
+
+			for (size_t i = 0; i < files.size(); ++i)
+			{
+				if (!ReadFile(_asset.sources[i], files[i]))
+				{
+					_outResult.error = _asset.sources[i].string() + ": could not be read";
+					return;
+				}
+
+				std::string name = _asset.sources[i].filename().string();
+				hash = Hash64(name.data(), name.size(), hash);
+				hash = Hash64(files[i].data(), files[i].size(), hash);
+			}
+
+			if (!_settings.force && IsUpToDate(_asset.output, hash))
+			{
+				_outResult.result = CookResult::SKIPPED;
+				return;
+			}
+
+			std::vector<Image> images(files.size());
+
+			for (size_t i = 0; i < files.size(); ++i)
+			{
+				std::string error;
+				if (!ImageFile::Decode(files[i].data(), files[i].size(), images[i], error))
+				{
+					_outResult.error = _asset.sources[i].string() + ": " + error;
+					return;
+				}
+
+				std::vector<uint8_t>().swap(files[i]);
+			}
+
+			Image base;
+			std::vector<CookedSprite> sprites;
+
+			if (_asset.atlas)
+			{
+				for (const fs::path& source : _asset.sources)
+				{
+					if (source.stem().string().size() >= COOKED_SPRITE_NAME_LENGTH)
+					{
+						_outResult.error = source.string() + ": sprite names must be shorter than " + std::to_string(COOKED_SPRITE_NAME_LENGTH) + " characters";
+						return;
+					}
+				}
+
+				if (!BuildAtlas(images, _asset, _settings, base, sprites, _outResult.error))
+				{
+					_outResult.error = _asset.output.string() + ": " + _outResult.error;
+					return;
+				}
+			}
+			else
+			{
+				base = std::move(images[0]);
+			}
+
+			images.clear();
+
+			CookedFormat format;
+			if (base.channels == 1)
+			{
+				format = _settings.compress ? CookedFormat::BC4 : CookedFormat::R8;
+			}
+			else
+			{
+				bool opaque = true;
+				for (size_t i = 3; i < base.pixels.size() && opaque; i += 4)
+					opaque = base.pixels[i] == 0xFF;
+
+				format = !_settings.compress ? CookedFormat::RGBA8 : opaque ? CookedFormat::BC1 : CookedFormat::BC3;
+			}
+
+			// Lay the file out: header, sprites, then every mip level on its own boundary.
+			CookedTextureHeader header;
+			memset(&header, 0, sizeof(header));
+			header.magic = COOKED_TEXTURE_MAGIC;
+			header.version = COOKED_TEXTURE_VERSION;
+			header.format = format;
+			header.width = base.width;
+			header.height = base.height;
+			header.sourceHash = hash;
+			header.spriteCount = static_cast<uint32_t>(sprites.size());
+			header.spriteOffset = sprites.empty() ? 0 : static_cast<uint32_t>(sizeof(header));
+
+			uint64_t offset = sizeof(header) + sprites.size() * sizeof(CookedSprite);
+			uint32_t width = base.width, height = base.height;
+
+			while (header.mipCount < COOKED_MAX_MIPS)
+			{
+				offset = (offset + COOKED_ALIGNMENT - 1) & ~static_cast<uint64_t>(COOKED_ALIGNMENT - 1);
+				size_t size = BlockCompression::GetLevelSize(format, width, height);
+				header.mips[header.mipCount].offset = static_cast<uint32_t>(offset);
+				header.mips[header.mipCount].size = static_cast<uint32_t>(size);
+				++header.mipCount;
+				offset += size;
+
+				if (offset > UINT32_MAX)
+				{
+					_outResult.error = _asset.output.string() + ": the texture is too large to cook; try compressing it";
+					return;
+				}
+
+				if (width == 1 && height == 1)
+					break;
+
+				width = width > 1 ? width / 2 : 1;
+				height = height > 1 ? height / 2 : 1;
+			}
+
+			header.fileSize = static_cast<uint32_t>(offset);
+
+			std::vector<uint8_t> bytes(header.fileSize, 0);
+			memcpy(bytes.data(), &header, sizeof(header));
+			if (!sprites.empty())
+				memcpy(&bytes[header.spriteOffset], sprites.data(), sprites.size() * sizeof(CookedSprite));
+
+			Image level = std::move(base), next;
+
+			for (uint32_t mip = 0; mip < header.mipCount; ++mip)
+			{
+				if (mip > 0)
+				{
+					ImageFile::Downsample(level, next);
+					std::swap(level, next);
+				}
+
+				BlockCompression::Encode(level, format, &bytes[header.mips[mip].offset], _jobs);
+			}
+
+			if (!WriteFile(_asset.output, bytes))
+			{
+				_outResult.error = _asset.output.string() + ": could not be written";
+				return;
+			}
+
+			_outResult.result = CookResult::COOKED;
+		}
+
+		// Description: Finds every asset in the source folder.
+		// Parameters: 
+		//    const CookerSettings& _settings, the source and output folders.
+		//    std::vector<Asset>& _outAssets, replaced with the assets, sorted by output path.
+		//    std::string& _outError, receives why the folder couldn't be read.
+		// Returns: true, if the folder was read.
+		static bool FindAssets(const CookerSettings& _settings, std::vector<Asset>& _outAssets, std::string& _outError)
+		{
+			const fs::path source(_settings.sourcePath), output(_settings.outputPath);
+			std::error_code error;
+			_outAssets.clear();
+
+			if (!fs::is_directory(source, error))
+			{
+				_outError = _settings.sourcePath + ": is not a folder";
+				return false;
+			}
+
+			fs::recursive_directory_iterator entry(source, error), end;
+
+			for (; !error && entry != end; entry.increment(error))
+			{
+				const fs::path& path = entry->path();
+				fs::path relative = path.lexically_relative(source);
+
+				if (entry->is_directory(error) && path.extension() == ATLAS_EXTENSION)
+				{
+					// Everything directly inside is one sprite.
+					entry.disable_recursion_pending();
+
+					Asset asset;
+					asset.output = (output / relative).replace_extension(COOKED_EXTENSION);
+					asset.atlas = true;
+					asset.bytes = 0;
+
+					for (const fs::directory_entry& sprite : fs::directory_iterator(path, error))
+					{
+						if (sprite.is_regular_file(error) && ImageFile::IsSupportedExtension(sprite.path().extension().string()))
+						{
+							asset.sources.push_back(sprite.path());
+							asset.bytes += sprite.file_size(error);
+						}
+					}
+
+					if (error)
+						break;
+
+					std::sort(asset.sources.begin(), asset.sources.end());
+					_outAssets.push_back(std::move(asset));
+				}
+				else if (entry->is_regular_file(error) && ImageFile::IsSupportedExtension(path.extension().string()))
+				{
+					Asset asset;
+					asset.output = (output / relative).replace_extension(COOKED_EXTENSION);
+					asset.sources.push_back(path);
+					asset.atlas = false;
+					asset.bytes = entry->file_size(error);
+					_outAssets.push_back(std::move(asset));
+				}
+			}
+
+			if (error)
+			{
+				_outError = _settings.sourcePath + ": could not be read, " + error.message();
+				return false;
+			}
+
+			std::sort(_outAssets.begin(), _outAssets.end(), [](const Asset& _a, const Asset& _b)
+			{
+				return _a.output < _b.output;
+			});
+
+			// Two sources cooking to the same file, like "grass.tga" and "grass.ppm", would race.
+			for (size_t i = 1; i < _outAssets.size(); ++i)
+			{
+				if (_outAssets[i].output == _outAssets[i - 1].output)
+				{
+					_outError = _outAssets[i].output.string() + ": is cooked from more than one source";
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		bool Cook(const CookerSettings& _settings, CookerReport& _outReport, std::string& _outError, JobSystem* _jobs)
+		{
+			std::vector<Asset> assets;
+			_outReport = CookerReport();
+
+			if (!FindAssets(_settings, assets, _outError))
+				return false;
+
+			const uint32_t count = static_cast<uint32_t>(assets.size());
+			_outReport.assets.resize(count);
+
+			// Largest first, so one big texture never starts last and leaves the other cores idle.
+			std::vector<uint32_t> order(count);
+			for (uint32_t i = 0; i < count; ++i)
+				order[i] = i;
+
+			std::stable_sort(order.begin(), order.end(), [&assets](uint32_t _a, uint32_t _b)
+			{
+				return assets[_a].bytes > assets[_b].bytes;
+			});
+
+			auto cook = [&](uint32_t _begin, uint32_t _end)
+			{
+				for (uint32_t i = _begin; i < _end; ++i)
+				{
+					const Asset& asset = assets[order[i]];
+					CookedAsset& result = _outReport.assets[order[i]];
+					auto start = std::chrono::steady_clock::now();
+
+					result.outputPath = asset.output.string();
+					CookAsset(asset, _settings, result, _jobs);
+					result.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+				}
+			};
+
+			if (_jobs)
+				_jobs->ParallelFor(count, 1, cook);
+			else
+				cook(0, count);
+
+			for (const CookedAsset& asset : _outReport.assets)
+			{
+				if (asset.result == CookResult::COOKED)
+					++_outReport.cooked;
+				else if (asset.result == CookResult::SKIPPED)
+					++_outReport.skipped;
+				else
+					++_outReport.failed;
+			}
+
+			return true;
+		}
+	}
+}
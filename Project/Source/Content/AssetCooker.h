@@ -0,0 +1,74 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: AssetCooker.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Converts a folder of source images into cooked textures (see CookedTexture.h). Every
+		supported image becomes one texture with its full mip chain, and every folder whose name ends in
+		".atlas" is packed into one texture with a sprite per image. Opaque color is encoded as BC1,
+		color with alpha as BC3 and grayscale, such as height maps, as BC4.
+
+		Assets are cooked in parallel, largest first, and large textures are encoded across workers as
+		well. Each output records a hash of its sources and the settings that affect it, so an asset
+		whose hash matches its output is skipped without being decoded. Output for sources that no
+		longer exist is left alone.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace OC
+{
+	class JobSystem;
+
+	struct CookerSettings
+	{
+		std::string sourcePath; // The folder of source assets, searched recursively.
+		std::string outputPath; // The folder cooked assets are written to, mirroring the sources.
+		bool compress = true; // If textures are block compressed. Otherwise they stay RGBA8 or R8.
+		bool force = false; // If every asset is cooked, even when its output is up to date.
+		uint32_t atlasPadding = 2; // Pixels of extruded edge around every sprite of an atlas.
+		uint32_t atlasMaxSize = 4096; // The largest width or height of an atlas.
+	};
+
+	enum class CookResult : uint8_t
+	{
+		COOKED, // The asset changed and was written.
+		SKIPPED, // The output was up to date.
+		FAILED // The asset couldn't be read, decoded or written.
+	};
+
+	// What happened to one asset.
+	struct CookedAsset
+	{
+		std::string outputPath; // The cooked file.
+		CookResult result; // What happened.
+		std::string error; // Why it failed, if it did.
+		double milliseconds; // The time spent on the asset.
+	};
+
+	struct CookerReport
+	{
+		std::vector<CookedAsset> assets; // Every asset found, in the order they were found.
+		uint32_t cooked = 0; // Assets written.
+		uint32_t skipped = 0; // Assets already up to date.
+		uint32_t failed = 0; // Assets that couldn't be cooked.
+	};
+
+	namespace AssetCooker
+	{
+		// Description: Cooks every asset of the source folder that changed.
+		// Parameters: 
+		//    const CookerSettings& _settings, what to cook and how.
+		//    CookerReport& _outReport, replaced with what happened to every asset.
+		//    std::string& _outError, receives why nothing could be cooked, if it couldn't.
+		//    JobSystem* _jobs, cooks assets in parallel when given.
+		// Returns: false, if the source folder couldn't be read. Assets that fail are in the report.
+		bool Cook(const CookerSettings& _settings, CookerReport& _outReport, std::string& _outError, JobSystem* _jobs = nullptr);
+	}
+}
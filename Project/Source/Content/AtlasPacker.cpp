@@ -0,0 +1,103 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: AtlasPacker.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <assert.h>
+#include "AtlasPacker.h"
+
+namespace OC
+{
+	namespace AtlasPacker
+	{
+		constexpr uint32_t CELL_ALIGNMENT = 4; // Cells start and end on block boundaries.
+
+		// Description: Rounds up to a multiple of CELL_ALIGNMENT.
+		// Parameters: 
+		//    uint32_t _value, the value.
+		// Returns: The rounded value.
+		static uint32_t Align(uint32_t _value)
+		{
+			return (_value + CELL_ALIGNMENT - 1) & ~(CELL_ALIGNMENT - 1);
+		}
+
+		bool Pack(const std::vector<uint32_t>& _widths, const std::vector<uint32_t>& _heights, uint32_t _padding, uint32_t _maxSize,
+			std::vector<PackedRect>& _outRects, uint32_t& _outWidth, uint32_t& _outHeight)
+		{
+			assert(_widths.size() == _heights.size()); // Error: Every sprite needs a width and a height.
+
+			const size_t count = _widths.size();
+			std::vector<uint32_t> cellWidths(count), cellHeights(count), order(count);
+			uint64_t area = 0;
+			uint32_t widest = CELL_ALIGNMENT;
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				cellWidths[i] = Align(_widths[i] + 2 * _padding);
+				cellHeights[i] = Align(_heights[i] + 2 * _padding);
+				area += static_cast<uint64_t>(cellWidths[i]) * cellHeights[i];
+				widest = std::max(widest, cellWidths[i]);
+				order[i] = static_cast<uint32_t>(i);
+			}
+
+			// Tallest first, so every shelf is filled with sprites of similar height.
+			std::sort(order.begin(), order.end(), [&](uint32_t _a, uint32_t _b)
+			{
+				if (cellHeights[_a] != cellHeights[_b])
+					return cellHeights[_a] > cellHeights[_b];
+				if (cellWidths[_a] != cellWidths[_b])
+					return cellWidths[_a] > cellWidths[_b];
+				return _a < _b;
+			});
+
+			uint32_t width = CELL_ALIGNMENT;
+			while (width < widest || static_cast<uint64_t>(width) * width < area)
+				width <<= 1;
+
+			std::vector<PackedRect> rects(count);
+			uint64_t bestArea = UINT64_MAX;
+
+			for (; width <= _maxSize; width <<= 1)
+			{
+				uint32_t x = 0, y = 0, shelfHeight = 0;
+
+				for (uint32_t index : order)
+				{
+					if (x + cellWidths[index] > width)
+					{
+						x = 0;
+						y += shelfHeight;
+						shelfHeight = 0;
+					}
+
+					rects[index].x = x + _padding;
+					rects[index].y = y + _padding;
+					x += cellWidths[index];
+					shelfHeight = std::max(shelfHeight, cellHeights[index]);
+				}
+
+				uint32_t height = std::max(y + shelfHeight, CELL_ALIGNMENT);
+
+				if (height <= _maxSize && static_cast<uint64_t>(width) * height < bestArea)
+				{
+					bestArea = static_cast<uint64_t>(width) * height;
+					_outRects = rects;
+					_outWidth = width;
+					_outHeight = height;
+				}
+
+				// Wider atlases only get shorter, and past the first fit the area only grows.
+				if (height <= width)
+					break;
+			}
+
+			return bestArea != UINT64_MAX;
+		}
+	}
+}
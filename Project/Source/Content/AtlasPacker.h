@@ -0,0 +1,42 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: AtlasPacker.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Packs sprites into one atlas for the asset cooker. Sprites are sorted by height and
+		laid out left to right on shelves, trying widths from the smallest power of two that could hold
+		them all, and the atlas with the least area wins. Every cell is padded and aligned to 4 pixels,
+		so no compressed block or filtered sample ever mixes two sprites.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+namespace OC
+{
+	// Where a sprite was placed, in atlas pixels, without its padding.
+	struct PackedRect
+	{
+		uint32_t x, y; // The top-left corner.
+	};
+
+	namespace AtlasPacker
+	{
+		// Description: Packs sprites into the smallest atlas found.
+		// Parameters: 
+		//    const std::vector<uint32_t>& _widths, the width of every sprite, in pixels.
+		//    const std::vector<uint32_t>& _heights, the height of every sprite, in pixels.
+		//    uint32_t _padding, the pixels kept free on every side of a sprite, for its edges to be extruded into.
+		//    uint32_t _maxSize, the largest width or height the atlas may have.
+		//    std::vector<PackedRect>& _outRects, replaced with the position of every sprite, in the order given.
+		//    uint32_t& _outWidth, receives the width of the atlas, a power of two.
+		//    uint32_t& _outHeight, receives the height of the atlas, a multiple of 4.
+		// Returns: false, if the sprites don't fit in _maxSize by _maxSize.
+		bool Pack(const std::vector<uint32_t>& _widths, const std::vector<uint32_t>& _heights, uint32_t _padding, uint32_t _maxSize,
+			std::vector<PackedRect>& _outRects, uint32_t& _outWidth, uint32_t& _outHeight);
+	}
+}
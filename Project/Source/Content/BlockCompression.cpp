@@ -0,0 +1,306 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: BlockCompression.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <string.h>
+#include "BlockCompression.h"
+#include "Image.h"
+#include "../Threading/JobSystem.h"
+
+namespace OC
+{
+	namespace BlockCompression
+	{
+		constexpr uint32_t BLOCK_SIZE = 4; // The width and height of a block, in pixels.
+		constexpr uint32_t BLOCK_PIXELS = BLOCK_SIZE * BLOCK_SIZE; // Pixels per block.
+		constexpr uint32_t ROWS_PER_JOB = 8; // Rows of blocks encoded per job.
+
+		// Description: Copies a 4x4 block out of an image, repeating the last row and column past its edges.
+		// Parameters: 
+		//    const Image& _image, the image.
+		//    uint32_t _blockX, the block's column.
+		//    uint32_t _blockY, the block's row.
+		//    uint8_t* _outPixels, receives 16 pixels of the image's channels, row by row.
+		static void FetchBlock(const Image& _image, uint32_t _blockX, uint32_t _blockY, uint8_t* _outPixels)
+		{
+			const uint32_t channels = _image.channels;
+
+			for (uint32_t y = 0; y < BLOCK_SIZE; ++y)
+			{
+				uint32_t row = _blockY * BLOCK_SIZE + y;
+				if (row >= _image.height)
+					row = _image.height - 1;
+
+				for (uint32_t x = 0; x < BLOCK_SIZE; ++x)
+				{
+					uint32_t column = _blockX * BLOCK_SIZE + x;
+					if (column >= _image.width)
+						column = _image.width - 1;
+
+					memcpy(&_outPixels[(y * BLOCK_SIZE + x) * channels], &_image.pixels[(static_cast<size_t>(row) * _image.width + column) * channels], channels);
+				}
+			}
+		}
+
+		// Description: Packs a color into 5:6:5 bits.
+		// Parameters: 
+		//    const uint8_t* _rgb, the color.
+		// Returns: The packed color.
+		static uint16_t Pack565(const uint8_t* _rgb)
+		{
+			return static_cast<uint16_t>(((_rgb[0] >> 3) << 11) | ((_rgb[1] >> 2) << 5) | (_rgb[2] >> 3));
+		}
+
+		// Description: Expands a 5:6:5 color the way the GPU does.
+		// Parameters: 
+		//    uint16_t _packed, the packed color.
+		//    int32_t* _outRgb, receives the color.
+		static void Unpack565(uint16_t _packed, int32_t* _outRgb)
+		{
+			int32_t red = (_packed >> 11) & 0x1F, green = (_packed >> 5) & 0x3F, blue = _packed & 0x1F;
+			_outRgb[0] = (red << 3) | (red >> 2);
+			_outRgb[1] = (green << 2) | (green >> 4);
+			_outRgb[2] = (blue << 3) | (blue >> 2);
+		}
+
+		// Description: Encodes the color of a block as BC1 in four-color mode.
+		// Parameters: 
+		//    const uint8_t* _pixels, 16 RGBA pixels.
+		//    uint8_t* _destination, receives 8 bytes.
+		static void EncodeColorBlock(const uint8_t* _pixels, uint8_t* _destination)
+		{
+			int32_t minimum[3] = { 255, 255, 255 }, maximum[3] = { 0, 0, 0 }, mean[3] = { 0, 0, 0 };
+
+			for (uint32_t i = 0; i < BLOCK_PIXELS; ++i)
+			{
+				for (uint32_t channel = 0; channel < 3; ++channel)
+				{
+					int32_t value = _pixels[i * 4 + channel];
+					minimum[channel] = value < minimum[channel] ? value : minimum[channel];
+					maximum[channel] = value > maximum[channel] ? value : maximum[channel];
+					mean[channel] += value;
+				}
+			}
+
+			// The bounding box runs from minimum to maximum, but the colors may follow another of its
+			// diagonals. Flip red and blue against green when they vary in opposite directions.
+			int32_t covarianceRed = 0, covarianceBlue = 0;
+
+			for (uint32_t i = 0; i < BLOCK_PIXELS; ++i)
+			{
+				int32_t green = _pixels[i * 4 + 1] * 16 - mean[1];
+				covarianceRed += (_pixels[i * 4] * 16 - mean[0]) * green;
+				covarianceBlue += (_pixels[i * 4 + 2] * 16 - mean[2]) * green;
+			}
+
+			if (covarianceRed < 0)
+			{
+				int32_t swap = minimum[0];
+				minimum[0] = maximum[0];
+				maximum[0] = swap;
+			}
+
+			if (covarianceBlue < 0)
+			{
+				int32_t swap = minimum[2];
+				minimum[2] = maximum[2];
+				maximum[2] = swap;
+			}
+
+			// Inset by 1/16 of the range, so the endpoints sit on the colors rather than past them.
+			uint8_t endpoints[2][3];
+
+			for (uint32_t channel = 0; channel < 3; ++channel)
+			{
+				int32_t inset = (maximum[channel] - minimum[channel]) / 16;
+				endpoints[0][channel] = static_cast<uint8_t>(maximum[channel] - inset);
+				endpoints[1][channel] = static_cast<uint8_t>(minimum[channel] + inset);
+			}
+
+			uint16_t color0 = Pack565(endpoints[0]), color1 = Pack565(endpoints[1]);
+
+			// Four-color mode needs color0 above color1. Swapping endpoints only changes the indices.
+			if (color0 < color1)
+			{
+				uint16_t swap = color0;
+				color0 = color1;
+				color1 = swap;
+			}
+
+			uint32_t indices = 0;
+
+			if (color0 != color1)
+			{
+				int32_t palette[4][3];
+				Unpack565(color0, palette[0]);
+				Unpack565(color1, palette[1]);
+
+				for (uint32_t channel = 0; channel < 3; ++channel)
+				{
+					palette[2][channel] = (2 * palette[0][channel] + palette[1][channel]) / 3;
+					palette[3][channel] = (palette[0][channel] + 2 * palette[1][channel]) / 3;
+				}
+
+				for (uint32_t i = 0; i < BLOCK_PIXELS; ++i)
+				{
+					uint32_t best = 0;
+					int32_t bestDistance = INT32_MAX;
+
+					for (uint32_t entry = 0; entry < 4; ++entry)
+					{
+						int32_t red = _pixels[i * 4] - palette[entry][0];
+						int32_t green = _pixels[i * 4 + 1] - palette[entry][1];
+						int32_t blue = _pixels[i * 4 + 2] - palette[entry][2];
+						int32_t distance = red * red + green * green + blue * blue;
+
+						if (distance < bestDistance)
+						{
+							bestDistance = distance;
+							best = entry;
+						}
+					}
+
+					indices |= best << (i * 2);
+				}
+			}
+
+			_destination[0] = static_cast<uint8_t>(color0);
+			_destination[1] = static_cast<uint8_t>(color0 >> 8);
+			_destination[2] = static_cast<uint8_t>(color1);
+			_destination[3] = static_cast<uint8_t>(color1 >> 8);
+			memcpy(&_destination[4], &indices, sizeof(indices));
+		}
+
+		// Description: Encodes one channel of a block as BC4 in eight-value mode.
+		// Parameters: 
+		//    const uint8_t* _pixels, 16 pixels.
+		//    uint32_t _stride, the bytes between pixels.
+		//    uint8_t* _destination, receives 8 bytes.
+		static void EncodeChannelBlock(const uint8_t* _pixels, uint32_t _stride, uint8_t* _destination)
+		{
+			int32_t minimum = 255, maximum = 0;
+
+			for (uint32_t i = 0; i < BLOCK_PIXELS; ++i)
+			{
+				int32_t value = _pixels[i * _stride];
+				minimum = value < minimum ? value : minimum;
+				maximum = value > maximum ? value : maximum;
+			}
+
+			_destination[0] = static_cast<uint8_t>(maximum);
+			_destination[1] = static_cast<uint8_t>(minimum);
+			uint64_t indices = 0;
+
+			if (maximum != minimum)
+			{
+				// Entry 0 is the maximum, 1 the minimum, and 2 to 7 step from the maximum to the minimum.
+				int32_t palette[8] = { maximum, minimum };
+				for (int32_t entry = 1; entry < 7; ++entry)
+					palette[entry + 1] = ((7 - entry) * maximum + entry * minimum) / 7;
+
+				for (uint32_t i = 0; i < BLOCK_PIXELS; ++i)
+				{
+					int32_t value = _pixels[i * _stride];
+					uint64_t best = 0;
+					int32_t bestDistance = INT32_MAX;
+
+					for (uint32_t entry = 0; entry < 8; ++entry)
+					{
+						int32_t distance = value > palette[entry] ? value - palette[entry] : palette[entry] - value;
+
+						if (distance < bestDistance)
+						{
+							bestDistance = distance;
+							best = entry;
+						}
+					}
+
+					indices |= best << (i * 3);
+				}
+			}
+
+			for (uint32_t i = 0; i < 6; ++i)
+				_destination[2 + i] = static_cast<uint8_t>(indices >> (i * 8));
+		}
+
+		size_t GetLevelSize(CookedFormat _format, uint32_t _width, uint32_t _height)
+		{
+			size_t blocks = static_cast<size_t>((_width + BLOCK_SIZE - 1) / BLOCK_SIZE) * ((_height + BLOCK_SIZE - 1) / BLOCK_SIZE);
+
+			switch (_format)
+			{
+			case CookedFormat::RGBA8:
+				return static_cast<size_t>(_width) * _height * 4;
+			case CookedFormat::R8:
+				return static_cast<size_t>(_width) * _height;
+			case CookedFormat::BC1:
+			case CookedFormat::BC4:
+				return blocks * 8;
+			case CookedFormat::BC3:
+				return blocks * 16;
+			default:
+				assert(false); // Error: Invalid format.
+				return 0;
+			}
+		}
+
+		void Encode(const Image& _image, CookedFormat _format, uint8_t* _destination, JobSystem* _jobs)
+		{
+			const bool grayscale = _format == CookedFormat::R8 || _format == CookedFormat::BC4;
+			assert(_image.channels == (grayscale ? 1u : 4u)); // Error: The image has the wrong number of channels for the format.
+			(void)grayscale;
+
+			if (_format == CookedFormat::RGBA8 || _format == CookedFormat::R8)
+			{
+				memcpy(_destination, _image.pixels.data(), _image.pixels.size());
+				return;
+			}
+
+			const uint32_t blocksWide = (_image.width + BLOCK_SIZE - 1) / BLOCK_SIZE;
+			const uint32_t blocksHigh = (_image.height + BLOCK_SIZE - 1) / BLOCK_SIZE;
+			const uint32_t blockBytes = _format == CookedFormat::BC3 ? 16 : 8;
+
+			// Every block is independent, so rows can be encoded in any order.
+			auto encodeRows = [&](uint32_t _begin, uint32_t _end)
+			{
+				uint8_t pixels[BLOCK_PIXELS * 4];
+
+				for (uint32_t blockY = _begin; blockY < _end; ++blockY)
+				{
+					uint8_t* destination = _destination + static_cast<size_t>(blockY) * blocksWide * blockBytes;
+
+					for (uint32_t blockX = 0; blockX < blocksWide; ++blockX, destination += blockBytes)
+					{
+						FetchBlock(_image, blockX, blockY, pixels);
+
+						switch (_format)
+						{
+						case CookedFormat::BC1:
+							EncodeColorBlock(pixels, destination);
+							break;
+						case CookedFormat::BC3:
+							EncodeChannelBlock(pixels + 3, 4, destination);
+							EncodeColorBlock(pixels, destination + 8);
+							break;
+						default:
+							EncodeChannelBlock(pixels, 1, destination);
+							break;
+						}
+					}
+				}
+			};
+
+			if (_jobs && blocksHigh > ROWS_PER_JOB)
+				_jobs->ParallelFor(blocksHigh, ROWS_PER_JOB, encodeRows);
+			else
+				encodeRows(0, blocksHigh);
+		}
+	}
+}
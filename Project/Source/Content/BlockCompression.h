@@ -0,0 +1,45 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: BlockCompression.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: CPU encoders for the block-compressed formats the renderer samples: BC1 for opaque
+		color, BC3 for color with alpha and BC4 for one channel. Endpoints come from the bounding box of
+		each 4x4 block, inset slightly and flipped along the diagonal that best fits the colors, then
+		every pixel picks its nearest palette entry. That trades a little quality against an exhaustive
+		search for speed that keeps full content rebuilds short. Edge blocks of sizes that aren't a
+		multiple of 4 repeat their last row and column.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "CookedTexture.h"
+
+namespace OC
+{
+	class JobSystem;
+	struct Image;
+
+	namespace BlockCompression
+	{
+		// Description: Returns the size of a mip level in a format.
+		// Parameters: 
+		//    CookedFormat _format, the format.
+		//    uint32_t _width, the width of the level, in pixels.
+		//    uint32_t _height, the height of the level, in pixels.
+		// Returns: The size, in bytes.
+		size_t GetLevelSize(CookedFormat _format, uint32_t _width, uint32_t _height);
+
+		// Description: Encodes an image into a format.
+		// Parameters: 
+		//    const Image& _image, the image. RGBA for RGBA8, BC1 and BC3, grayscale for R8 and BC4.
+		//    CookedFormat _format, the format to encode into.
+		//    uint8_t* _destination, receives GetLevelSize bytes.
+		//    JobSystem* _jobs, splits the rows of blocks across workers when given. Safe to pass from inside a job.
+		void Encode(const Image& _image, CookedFormat _format, uint8_t* _destination, JobSystem* _jobs = nullptr);
+	}
+}
@@ -0,0 +1,73 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: CookedTexture.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: The runtime layout of a texture produced by the asset cooker. A header is followed by
+		the sprites of an atlas, if the texture is one, then every mip level from largest to smallest,
+		each already in the format the GPU samples, so loading is one read and one upload per level.
+		The header records a hash of the sources and settings the texture was cooked from, which the
+		cooker compares to skip assets that haven't changed. The layout is little-endian and is read in
+		place, so every struct here is plain data with a fixed size.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <type_traits>
+
+namespace OC
+{
+	enum class CookedFormat : uint8_t
+	{
+		RGBA8, // 4 bytes per pixel, red first.
+		R8, // 1 byte per pixel.
+		BC1, // 8 bytes per 4x4 block. Opaque color.
+		BC3, // 16 bytes per 4x4 block. Color with alpha.
+		BC4, // 8 bytes per 4x4 block. One channel, for masks and height maps.
+		_COUNT
+	};
+
+	constexpr uint32_t COOKED_TEXTURE_MAGIC = 0x58544F43; // "OCTX" in little-endian.
+	constexpr uint16_t COOKED_TEXTURE_VERSION = 1; // Bumped whenever a struct, the layout or an encoder changes.
+	constexpr uint32_t COOKED_MAX_MIPS = 16; // Enough for a 32768 pixel texture.
+	constexpr uint32_t COOKED_ALIGNMENT = 16; // Every mip level starts on this boundary.
+	constexpr uint32_t COOKED_SPRITE_NAME_LENGTH = 32; // Bytes per sprite name, including the terminating zero.
+
+	// Where one mip level is in the file.
+	struct CookedMip
+	{
+		uint32_t offset; // Bytes from the start of the file to the level.
+		uint32_t size; // The size of the level, in bytes.
+	};
+
+	// A named rectangle of an atlas, in pixels of the largest mip level.
+	struct CookedSprite
+	{
+		char name[COOKED_SPRITE_NAME_LENGTH]; // The source file's name without its extension.
+		uint16_t x, y; // The top-left corner.
+		uint16_t width, height; // The size, without the padding around it.
+	};
+
+	struct CookedTextureHeader
+	{
+		uint32_t magic; // COOKED_TEXTURE_MAGIC.
+		uint16_t version; // COOKED_TEXTURE_VERSION.
+		CookedFormat format; // The format of every mip level.
+		uint8_t mipCount; // The number of mip levels, at most COOKED_MAX_MIPS.
+		uint32_t width, height; // The size of the largest mip level, in pixels.
+		uint64_t sourceHash; // The hash of everything the texture was cooked from.
+		uint32_t fileSize; // The size of the whole file, in bytes.
+		uint32_t spriteCount; // The number of sprites. 0 unless the texture is an atlas.
+		uint32_t spriteOffset; // Bytes from the start of the file to the first CookedSprite.
+		uint32_t padding; // Keeps the mips 8-byte aligned. Always 0.
+		CookedMip mips[COOKED_MAX_MIPS]; // One per mip level, largest first. Unused ones are 0.
+	};
+
+	static_assert(sizeof(CookedSprite) == 40 && sizeof(CookedTextureHeader) == 168,
+		"Open Conquer Error: Changing a cooked struct's size changes the file format. Bump COOKED_TEXTURE_VERSION.");
+	static_assert(std::is_trivially_copyable<CookedTextureHeader>::value && std::is_trivially_copyable<CookedSprite>::value,
+		"Open Conquer Error: Cooked textures are read in place and must be plain data.");
+}
@@ -0,0 +1,410 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Image.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <ctype.h>
+#include <string.h>
+#include "Image.h"
+#include "../Serialization/Crc32.h"
+#include "../Serialization/Deflate.h"
+
+namespace OC
+{
+	namespace ImageFile
+	{
+		constexpr uint32_t MAX_IMAGE_SIZE = 32768; // The largest width or height accepted, matching COOKED_MAX_MIPS.
+		constexpr size_t TGA_HEADER_SIZE = 18; // The fixed part of a TGA header.
+
+		// Description: Appends a big-endian 32-bit value, as PNG stores them.
+		// Parameters: 
+		//    uint32_t _value, the value.
+		//    std::vector<uint8_t>& _out, the bytes to append to.
+		static void WriteBigEndian(uint32_t _value, std::vector<uint8_t>& _out)
+		{
+			const uint8_t bytes[4] = { static_cast<uint8_t>(_value >> 24), static_cast<uint8_t>(_value >> 16), static_cast<uint8_t>(_value >> 8), static_cast<uint8_t>(_value) };
+			_out.insert(_out.end(), bytes, bytes + 4);
+		}
+
+		// Description: Appends a PNG chunk: its length, type, data and the CRC of the type and data.
+		// Parameters: 
+		//    const char* _type, the 4-letter type.
+		//    const uint8_t* _data, the data.
+		//    size_t _size, the size of the data.
+		//    std::vector<uint8_t>& _out, the bytes to append to.
+		static void WritePngChunk(const char* _type, const uint8_t* _data, size_t _size, std::vector<uint8_t>& _out)
+		{
+			WriteBigEndian(static_cast<uint32_t>(_size), _out);
+			_out.insert(_out.end(), _type, _type + 4);
+			_out.insert(_out.end(), _data, _data + _size);
+			WriteBigEndian(Crc32(_data, _size, Crc32(_type, 4)), _out);
+		}
+
+		// Description: Reads a TGA image.
+		// Parameters: 
+		//    const uint8_t* _data, the file's bytes.
+		//    size_t _size, the number of bytes.
+		//    Image& _outImage, replaced with the image.
+		//    std::string& _outError, receives why the image couldn't be decoded.
+		// Returns: true, if the image was decoded.
+		static bool DecodeTga(const uint8_t* _data, size_t _size, Image& _outImage, std::string& _outError)
+		{
+			if (_size < TGA_HEADER_SIZE)
+			{
+				_outError = "truncated TGA header";
+				return false;
+			}
+
+			uint8_t idLength = _data[0];
+			uint8_t colorMapType = _data[1];
+			uint8_t imageType = _data[2];
+			uint32_t width = _data[12] | (_data[13] << 8);
+			uint32_t height = _data[14] | (_data[15] << 8);
+			uint32_t bitsPerPixel = _data[16];
+			uint8_t descriptor = _data[17];
+
+			// 2 and 3 are uncompressed color and grayscale, 10 and 11 their run-length encoded versions.
+			bool encoded = imageType == 10 || imageType == 11;
+			bool grayscale = imageType == 3 || imageType == 11;
+
+			if (colorMapType != 0 || (imageType != 2 && imageType != 3 && !encoded))
+			{
+				_outError = "unsupported TGA type, only true color and grayscale are";
+				return false;
+			}
+
+			if (grayscale ? bitsPerPixel != 8 : bitsPerPixel != 24 && bitsPerPixel != 32)
+			{
+				_outError = "unsupported TGA pixel depth";
+				return false;
+			}
+
+			if (width == 0 || height == 0 || width > MAX_IMAGE_SIZE || height > MAX_IMAGE_SIZE)
+			{
+				_outError = "unsupported TGA size";
+				return false;
+			}
+
+			uint32_t bytesPerPixel = bitsPerPixel / 8;
+			size_t pixelCount = static_cast<size_t>(width) * height;
+			const uint8_t* read = _data + TGA_HEADER_SIZE + idLength;
+			const uint8_t* end = _data + _size;
+
+			if (read > end)
+			{
+				_outError = "truncated TGA header";
+				return false;
+			}
+
+			// Unpack to the file's own pixel format first, then convert.
+			std::vector<uint8_t> raw(pixelCount * bytesPerPixel);
+
+			if (!encoded)
+			{
+				if (static_cast<size_t>(end - read) < raw.size())
+				{
+					_outError = "truncated TGA pixels";
+					return false;
+				}
+
+				memcpy(raw.data(), read, raw.size());
+			}
+			else
+			{
+				size_t written = 0;
+
+				while (written < pixelCount)
+				{
+					if (read >= end)
+					{
+						_outError = "truncated TGA pixels";
+						return false;
+					}
+
+					uint8_t packet = *read++;
+					size_t count = (packet & 0x7F) + 1u;
+					size_t bytes = (packet & 0x80) ? bytesPerPixel : count * bytesPerPixel;
+
+					if (count > pixelCount - written || static_cast<size_t>(end - read) < bytes)
+					{
+						_outError = "corrupt TGA run";
+						return false;
+					}
+
+					if (packet & 0x80)
+					{
+						for (size_t i = 0; i < count; ++i)
+							memcpy(&raw[(written + i) * bytesPerPixel], read, bytesPerPixel);
+					}
+					else
+					{
+						memcpy(&raw[written * bytesPerPixel], read, bytes);
+					}
+
+					read += bytes;
+					written += count;
+				}
+			}
+
+			// Rows are stored bottom-up unless bit 5 of the descriptor says otherwise. Right-to-left isn't used.
+			bool topDown = (descriptor & 0x20) != 0;
+			_outImage.width = width;
+			_outImage.height = height;
+			_outImage.channels = grayscale ? 1 : 4;
+			_outImage.pixels.resize(pixelCount * _outImage.channels);
+
+			for (uint32_t y = 0; y < height; ++y)
+			{
+				const uint8_t* source = &raw[static_cast<size_t>(topDown ? y : height - 1 - y) * width * bytesPerPixel];
+				uint8_t* destination = &_outImage.pixels[static_cast<size_t>(y) * width * _outImage.channels];
+
+				if (grayscale)
+				{
+					memcpy(destination, source, width);
+					continue;
+				}
+
+				// Stored as BGR or BGRA.
+				for (uint32_t x = 0; x < width; ++x, source += bytesPerPixel, destination += 4)
+				{
+					destination[0] = source[2];
+					destination[1] = source[1];
+					destination[2] = source[0];
+					destination[3] = bytesPerPixel == 4 ? source[3] : 0xFF;
+				}
+			}
+
+			return true;
+		}
+
+		// Description: Reads the next number of a PNM header, skipping whitespace and comments.
+		// Parameters: 
+		//    const uint8_t*& _read, the position to read from. Moved past the number.
+		//    const uint8_t* _end, the end of the file.
+		//    uint32_t& _outValue, receives the number.
+		// Returns: true, if a number was read.
+		static bool ReadPnmNumber(const uint8_t*& _read, const uint8_t* _end, uint32_t& _outValue)
+		{
+			while (_read < _end && (isspace(*_read) || *_read == '#'))
+			{
+				if (*_read == '#')
+					while (_read < _end && *_read != '\n')
+						++_read;
+				else
+					++_read;
+			}
+
+			if (_read >= _end || !isdigit(*_read))
+				return false;
+
+			uint64_t value = 0;
+			while (_read < _end && isdigit(*_read) && value <= UINT32_MAX)
+				value = value * 10 + (*_read++ - '0');
+
+			if (value > UINT32_MAX)
+				return false;
+
+			_outValue = static_cast<uint32_t>(value);
+			return true;
+		}
+
+		// Description: Reads a binary PGM (P5) or PPM (P6) image with 8 bits per channel.
+		// Parameters: 
+		//    const uint8_t* _data, the file's bytes.
+		//    size_t _size, the number of bytes.
+		//    Image& _outImage, replaced with the image.
+		//    std::string& _outError, receives why the image couldn't be decoded.
+		// Returns: true, if the image was decoded.
+		static bool DecodePnm(const uint8_t* _data, size_t _size, Image& _outImage, std::string& _outError)
+		{
+			bool grayscale = _data[1] == '5';
+			const uint8_t* read = _data + 2;
+			const uint8_t* end = _data + _size;
+			uint32_t width, height, maximum;
+
+			if (!ReadPnmNumber(read, end, width) || !ReadPnmNumber(read, end, height) || !ReadPnmNumber(read, end, maximum))
+			{
+				_outError = "corrupt PNM header";
+				return false;
+			}
+
+			if (maximum != 255)
+			{
+				_outError = "unsupported PNM depth, only 8 bits per channel is";
+				return false;
+			}
+
+			if (width == 0 || height == 0 || width > MAX_IMAGE_SIZE || height > MAX_IMAGE_SIZE)
+			{
+				_outError = "unsupported PNM size";
+				return false;
+			}
+
+			// Exactly one whitespace character separates the header from the pixels.
+			++read;
+			size_t pixelCount = static_cast<size_t>(width) * height;
+			size_t bytes = pixelCount * (grayscale ? 1 : 3);
+
+			if (read > end || static_cast<size_t>(end - read) < bytes)
+			{
+				_outError = "truncated PNM pixels";
+				return false;
+			}
+
+			_outImage.width = width;
+			_outImage.height = height;
+			_outImage.channels = grayscale ? 1 : 4;
+			_outImage.pixels.resize(pixelCount * _outImage.channels);
+
+			if (grayscale)
+			{
+				memcpy(_outImage.pixels.data(), read, bytes);
+				return true;
+			}
+
+			uint8_t* destination = _outImage.pixels.data();
+			for (size_t i = 0; i < pixelCount; ++i, read += 3, destination += 4)
+			{
+				destination[0] = read[0];
+				destination[1] = read[1];
+				destination[2] = read[2];
+				destination[3] = 0xFF;
+			}
+
+			return true;
+		}
+
+		bool Decode(const uint8_t* _data, size_t _size, Image& _outImage, std::string& _outError)
+		{
+			assert(_data || _size == 0); // Error: No data.
+
+			// PNM files start with "P5" or "P6". TGA has no signature, so anything else is tried as one.
+			if (_size >= 2 && _data[0] == 'P' && (_data[1] == '5' || _data[1] == '6'))
+				return DecodePnm(_data, _size, _outImage, _outError);
+
+			return DecodeTga(_data, _size, _outImage, _outError);
+		}
+
+		bool IsSupportedExtension(const std::string& _extension)
+		{
+			std::string lower = _extension;
+			for (char& character : lower)
+				character = static_cast<char>(tolower(static_cast<unsigned char>(character)));
+
+			return lower == ".tga" || lower == ".pgm" || lower == ".ppm";
+		}
+
+		void Downsample(const Image& _source, Image& _outMip)
+		{
+			assert(_source.channels == 1 || _source.channels == 4); // Error: Unsupported channel count.
+
+			const uint32_t width = _source.width > 1 ? _source.width / 2 : 1;
+			const uint32_t height = _source.height > 1 ? _source.height / 2 : 1;
+			const uint32_t channels = _source.channels;
+
+			_outMip.width = width;
+			_outMip.height = height;
+			_outMip.channels = channels;
+			_outMip.pixels.resize(static_cast<size_t>(width) * height * channels);
+
+			// Odd sizes fold the last row or column into the one before it.
+			const uint32_t lastX = _source.width - 1, lastY = _source.height - 1;
+
+			for (uint32_t y = 0; y < height; ++y)
+			{
+				const uint32_t rows[2] = { 2 * y < lastY ? 2 * y : lastY, 2 * y + 1 < lastY ? 2 * y + 1 : lastY };
+				uint8_t* destination = &_outMip.pixels[static_cast<size_t>(y) * width * channels];
+
+				for (uint32_t x = 0; x < width; ++x, destination += channels)
+				{
+					const uint32_t columns[2] = { 2 * x < lastX ? 2 * x : lastX, 2 * x + 1 < lastX ? 2 * x + 1 : lastX };
+					const uint8_t* samples[4];
+
+					for (uint32_t i = 0; i < 4; ++i)
+						samples[i] = &_source.pixels[(static_cast<size_t>(rows[i / 2]) * _source.width + columns[i % 2]) * channels];
+
+					if (channels == 1)
+					{
+						destination[0] = static_cast<uint8_t>((samples[0][0] + samples[1][0] + samples[2][0] + samples[3][0] + 2) / 4);
+						continue;
+					}
+
+					uint32_t alpha = samples[0][3] + samples[1][3] + samples[2][3] + samples[3][3];
+					destination[3] = static_cast<uint8_t>((alpha + 2) / 4);
+
+					for (uint32_t channel = 0; channel < 3; ++channel)
+					{
+						if (alpha == 0)
+						{
+							destination[channel] = static_cast<uint8_t>((samples[0][channel] + samples[1][channel] + samples[2][channel] + samples[3][channel] + 2) / 4);
+							continue;
+						}
+
+						uint32_t weighted = 0;
+						for (uint32_t i = 0; i < 4; ++i)
+							weighted += samples[i][channel] * samples[i][3];
+
+						destination[channel] = static_cast<uint8_t>((weighted + alpha / 2) / alpha);
+					}
+				}
+			}
+		}
+
+		void EncodePng(const Image& _image, std::vector<uint8_t>& _outData)
+		{
+			assert(_image.channels == 1 || _image.channels == 4); // Error: Unsupported channel count.
+			assert(_image.width > 0 && _image.height > 0); // Error: PNG images can't be empty.
+
+			constexpr uint8_t FILTER_SUB = 1; // Each byte less the same channel of the pixel to its left.
+			constexpr uint8_t FILTER_UP = 2; // Each byte less the one above it.
+
+			const uint32_t channels = _image.channels;
+			const size_t stride = static_cast<size_t>(_image.width) * channels;
+			std::vector<uint8_t> filtered((stride + 1) * _image.height);
+			std::vector<uint8_t> sub(stride), up(stride);
+
+			for (uint32_t y = 0; y < _image.height; ++y)
+			{
+				const uint8_t* row = &_image.pixels[y * stride];
+				const uint8_t* above = y > 0 ? row - stride : nullptr;
+				uint32_t subCost = 0, upCost = 0;
+
+				// Small differences either way cost less, so each byte counts as its distance from 0.
+				for (size_t i = 0; i < stride; ++i)
+				{
+					sub[i] = static_cast<uint8_t>(row[i] - (i >= channels ? row[i - channels] : 0));
+					up[i] = static_cast<uint8_t>(row[i] - (above ? above[i] : 0));
+					subCost += sub[i] < 128 ? sub[i] : 256 - sub[i];
+					upCost += up[i] < 128 ? up[i] : 256 - up[i];
+				}
+
+				uint8_t* destination = &filtered[y * (stride + 1)];
+				destination[0] = upCost < subCost ? FILTER_UP : FILTER_SUB;
+				memcpy(destination + 1, upCost < subCost ? up.data() : sub.data(), stride);
+			}
+
+			std::vector<uint8_t> compressed;
+			Deflate::Compress(filtered.data(), filtered.size(), compressed);
+
+			// 8 bits per channel, RGBA or grayscale, no interlacing.
+			std::vector<uint8_t> header;
+			WriteBigEndian(_image.width, header);
+			WriteBigEndian(_image.height, header);
+			const uint8_t format[5] = { 8, static_cast<uint8_t>(channels == 4 ? 6 : 0), 0, 0, 0 };
+			header.insert(header.end(), format, format + 5);
+
+			static const uint8_t SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+			_outData.assign(SIGNATURE, SIGNATURE + 8);
+			_outData.reserve(8 + 25 + compressed.size() + 12 + 12);
+			WritePngChunk("IHDR", header.data(), header.size(), _outData);
+			WritePngChunk("IDAT", compressed.data(), compressed.size(), _outData);
+			WritePngChunk("IEND", nullptr, 0, _outData);
+		}
+	}
+}
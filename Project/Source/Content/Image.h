@@ -0,0 +1,62 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Image.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Uncompressed source images for the asset cooker. Decodes the formats every paint and
+		terrain tool can save without needing a library: Truevision TGA (uncompressed or run-length
+		encoded, 8, 24 or 32 bits) and binary PGM/PPM. Grayscale images stay one channel, so masks and
+		height maps cook to single-channel textures. Also builds mip levels, and encodes PNG files for
+		screenshots and captured frames.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace OC
+{
+	struct Image
+	{
+		uint32_t width, height; // The size, in pixels.
+		uint32_t channels; // 1 for grayscale, 4 for RGBA.
+		std::vector<uint8_t> pixels; // Row by row from the top, channels interleaved.
+	};
+
+	namespace ImageFile
+	{
+		// Description: Decodes a TGA, PGM or PPM image from memory, telling them apart by content.
+		// Parameters: 
+		//    const uint8_t* _data, the file's bytes.
+		//    size_t _size, the number of bytes.
+		//    Image& _outImage, replaced with the image. Color images are expanded to RGBA.
+		//    std::string& _outError, receives why the image couldn't be decoded, if it couldn't.
+		// Returns: true, if the image was decoded.
+		bool Decode(const uint8_t* _data, size_t _size, Image& _outImage, std::string& _outError);
+
+		// Description: Returns if a file name has an extension Decode understands.
+		// Parameters: 
+		//    const std::string& _extension, the extension, with its dot, in any case.
+		// Returns: true, for .tga, .pgm and .ppm.
+		bool IsSupportedExtension(const std::string& _extension);
+
+		// Description: Builds the next mip level, half the size rounded down but never below 1. Color
+		//    is weighted by alpha, so transparent pixels never darken the edges of what they surround.
+		// Parameters: 
+		//    const Image& _source, the level to shrink.
+		//    Image& _outMip, replaced with the smaller level.
+		void Downsample(const Image& _source, Image& _outMip);
+
+		// Description: Encodes an image as a PNG. Each row is filtered by whichever of Sub and Up leaves
+		//    smaller differences, then everything is compressed with Deflate.
+		// Parameters: 
+		//    const Image& _image, the image. Grayscale or RGBA.
+		//    std::vector<uint8_t>& _outData, replaced with the file's bytes.
+		void EncodePng(const Image& _image, std::vector<uint8_t>& _outData);
+	}
+}
@@ -0,0 +1,256 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: LooseQuadtree.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <assert.h>
+#include <math.h>
+#include "LooseQuadtree.h"
+
+namespace OC
+{
+	// private
+
+	uint32_t LooseQuadtree::LevelOf(uint32_t _node) const
+	{
+		uint32_t level = 0;
+
+		while (level + 1 < m_Depth && _node >= LevelOffset(level + 1))
+			++level;
+
+		return level;
+	}
+
+	uint32_t LooseQuadtree::FindNode(const Rect& _bounds) const
+	{
+		const float size = std::max(_bounds.Width(), _bounds.Height());
+		const float centreX = (_bounds.minX + _bounds.maxX) * 0.5f;
+		const float centreY = (_bounds.minY + _bounds.maxY) * 0.5f;
+
+		// The deepest level whose nodes are at least as big as the object. A node's loose bounds reach
+		// half a node past each edge, so any such object centred in the node fits inside them.
+		uint32_t level = 0;
+
+		while (level + 1 < m_Depth && m_RootSize / static_cast<float>(1U << (level + 1)) >= size)
+			++level;
+
+		// Objects hanging off the edge of the map may not fit. Move them up until they do.
+		for (;; --level)
+		{
+			const uint32_t cells = 1U << level;
+			const float nodeSize = m_RootSize / static_cast<float>(cells);
+			const uint32_t x = static_cast<uint32_t>(std::min(std::max((centreX - m_Bounds.minX) / nodeSize, 0.0f), static_cast<float>(cells - 1)));
+			const uint32_t y = static_cast<uint32_t>(std::min(std::max((centreY - m_Bounds.minY) / nodeSize, 0.0f), static_cast<float>(cells - 1)));
+
+			if (level == 0 || LooseBounds(level, x, y).Contains(_bounds))
+				return LevelOffset(level) + y * cells + x;
+		}
+	}
+
+	Rect LooseQuadtree::LooseBounds(uint32_t _level, uint32_t _x, uint32_t _y) const
+	{
+		const float nodeSize = m_RootSize / static_cast<float>(1U << _level);
+		const float minX = m_Bounds.minX + _x * nodeSize;
+		const float minY = m_Bounds.minY + _y * nodeSize;
+		const float slack = nodeSize * 0.5f;
+
+		return Rect{ minX - slack, minY - slack, minX + nodeSize + slack, minY + nodeSize + slack };
+	}
+
+	void LooseQuadtree::Link(CullHandle _object, uint32_t _node)
+	{
+		const uint32_t head = m_NodeHead[_node];
+
+		m_ObjectNode[_object] = _node;
+		m_ObjectPrevious[_object] = INVALID_CULL_HANDLE;
+		m_ObjectNext[_object] = head;
+
+		if (head != INVALID_CULL_HANDLE)
+			m_ObjectPrevious[head] = _object;
+
+		m_NodeHead[_node] = _object;
+
+		// Count the object in the node and every node above it.
+		uint32_t level = LevelOf(_node);
+		uint32_t index = _node - LevelOffset(level);
+		uint32_t x = index & ((1U << level) - 1);
+		uint32_t y = index >> level;
+
+		for (;; --level, x >>= 1, y >>= 1)
+		{
+			++m_NodeSubtreeCount[LevelOffset(level) + (y << level) + x];
+
+			if (level == 0)
+				break;
+		}
+	}
+
+	void LooseQuadtree::Unlink(CullHandle _object)
+	{
+		const uint32_t node = m_ObjectNode[_object];
+		const uint32_t previous = m_ObjectPrevious[_object];
+		const uint32_t next = m_ObjectNext[_object];
+
+		if (previous != INVALID_CULL_HANDLE)
+			m_ObjectNext[previous] = next;
+		else
+			m_NodeHead[node] = next;
+
+		if (next != INVALID_CULL_HANDLE)
+			m_ObjectPrevious[next] = previous;
+
+		m_ObjectNode[_object] = INVALID_CULL_HANDLE;
+
+		uint32_t level = LevelOf(node);
+		uint32_t index = node - LevelOffset(level);
+		uint32_t x = index & ((1U << level) - 1);
+		uint32_t y = index >> level;
+
+		for (;; --level, x >>= 1, y >>= 1)
+		{
+			--m_NodeSubtreeCount[LevelOffset(level) + (y << level) + x];
+
+			if (level == 0)
+				break;
+		}
+	}
+
+	void LooseQuadtree::CollectAll(uint32_t _level, uint32_t _x, uint32_t _y, std::vector<uint32_t>& _outUserData) const
+	{
+		const uint32_t node = LevelOffset(_level) + (_y << _level) + _x;
+
+		if (m_NodeSubtreeCount[node] == 0)
+			return;
+
+		for (uint32_t object = m_NodeHead[node]; object != INVALID_CULL_HANDLE; object = m_ObjectNext[object])
+			_outUserData.push_back(m_ObjectUserData[object]);
+
+		if (_level + 1 < m_Depth)
+		{
+			for (uint32_t child = 0; child < 4; ++child)
+				CollectAll(_level + 1, (_x << 1) | (child & 1), (_y << 1) | (child >> 1), _outUserData);
+		}
+	}
+
+	void LooseQuadtree::Collect(uint32_t _level, uint32_t _x, uint32_t _y, const Rect& _area, std::vector<uint32_t>& _outUserData) const
+	{
+		const uint32_t node = LevelOffset(_level) + (_y << _level) + _x;
+
+		if (m_NodeSubtreeCount[node] == 0)
+			return;
+
+		// The root also holds the objects that don't fit anywhere else, so it's always checked.
+		if (_level > 0)
+		{
+			const Rect loose = LooseBounds(_level, _x, _y);
+
+			if (!loose.Overlaps(_area))
+				return;
+
+			// Everything in a node that's completely visible is visible too.
+			if (_area.Contains(loose))
+			{
+				CollectAll(_level, _x, _y, _outUserData);
+				return;
+			}
+		}
+
+		for (uint32_t object = m_NodeHead[node]; object != INVALID_CULL_HANDLE; object = m_ObjectNext[object])
+		{
+			if (m_ObjectBounds[object].Overlaps(_area))
+				_outUserData.push_back(m_ObjectUserData[object]);
+		}
+
+		if (_level + 1 < m_Depth)
+		{
+			for (uint32_t child = 0; child < 4; ++child)
+				Collect(_level + 1, (_x << 1) | (child & 1), (_y << 1) | (child >> 1), _area, _outUserData);
+		}
+	}
+
+	// public
+
+	LooseQuadtree::LooseQuadtree(const Rect& _bounds, uint32_t _depth) :
+		m_Bounds(_bounds),
+		m_RootSize(std::max(_bounds.Width(), _bounds.Height())),
+		m_Depth(_depth),
+		m_Count(0),
+		m_NodeHead(LevelOffset(_depth), INVALID_CULL_HANDLE),
+		m_NodeSubtreeCount(LevelOffset(_depth), 0),
+		m_ObjectBounds(), m_ObjectUserData(), m_ObjectNode(),
+		m_ObjectPrevious(), m_ObjectNext(),
+		m_FreeObjects()
+	{
+		assert(_depth >= 1 && _depth <= 12); // Error: Depth out of range.
+		assert(m_RootSize > 0.0f); // Error: The quadtree must cover an area.
+	}
+
+	CullHandle LooseQuadtree::Insert(const Rect& _bounds, uint32_t _userData)
+	{
+		CullHandle object;
+
+		if (!m_FreeObjects.empty())
+		{
+			object = m_FreeObjects.back();
+			m_FreeObjects.pop_back();
+		}
+		else
+		{
+			object = static_cast<CullHandle>(m_ObjectNode.size());
+			m_ObjectBounds.push_back(_bounds);
+			m_ObjectUserData.push_back(_userData);
+			m_ObjectNode.push_back(INVALID_CULL_HANDLE);
+			m_ObjectPrevious.push_back(INVALID_CULL_HANDLE);
+			m_ObjectNext.push_back(INVALID_CULL_HANDLE);
+		}
+
+		m_ObjectBounds[object] = _bounds;
+		m_ObjectUserData[object] = _userData;
+		Link(object, FindNode(_bounds));
+		++m_Count;
+
+		return object;
+	}
+
+	void LooseQuadtree::Update(CullHandle _object, const Rect& _bounds)
+	{
+		assert(_object < m_ObjectNode.size() && m_ObjectNode[_object] != INVALID_CULL_HANDLE); // Error: Invalid handle.
+
+		m_ObjectBounds[_object] = _bounds;
+
+		// Most moves stay inside the same node and need no relinking.
+		const uint32_t node = FindNode(_bounds);
+
+		if (node != m_ObjectNode[_object])
+		{
+			Unlink(_object);
+			Link(_object, node);
+		}
+	}
+
+	void LooseQuadtree::Remove(CullHandle _object)
+	{
+		assert(_object < m_ObjectNode.size() && m_ObjectNode[_object] != INVALID_CULL_HANDLE); // Error: Invalid handle.
+
+		Unlink(_object);
+		m_FreeObjects.push_back(_object);
+		--m_Count;
+	}
+
+	void LooseQuadtree::Query(const Rect& _area, std::vector<uint32_t>& _outUserData) const
+	{
+		_outUserData.clear();
+		Collect(0, 0, 0, _area, _outUserData);
+	}
+
+	uint32_t LooseQuadtree::Count() const
+	{
+		return m_Count;
+	}
+}
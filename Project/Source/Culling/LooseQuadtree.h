@@ -0,0 +1,135 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: LooseQuadtree.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: A loose quadtree of the bounds of renderable objects, used to find what the camera can
+		see. Each node's bounds are doubled (loose), so an object is stored in the node that contains its
+		centre at the level that matches its size. That makes inserting and moving an object O(1) in the
+		common case: an object that stays in its node only has its bounds updated. Nodes are stored
+		level by level in flat arrays and objects are linked into their node by index, so nothing is
+		allocated per object after warm-up.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include "../Math/Rect.h"
+
+namespace OC
+{
+	typedef uint32_t CullHandle; // Identifies an object in a LooseQuadtree.
+
+	constexpr CullHandle INVALID_CULL_HANDLE = 0xFFFFFFFFU;
+
+	class LooseQuadtree
+	{
+	private:
+		Rect m_Bounds; // The area covered by the root node. Objects outside it still work, just slower.
+		float m_RootSize; // The width and height of the root node.
+		uint32_t m_Depth; // The number of levels.
+		uint32_t m_Count; // The number of objects.
+		std::vector<uint32_t> m_NodeHead; // The first object in each node, or INVALID_CULL_HANDLE.
+		std::vector<uint32_t> m_NodeSubtreeCount; // The number of objects in each node and below it.
+		std::vector<Rect> m_ObjectBounds; // The bounds of each object.
+		std::vector<uint32_t> m_ObjectUserData; // What each object stands for, returned by queries.
+		std::vector<uint32_t> m_ObjectNode; // The node each object is in, or INVALID_CULL_HANDLE if free.
+		std::vector<uint32_t> m_ObjectPrevious, m_ObjectNext; // Links between objects in the same node.
+		std::vector<CullHandle> m_FreeObjects; // Handles that can be reused.
+
+		// Description: Returns the index of the first node of a level.
+		// Parameters: 
+		//    uint32_t _level, the level. 0 is the root.
+		// Returns: The index of the node at (0, 0) on the level.
+		static uint32_t LevelOffset(uint32_t _level)
+		{
+			return ((1U << (2 * _level)) - 1) / 3;
+		}
+
+		// Description: Returns the level of a node.
+		// Parameters: 
+		//    uint32_t _node, the node.
+		// Returns: The level of the node.
+		uint32_t LevelOf(uint32_t _node) const;
+
+		// Description: Picks the node an object with the given bounds belongs in.
+		// Parameters: 
+		//    const Rect& _bounds, the bounds of the object.
+		// Returns: The node index.
+		uint32_t FindNode(const Rect& _bounds) const;
+
+		// Description: Returns the loose bounds of a node.
+		// Parameters: 
+		//    uint32_t _level, the level of the node.
+		//    uint32_t _x, the column of the node on its level.
+		//    uint32_t _y, the row of the node on its level.
+		// Returns: The node's bounds, doubled in size around its centre.
+		Rect LooseBounds(uint32_t _level, uint32_t _x, uint32_t _y) const;
+
+		// Description: Adds an object to a node.
+		// Parameters: 
+		//    CullHandle _object, the object.
+		//    uint32_t _node, the node.
+		void Link(CullHandle _object, uint32_t _node);
+
+		// Description: Removes an object from its node.
+		// Parameters: 
+		//    CullHandle _object, the object.
+		void Unlink(CullHandle _object);
+
+		// Description: Collects every object in a node and below it.
+		// Parameters: 
+		//    uint32_t _level, the level of the node.
+		//    uint32_t _x, the column of the node on its level.
+		//    uint32_t _y, the row of the node on its level.
+		//    std::vector<uint32_t>& _outUserData, the list to append the objects' user data to.
+		void CollectAll(uint32_t _level, uint32_t _x, uint32_t _y, std::vector<uint32_t>& _outUserData) const;
+
+		// Description: Collects the objects in a node and below it that overlap an area.
+		// Parameters: 
+		//    uint32_t _level, the level of the node.
+		//    uint32_t _x, the column of the node on its level.
+		//    uint32_t _y, the row of the node on its level.
+		//    const Rect& _area, the area to test against.
+		//    std::vector<uint32_t>& _outUserData, the list to append the objects' user data to.
+		void Collect(uint32_t _level, uint32_t _x, uint32_t _y, const Rect& _area, std::vector<uint32_t>& _outUserData) const;
+
+	public:
+		// Description: Constructs an empty quadtree.
+		// Parameters: 
+		//    const Rect& _bounds, the area to cover, usually the map.
+		//    uint32_t _depth, the number of levels. Between 1 and 12.
+		LooseQuadtree(const Rect& _bounds, uint32_t _depth = 8);
+
+		// Description: Adds an object.
+		// Parameters: 
+		//    const Rect& _bounds, the bounds of the object.
+		//    uint32_t _userData, what the object stands for, e.g. a unit id. Returned by queries.
+		// Returns: A handle to update or remove the object with.
+		CullHandle Insert(const Rect& _bounds, uint32_t _userData);
+
+		// Description: Changes the bounds of an object after it moved or resized.
+		// Parameters: 
+		//    CullHandle _object, the object.
+		//    const Rect& _bounds, the new bounds.
+		void Update(CullHandle _object, const Rect& _bounds);
+
+		// Description: Removes an object. Its handle may be reused.
+		// Parameters: 
+		//    CullHandle _object, the object.
+		void Remove(CullHandle _object);
+
+		// Description: Finds every object that overlaps an area, usually Camera::GetVisibleBounds.
+		// Parameters: 
+		//    const Rect& _area, the area to test against.
+		//    std::vector<uint32_t>& _outUserData, cleared, then filled with the user data of the objects.
+		void Query(const Rect& _area, std::vector<uint32_t>& _outUserData) const;
+
+		// Description: Returns the number of objects.
+		// Returns: The number of objects.
+		uint32_t Count() const;
+	};
+}
@@ -0,0 +1,351 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: DefinitionCompiler.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <fstream>
+#include <math.h>
+#include <sstream>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "DefinitionCompiler.h"
+#include "Definitions.h"
+#include "../Serialization/AtomicFile.h"
+#include "../Serialization/Crc32.h"
+
+namespace OC
+{
+	namespace DefinitionCompiler
+	{
+		constexpr size_t KIND_COUNT = static_cast<size_t>(DefinitionKind::_COUNT);
+
+		static const char* const KIND_NAMES[KIND_COUNT] = { "weapon", "unit", "building" };
+		static const uint32_t STRIDES[KIND_COUNT] = { sizeof(WeaponDef), sizeof(UnitDef), sizeof(BuildingDef) };
+
+		enum class FieldType : uint8_t
+		{
+			FLOAT,
+			UINT32,
+			UINT16,
+			REFERENCE
+		};
+
+		struct Field
+		{
+			DefinitionKind kind; // The kind of definition the field belongs to.
+			const char* name; // The name written in the text.
+			FieldType type; // How the value is read.
+			size_t offset; // Where the value goes in the definition.
+			DefinitionKind target; // REFERENCE: the kind of definition referred to.
+		};
+
+		static const Field FIELDS[] =
+		{
+			{ DefinitionKind::WEAPON, "range", FieldType::FLOAT, offsetof(WeaponDef, range), DefinitionKind::_COUNT },
+			{ DefinitionKind::WEAPON, "cooldown", FieldType::FLOAT, offsetof(WeaponDef, cooldown), DefinitionKind::_COUNT },
+			{ DefinitionKind::WEAPON, "projectileSpeed", FieldType::FLOAT, offsetof(WeaponDef, projectileSpeed), DefinitionKind::_COUNT },
+			{ DefinitionKind::WEAPON, "damage", FieldType::FLOAT, offsetof(WeaponDef, damage), DefinitionKind::_COUNT },
+			{ DefinitionKind::UNIT, "speed", FieldType::FLOAT, offsetof(UnitDef, speed), DefinitionKind::_COUNT },
+			{ DefinitionKind::UNIT, "health", FieldType::FLOAT, offsetof(UnitDef, health), DefinitionKind::_COUNT },
+			{ DefinitionKind::UNIT, "cost", FieldType::UINT32, offsetof(UnitDef, cost), DefinitionKind::_COUNT },
+			{ DefinitionKind::UNIT, "weapon", FieldType::REFERENCE, offsetof(UnitDef, weapon), DefinitionKind::WEAPON },
+			{ DefinitionKind::BUILDING, "health", FieldType::FLOAT, offsetof(BuildingDef, health), DefinitionKind::_COUNT },
+			{ DefinitionKind::BUILDING, "cost", FieldType::UINT32, offsetof(BuildingDef, cost), DefinitionKind::_COUNT },
+			{ DefinitionKind::BUILDING, "width", FieldType::UINT16, offsetof(BuildingDef, width), DefinitionKind::_COUNT },
+			{ DefinitionKind::BUILDING, "height", FieldType::UINT16, offsetof(BuildingDef, height), DefinitionKind::_COUNT },
+			{ DefinitionKind::BUILDING, "trains", FieldType::REFERENCE, offsetof(BuildingDef, trains), DefinitionKind::UNIT }
+		};
+
+		// A name waiting to be resolved once every definition has been read.
+		struct Reference
+		{
+			DefinitionKind kind; // The kind of definition holding the reference.
+			uint32_t index; // The definition holding the reference.
+			size_t offset; // Where the index goes in the definition.
+			DefinitionKind target; // The kind of definition referred to.
+			std::string name; // The name referred to.
+			unsigned int line; // The line the reference is on, for errors.
+		};
+
+		// Description: Formats a compile error.
+		// Parameters: 
+		//    std::string& _outError, receives the error.
+		//    unsigned int _line, the line the error is on.
+		//    const std::string& _reason, what is wrong.
+		// Returns: false, so callers can return the result.
+		static bool Fail(std::string& _outError, unsigned int _line, const std::string& _reason)
+		{
+			_outError = "line " + std::to_string(_line) + ": " + _reason;
+			return false;
+		}
+
+		// Description: Rounds a size up to a multiple of DEFINITION_ALIGNMENT.
+		// Parameters: 
+		//    size_t _size, the size.
+		// Returns: The aligned size.
+		static size_t Align(size_t _size)
+		{
+			return (_size + DEFINITION_ALIGNMENT - 1) & ~static_cast<size_t>(DEFINITION_ALIGNMENT - 1);
+		}
+
+		bool Compile(std::istream& _stream, std::vector<uint8_t>& _outImage, std::string& _outError)
+		{
+			// Definitions are kept as raw bytes per kind, so fields can be written through their offsets.
+			std::vector<uint8_t> definitions[KIND_COUNT];
+			std::vector<std::string> names[KIND_COUNT];
+			std::vector<Reference> references;
+			DefinitionKind current = DefinitionKind::_COUNT;
+			std::string line;
+			unsigned int lineNumber = 0;
+
+			while (std::getline(_stream, line))
+			{
+				++lineNumber;
+
+				size_t comment = line.find('#');
+				if (comment != std::string::npos)
+					line.resize(comment);
+
+				std::istringstream tokens(line);
+				std::string key, value, extra;
+
+				if (!(tokens >> key))
+					continue;
+
+				// A new definition: [<kind> <name>]
+				if (key[0] == '[')
+				{
+					size_t open = line.find('[');
+					size_t close = line.find(']');
+					std::istringstream header(close == std::string::npos ? std::string() : line.substr(open + 1, close - open - 1));
+
+					if (close == std::string::npos || line.find_first_not_of(" \t\r", close + 1) != std::string::npos ||
+						!(header >> key >> value) || header >> extra)
+						return Fail(_outError, lineNumber, "expected '[<kind> <name>]'");
+
+					size_t kind = 0;
+					while (kind < KIND_COUNT && key != KIND_NAMES[kind])
+						++kind;
+
+					if (kind == KIND_COUNT)
+						return Fail(_outError, lineNumber, "unknown kind '" + key + "'");
+
+					if (value.size() >= DEFINITION_NAME_LENGTH)
+						return Fail(_outError, lineNumber, "name '" + value + "' is too long");
+
+					if (value == "none")
+						return Fail(_outError, lineNumber, "'none' can't be used as a name");
+
+					for (const std::string& name : names[kind])
+						if (name == value)
+							return Fail(_outError, lineNumber, std::string(KIND_NAMES[kind]) + " '" + value + "' is defined twice");
+
+					if (names[kind].size() >= NO_DEFINITION)
+						return Fail(_outError, lineNumber, std::string("too many ") + KIND_NAMES[kind] + " definitions");
+
+					current = static_cast<DefinitionKind>(kind);
+					names[kind].push_back(value);
+
+					// Start from the defaults. They match the values the game used before definitions existed.
+					std::vector<uint8_t>& bytes = definitions[kind];
+					size_t offset = bytes.size();
+					bytes.resize(offset + STRIDES[kind]);
+
+					if (current == DefinitionKind::WEAPON)
+					{
+						WeaponDef weapon = { 130.0f, 1.0f, 300.0f, 10.0f };
+						memcpy(&bytes[offset], &weapon, sizeof(weapon));
+					}
+					else if (current == DefinitionKind::UNIT)
+					{
+						UnitDef unit = { 40.0f, 100.0f, 0, NO_DEFINITION, 0 };
+						memcpy(&bytes[offset], &unit, sizeof(unit));
+					}
+					else
+					{
+						BuildingDef building = { 1000.0f, 0, 1, 1, NO_DEFINITION, 0 };
+						memcpy(&bytes[offset], &building, sizeof(building));
+					}
+
+					continue;
+				}
+
+				// A field of the current definition: <field> <value>
+				if (!(tokens >> value) || tokens >> extra)
+					return Fail(_outError, lineNumber, "expected '<field> <value>'");
+
+				if (current == DefinitionKind::_COUNT)
+					return Fail(_outError, lineNumber, "field '" + key + "' is outside a definition");
+
+				const Field* field = nullptr;
+				for (const Field& candidate : FIELDS)
+					if (candidate.kind == current && key == candidate.name)
+						field = &candidate;
+
+				if (!field)
+					return Fail(_outError, lineNumber, std::string(KIND_NAMES[static_cast<size_t>(current)]) + " has no field '" + key + "'");
+
+				std::vector<uint8_t>& bytes = definitions[static_cast<size_t>(current)];
+				uint8_t* destination = &bytes[bytes.size() - STRIDES[static_cast<size_t>(current)] + field->offset];
+				char* end = nullptr;
+
+				switch (field->type)
+				{
+				case FieldType::FLOAT:
+				{
+					float number = strtof(value.c_str(), &end);
+					if (*end != '\0' || !isfinite(number) || number < 0.0f)
+						return Fail(_outError, lineNumber, "'" + key + "' must be a number, 0 or more");
+
+					memcpy(destination, &number, sizeof(number));
+					break;
+				}
+				case FieldType::UINT32:
+				case FieldType::UINT16:
+				{
+					unsigned long long number = strtoull(value.c_str(), &end, 10);
+					unsigned long long limit = field->type == FieldType::UINT32 ? 0xFFFFFFFFULL : 0xFFFFULL;
+					if (*end != '\0' || value[0] == '-' || number > limit)
+						return Fail(_outError, lineNumber, "'" + key + "' must be a whole number from 0 to " + std::to_string(limit));
+
+					if (field->type == FieldType::UINT32)
+					{
+						uint32_t narrowed = static_cast<uint32_t>(number);
+						memcpy(destination, &narrowed, sizeof(narrowed));
+					}
+					else
+					{
+						uint16_t narrowed = static_cast<uint16_t>(number);
+						memcpy(destination, &narrowed, sizeof(narrowed));
+					}
+					break;
+				}
+				case FieldType::REFERENCE:
+					references.push_back(Reference{
+						current,
+						static_cast<uint32_t>(names[static_cast<size_t>(current)].size() - 1),
+						field->offset,
+						field->target,
+						value,
+						lineNumber
+					});
+					break;
+				}
+			}
+
+			// Resolve names to indices, now that every definition is known.
+			for (const Reference& reference : references)
+			{
+				const std::vector<std::string>& targets = names[static_cast<size_t>(reference.target)];
+				uint16_t index = NO_DEFINITION;
+
+				for (size_t i = 0; i < targets.size(); ++i)
+					if (targets[i] == reference.name)
+						index = static_cast<uint16_t>(i);
+
+				if (reference.name != "none" && index == NO_DEFINITION)
+					return Fail(_outError, reference.line, std::string("no ") + KIND_NAMES[static_cast<size_t>(reference.target)] + " named '" + reference.name + "'");
+
+				size_t kind = static_cast<size_t>(reference.kind);
+				memcpy(&definitions[kind][reference.index * STRIDES[kind] + reference.offset], &index, sizeof(index));
+			}
+
+			// Checks that need a whole definition.
+			for (size_t i = 0; i < names[static_cast<size_t>(DefinitionKind::WEAPON)].size(); ++i)
+			{
+				WeaponDef weapon;
+				memcpy(&weapon, &definitions[static_cast<size_t>(DefinitionKind::WEAPON)][i * sizeof(WeaponDef)], sizeof(weapon));
+				if (weapon.projectileSpeed <= 0.0f || weapon.range <= 0.0f)
+				{
+					_outError = "weapon '" + names[static_cast<size_t>(DefinitionKind::WEAPON)][i] + "' needs a range and projectile speed above 0";
+					return false;
+				}
+			}
+
+			for (size_t i = 0; i < names[static_cast<size_t>(DefinitionKind::UNIT)].size(); ++i)
+			{
+				UnitDef unit;
+				memcpy(&unit, &definitions[static_cast<size_t>(DefinitionKind::UNIT)][i * sizeof(UnitDef)], sizeof(unit));
+				if (unit.health <= 0.0f)
+				{
+					_outError = "unit '" + names[static_cast<size_t>(DefinitionKind::UNIT)][i] + "' needs health above 0";
+					return false;
+				}
+			}
+
+			// Lay the file out: the header, every table, then every kind's names.
+			DefinitionFileHeader header;
+			memset(&header, 0, sizeof(header));
+			header.magic = DEFINITION_MAGIC;
+			header.version = DEFINITION_VERSION;
+			header.tableCount = static_cast<uint16_t>(KIND_COUNT);
+
+			size_t size = Align(sizeof(header));
+
+			for (size_t kind = 0; kind < KIND_COUNT; ++kind)
+			{
+				header.tables[kind].offset = static_cast<uint32_t>(size);
+				header.tables[kind].count = static_cast<uint32_t>(names[kind].size());
+				header.tables[kind].stride = STRIDES[kind];
+				size = Align(size + definitions[kind].size());
+			}
+
+			for (size_t kind = 0; kind < KIND_COUNT; ++kind)
+			{
+				header.tables[kind].namesOffset = static_cast<uint32_t>(size);
+				size = Align(size + names[kind].size() * DEFINITION_NAME_LENGTH);
+			}
+
+			_outImage.assign(size, 0);
+
+			for (size_t kind = 0; kind < KIND_COUNT; ++kind)
+			{
+				if (!definitions[kind].empty())
+					memcpy(&_outImage[header.tables[kind].offset], definitions[kind].data(), definitions[kind].size());
+
+				for (size_t i = 0; i < names[kind].size(); ++i)
+					memcpy(&_outImage[header.tables[kind].namesOffset + i * DEFINITION_NAME_LENGTH], names[kind][i].c_str(), names[kind][i].size());
+			}
+
+			header.fileSize = static_cast<uint32_t>(size);
+			header.crc = Crc32(_outImage.data() + sizeof(header), size - sizeof(header));
+			memcpy(_outImage.data(), &header, sizeof(header));
+			return true;
+		}
+
+		bool CompileFile(const char* _inputPath, const char* _outputPath, std::string& _outError)
+		{
+			assert(_inputPath && _outputPath); // Error: A path is nullptr.
+
+			std::ifstream input(_inputPath);
+			if (!input)
+			{
+				_outError = std::string(_inputPath) + ": could not be opened";
+				return false;
+			}
+
+			std::vector<uint8_t> image;
+			if (!Compile(input, image, _outError))
+			{
+				_outError = std::string(_inputPath) + ": " + _outError;
+				return false;
+			}
+
+			if (!AtomicFile::Write(_outputPath, image.data(), image.size()))
+			{
+				_outError = std::string(_outputPath) + ": could not be written";
+				return false;
+			}
+
+			return true;
+		}
+	}
+}
@@ -0,0 +1,63 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: DefinitionCompiler.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Compiles weapon, unit and building definitions from text into the binary layout in
+		Definitions.h. Each definition starts with its kind and a unique name in brackets, followed by
+		one field per line. Fields left out keep their defaults. '#' starts a comment:
+
+			[weapon rifle]
+				range 130
+				cooldown 1.0
+				projectileSpeed 300
+				damage 10
+
+			[unit soldier]
+				speed 40
+				health 100
+				cost 50
+				weapon rifle
+
+			[building barracks]
+				health 1500
+				cost 150
+				width 3
+				height 3
+				trains soldier
+
+		Definitions may refer to ones further down, and 'none' refers to nothing. Every reference is
+		resolved to an index here, so a name that doesn't exist is an error at compile time instead of
+		in the middle of a match.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <istream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace OC
+{
+	namespace DefinitionCompiler
+	{
+		// Description: Compiles definitions from a stream.
+		// Parameters: 
+		//    std::istream& _stream, the text to read until the end.
+		//    std::vector<uint8_t>& _outImage, replaced with the compiled file.
+		//    std::string& _outError, receives the line and reason the text couldn't be compiled, if any.
+		// Returns: true, if the text was compiled.
+		bool Compile(std::istream& _stream, std::vector<uint8_t>& _outImage, std::string& _outError);
+
+		// Description: Compiles a text file and writes the result to another file.
+		// Parameters: 
+		//    const char* _inputPath, the text to compile.
+		//    const char* _outputPath, where the compiled file goes. Replaced only if compiling succeeds.
+		//    std::string& _outError, receives why compiling or writing failed, if it did.
+		// Returns: true, if the file was compiled and written.
+		bool CompileFile(const char* _inputPath, const char* _outputPath, std::string& _outError);
+	}
+}
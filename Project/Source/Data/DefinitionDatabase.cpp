@@ -0,0 +1,250 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: DefinitionDatabase.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <sstream>
+#include <string.h>
+#include "DefinitionDatabase.h"
+#include "DefinitionCompiler.h"
+#include "../Serialization/Crc32.h"
+
+namespace OC
+{
+	constexpr size_t KIND_COUNT = static_cast<size_t>(DefinitionKind::_COUNT);
+
+	// The definitions used when no file is given. Kept in step with the top of Data/Definitions.txt.
+	static const char BUILT_IN_DEFINITIONS[] =
+		"[weapon rifle]\n"
+		"range 130\n"
+		"cooldown 1\n"
+		"projectileSpeed 300\n"
+		"damage 10\n"
+		"[unit soldier]\n"
+		"speed 40\n"
+		"health 100\n"
+		"cost 50\n"
+		"weapon rifle\n";
+
+	// private
+
+	bool DefinitionDatabase::Attach(const uint8_t* _data, size_t _size)
+	{
+		static const uint32_t STRIDES[KIND_COUNT] = { sizeof(WeaponDef), sizeof(UnitDef), sizeof(BuildingDef) };
+
+		DefinitionFileHeader header;
+		if (_size < sizeof(header))
+			return false;
+
+		memcpy(&header, _data, sizeof(header));
+
+		// A file from a machine of the other byte order fails on the magic.
+		if (header.magic != DEFINITION_MAGIC || header.version != DEFINITION_VERSION ||
+			header.tableCount != KIND_COUNT || header.fileSize != _size)
+			return false;
+
+		for (size_t kind = 0; kind < KIND_COUNT; ++kind)
+		{
+			const DefinitionTable& table = header.tables[kind];
+
+			// Compare against what's left, so huge counts can't overflow the bounds check.
+			if (table.stride != STRIDES[kind] || table.offset % DEFINITION_ALIGNMENT != 0 ||
+				table.offset > _size || table.count > (_size - table.offset) / table.stride ||
+				table.namesOffset > _size || table.count > (_size - table.namesOffset) / DEFINITION_NAME_LENGTH)
+				return false;
+
+			// Every name must end inside its slot.
+			const char* names = reinterpret_cast<const char*>(_data + table.namesOffset);
+			for (uint32_t i = 0; i < table.count; ++i)
+				if (names[i * DEFINITION_NAME_LENGTH + DEFINITION_NAME_LENGTH - 1] != '\0')
+					return false;
+		}
+
+		if (Crc32(_data + sizeof(header), _size - sizeof(header)) != header.crc)
+			return false;
+
+		const DefinitionTable& weapons = header.tables[static_cast<size_t>(DefinitionKind::WEAPON)];
+		const DefinitionTable& units = header.tables[static_cast<size_t>(DefinitionKind::UNIT)];
+		const DefinitionTable& buildings = header.tables[static_cast<size_t>(DefinitionKind::BUILDING)];
+
+		m_Weapons = reinterpret_cast<const WeaponDef*>(_data + weapons.offset);
+		m_Units = reinterpret_cast<const UnitDef*>(_data + units.offset);
+		m_Buildings = reinterpret_cast<const BuildingDef*>(_data + buildings.offset);
+
+		// References are used as indices and projectile speeds as divisors without checks later, so one bad
+		// value rejects the file.
+		bool valid = true;
+
+		for (uint32_t i = 0; i < weapons.count; ++i)
+			if (!(m_Weapons[i].projectileSpeed > 0.0f))
+				valid = false;
+
+		for (uint32_t i = 0; i < units.count; ++i)
+			if (m_Units[i].weapon != NO_DEFINITION && m_Units[i].weapon >= weapons.count)
+				valid = false;
+
+		for (uint32_t i = 0; i < buildings.count; ++i)
+			if (m_Buildings[i].trains != NO_DEFINITION && m_Buildings[i].trains >= units.count)
+				valid = false;
+
+		if (!valid)
+		{
+			Detach();
+			return false;
+		}
+
+		for (size_t kind = 0; kind < KIND_COUNT; ++kind)
+		{
+			m_Names[kind] = reinterpret_cast<const char*>(_data + header.tables[kind].namesOffset);
+			m_Counts[kind] = header.tables[kind].count;
+		}
+
+		return true;
+	}
+
+	void DefinitionDatabase::Detach()
+	{
+		m_Weapons = nullptr;
+		m_Units = nullptr;
+		m_Buildings = nullptr;
+
+		for (size_t kind = 0; kind < KIND_COUNT; ++kind)
+		{
+			m_Names[kind] = nullptr;
+			m_Counts[kind] = 0;
+		}
+	}
+
+	// public
+
+	DefinitionDatabase::DefinitionDatabase() :
+		m_File(),
+		m_Image(),
+		m_Weapons(nullptr),
+		m_Units(nullptr),
+		m_Buildings(nullptr),
+		m_Names(),
+		m_Counts()
+	{
+	}
+
+	bool DefinitionDatabase::Open(const char* _path)
+	{
+		assert(_path); // Error: _path is nullptr.
+
+		Detach();
+		m_Image.clear();
+
+		if (!m_File.Open(_path))
+			return false;
+
+		if (!Attach(m_File.GetData(), m_File.GetSize()))
+		{
+			m_File.Close();
+			return false;
+		}
+
+		return true;
+	}
+
+	bool DefinitionDatabase::Load(std::vector<uint8_t>&& _image)
+	{
+		Detach();
+		m_File.Close();
+		m_Image = std::move(_image);
+
+		// The vector's storage is aligned for any type, so the tables can be used in place like a mapping.
+		if (!Attach(m_Image.data(), m_Image.size()))
+		{
+			m_Image.clear();
+			return false;
+		}
+
+		return true;
+	}
+
+	const DefinitionDatabase& DefinitionDatabase::GetBuiltIn()
+	{
+		static DefinitionDatabase database;
+		static const bool loaded = []()
+		{
+			std::istringstream text(BUILT_IN_DEFINITIONS);
+			std::vector<uint8_t> image;
+			std::string error;
+			return DefinitionCompiler::Compile(text, image, error) && database.Load(std::move(image));
+		}();
+
+		assert(loaded); // Error: The built-in definitions don't compile.
+		(void)loaded;
+		return database;
+	}
+
+	uint32_t DefinitionDatabase::GetCount(DefinitionKind _kind) const
+	{
+		assert(_kind < DefinitionKind::_COUNT); // Error: Invalid kind.
+
+		return m_Counts[static_cast<size_t>(_kind)];
+	}
+
+	const WeaponDef& DefinitionDatabase::GetWeapon(WeaponType _type) const
+	{
+		assert(_type < m_Counts[static_cast<size_t>(DefinitionKind::WEAPON)]); // Error: Invalid weapon.
+
+		return m_Weapons[_type];
+	}
+
+	const UnitDef& DefinitionDatabase::GetUnit(UnitType _type) const
+	{
+		assert(_type < m_Counts[static_cast<size_t>(DefinitionKind::UNIT)]); // Error: Invalid unit.
+
+		return m_Units[_type];
+	}
+
+	const BuildingDef& DefinitionDatabase::GetBuilding(BuildingType _type) const
+	{
+		assert(_type < m_Counts[static_cast<size_t>(DefinitionKind::BUILDING)]); // Error: Invalid building.
+
+		return m_Buildings[_type];
+	}
+
+	const WeaponDef* DefinitionDatabase::GetWeapons() const
+	{
+		return m_Weapons;
+	}
+
+	const UnitDef* DefinitionDatabase::GetUnits() const
+	{
+		return m_Units;
+	}
+
+	const BuildingDef* DefinitionDatabase::GetBuildings() const
+	{
+		return m_Buildings;
+	}
+
+	uint16_t DefinitionDatabase::Find(DefinitionKind _kind, const char* _name) const
+	{
+		assert(_kind < DefinitionKind::_COUNT && _name); // Error: Invalid kind or name.
+
+		const size_t kind = static_cast<size_t>(_kind);
+
+		for (uint32_t i = 0; i < m_Counts[kind]; ++i)
+			if (strncmp(m_Names[kind] + i * DEFINITION_NAME_LENGTH, _name, DEFINITION_NAME_LENGTH) == 0)
+				return static_cast<uint16_t>(i);
+
+		return NO_DEFINITION;
+	}
+
+	const char* DefinitionDatabase::GetName(DefinitionKind _kind, uint16_t _index) const
+	{
+		assert(_kind < DefinitionKind::_COUNT && _index < m_Counts[static_cast<size_t>(_kind)]); // Error: Invalid definition.
+
+		return m_Names[static_cast<size_t>(_kind)] + _index * DEFINITION_NAME_LENGTH;
+	}
+}
@@ -0,0 +1,123 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: DefinitionDatabase.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Read-only weapon, unit and building definitions, loaded from a file compiled by
+		DefinitionCompiler. The file is mapped and its tables are used in place: loading only checks the
+		header, the bounds of every table and the CRC, so there is nothing to parse or copy. Each kind is
+		one tightly packed array, so the simulation looks definitions up by index without following any
+		pointers. Names are kept apart from the definitions and are only read by Find.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include "Definitions.h"
+#include "MappedFile.h"
+
+namespace OC
+{
+	class DefinitionDatabase
+	{
+	private:
+		MappedFile m_File; // The mapped file, if loaded by Open.
+		std::vector<uint8_t> m_Image; // The file's bytes, if loaded by Load.
+		const WeaponDef* m_Weapons; // Every weapon, by WeaponType.
+		const UnitDef* m_Units; // Every unit, by UnitType.
+		const BuildingDef* m_Buildings; // Every building, by BuildingType.
+		const char* m_Names[static_cast<size_t>(DefinitionKind::_COUNT)]; // Every kind's names, DEFINITION_NAME_LENGTH each.
+		uint32_t m_Counts[static_cast<size_t>(DefinitionKind::_COUNT)]; // The number of definitions of each kind.
+
+		// Description: Checks a compiled file and points the tables into it.
+		// Parameters: 
+		//    const uint8_t* _data, the file's bytes.
+		//    size_t _size, the size of the file, in bytes.
+		// Returns: false, if the file isn't a valid definition file for this build.
+		bool Attach(const uint8_t* _data, size_t _size);
+
+		// Description: Forgets the tables, leaving no definitions.
+		void Detach();
+
+	public:
+		// Description: Constructs a database with no definitions.
+		DefinitionDatabase();
+
+		// Description: DefinitionDatabase's cannot be created from other DefinitionDatabase's.
+		DefinitionDatabase(const DefinitionDatabase& _database) = delete;
+
+		// Description: DefinitionDatabase's cannot be assigned to other DefinitionDatabase's.
+		void operator=(const DefinitionDatabase& _database) = delete;
+
+		// Description: Maps a compiled definition file and uses it in place. The file must stay unchanged
+		//    while it is open.
+		// Parameters: 
+		//    const char* _path, the file to load.
+		// Returns: false, if the file couldn't be mapped or isn't valid. The database is then empty.
+		bool Open(const char* _path);
+
+		// Description: Uses compiled definitions already in memory.
+		// Parameters: 
+		//    std::vector<uint8_t>&& _image, the compiled file. The database keeps it.
+		// Returns: false, if the image isn't valid. The database is then empty.
+		bool Load(std::vector<uint8_t>&& _image);
+
+		// Description: Returns the definitions the game falls back on when no file is given. They match the
+		//    soldier and rifle in Data/Definitions.txt.
+		// Returns: The built-in definitions.
+		static const DefinitionDatabase& GetBuiltIn();
+
+		// Description: Returns the number of definitions of a kind.
+		// Parameters: 
+		//    DefinitionKind _kind, the kind.
+		// Returns: The number of definitions.
+		uint32_t GetCount(DefinitionKind _kind) const;
+
+		// Description: Returns a weapon.
+		// Parameters: 
+		//    WeaponType _type, the weapon.
+		// Returns: The weapon's definition.
+		const WeaponDef& GetWeapon(WeaponType _type) const;
+
+		// Description: Returns a unit.
+		// Parameters: 
+		//    UnitType _type, the unit.
+		// Returns: The unit's definition.
+		const UnitDef& GetUnit(UnitType _type) const;
+
+		// Description: Returns a building.
+		// Parameters: 
+		//    BuildingType _type, the building.
+		// Returns: The building's definition.
+		const BuildingDef& GetBuilding(BuildingType _type) const;
+
+		// Description: Returns every weapon, for systems that look weapons up in bulk.
+		// Returns: The weapons, GetCount(DefinitionKind::WEAPON) of them.
+		const WeaponDef* GetWeapons() const;
+
+		// Description: Returns every unit, for systems that look units up in bulk.
+		// Returns: The units, GetCount(DefinitionKind::UNIT) of them.
+		const UnitDef* GetUnits() const;
+
+		// Description: Returns every building, for systems that look buildings up in bulk.
+		// Returns: The buildings, GetCount(DefinitionKind::BUILDING) of them.
+		const BuildingDef* GetBuildings() const;
+
+		// Description: Finds a definition by name. Meant for loading scripts and tools, not for every tick.
+		// Parameters: 
+		//    DefinitionKind _kind, the kind of definition.
+		//    const char* _name, the name.
+		// Returns: The index of the definition, or NO_DEFINITION if there is none by that name.
+		uint16_t Find(DefinitionKind _kind, const char* _name) const;
+
+		// Description: Returns the name of a definition.
+		// Parameters: 
+		//    DefinitionKind _kind, the kind of definition.
+		//    uint16_t _index, the definition.
+		// Returns: The name.
+		const char* GetName(DefinitionKind _kind, uint16_t _index) const;
+	};
+}
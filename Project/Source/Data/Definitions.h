@@ -0,0 +1,92 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Definitions.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: The stats of every kind of weapon, unit and building, and the binary layout they are
+		compiled into. Definitions are referred to by dense indices, resolved from names when the text
+		is compiled, so the game never looks a name up in its hot paths. The compiled file is a header
+		followed by one flat table per kind, each aligned to a cache line, and the names of every
+		definition in a separate table that only tools and scripts read. The layout is little-endian
+		and is read in place, so every struct here is plain data with a fixed size.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+namespace OC
+{
+	typedef uint16_t WeaponType; // Index into the weapon definitions.
+	typedef uint16_t UnitType; // Index into the unit definitions.
+	typedef uint16_t BuildingType; // Index into the building definitions.
+
+	constexpr uint16_t NO_DEFINITION = 0xFFFF; // Never a valid index. Means "none", like a unit without a weapon.
+
+	enum class DefinitionKind : uint8_t
+	{
+		WEAPON,
+		UNIT,
+		BUILDING,
+		_COUNT
+	};
+
+	struct WeaponDef
+	{
+		float range; // How far the weapon can fire.
+		float cooldown; // Seconds between shots.
+		float projectileSpeed; // World units per second.
+		float damage; // Damage per projectile.
+	};
+
+	struct UnitDef
+	{
+		float speed; // Movement speed in world units per second.
+		float health; // Starting health.
+		uint32_t cost; // Resources it takes to train one.
+		WeaponType weapon; // The weapon it fires, or NO_DEFINITION.
+		uint16_t padding; // Keeps the size a multiple of 4. Always 0.
+	};
+
+	struct BuildingDef
+	{
+		float health; // Starting health.
+		uint32_t cost; // Resources it takes to build one.
+		uint16_t width, height; // The footprint, in tiles.
+		UnitType trains; // The unit it trains, or NO_DEFINITION.
+		uint16_t padding; // Keeps the size a multiple of 4. Always 0.
+	};
+
+	constexpr uint32_t DEFINITION_MAGIC = 0x4644434F; // "OCDF" in little-endian.
+	constexpr uint16_t DEFINITION_VERSION = 1; // Bumped whenever a definition struct or the layout changes.
+	constexpr uint32_t DEFINITION_ALIGNMENT = 64; // Every table starts on a cache line.
+	constexpr uint32_t DEFINITION_NAME_LENGTH = 32; // Bytes per name, including the terminating zero.
+
+	// Where one kind's definitions and names are in the file.
+	struct DefinitionTable
+	{
+		uint32_t offset; // Bytes from the start of the file to the first definition.
+		uint32_t count; // The number of definitions.
+		uint32_t stride; // The size of one definition, checked against the struct when loading.
+		uint32_t namesOffset; // Bytes from the start of the file to the names, DEFINITION_NAME_LENGTH each.
+	};
+
+	struct DefinitionFileHeader
+	{
+		uint32_t magic; // DEFINITION_MAGIC.
+		uint16_t version; // DEFINITION_VERSION.
+		uint16_t tableCount; // The number of DefinitionKind's.
+		uint32_t fileSize; // The size of the whole file, in bytes.
+		uint32_t crc; // CRC-32 of everything after the header.
+		DefinitionTable tables[static_cast<size_t>(DefinitionKind::_COUNT)]; // One per kind, in DefinitionKind order.
+	};
+
+	static_assert(sizeof(WeaponDef) == 16 && sizeof(UnitDef) == 16 && sizeof(BuildingDef) == 16,
+		"Open Conquer Error: Changing a definition's size changes the file format. Bump DEFINITION_VERSION.");
+	static_assert(std::is_trivially_copyable<WeaponDef>::value && std::is_trivially_copyable<UnitDef>::value &&
+		std::is_trivially_copyable<BuildingDef>::value, "Open Conquer Error: Definitions are read in place and must be plain data.");
+}
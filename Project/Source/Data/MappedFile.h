@@ -0,0 +1,56 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: MappedFile.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: A whole file mapped read-only into memory. Opening costs the same for any size of file,
+		and pages are only read from disk when first touched.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace OC
+{
+	class MappedFile
+	{
+	private:
+		const uint8_t* m_Data; // The mapped contents, or nullptr if nothing is mapped.
+		size_t m_Size; // The size of the file, in bytes.
+		void* m_Mapping; // The mapping object on Windows. Unused elsewhere.
+
+	public:
+		// Description: Constructs a mapped file with nothing mapped.
+		MappedFile();
+
+		// Description: MappedFile's cannot be created from other MappedFile's.
+		MappedFile(const MappedFile& _file) = delete;
+
+		// Description: Unmaps the file.
+		~MappedFile();
+
+		// Description: MappedFile's cannot be assigned to other MappedFile's.
+		void operator=(const MappedFile& _file) = delete;
+
+		// Description: Maps a file, unmapping whatever was mapped before.
+		// Parameters: 
+		//    const char* _path, the file to map.
+		// Returns: false, if the file couldn't be opened or mapped, or is empty.
+		bool Open(const char* _path);
+
+		// Description: Unmaps the file. Pointers into it become invalid.
+		void Close();
+
+		// Description: Returns the mapped contents.
+		// Returns: The first byte of the file, or nullptr if nothing is mapped.
+		const uint8_t* GetData() const;
+
+		// Description: Returns the size of the mapped file.
+		// Returns: The size, in bytes.
+		size_t GetSize() const;
+	};
+}
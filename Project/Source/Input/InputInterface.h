@@ -3,7 +3,7 @@
 	File: InputInterface.h
 	Author: Ozzie Mercado
 	Created: December 7, 2020
-	Modified: December 8, 2020
+	Modified: October 18, 2026
 	Description: The interface that all input implementations share. Interface for getting information
 		about mouse and key states.
 -------------------------------------------------------------------------------------------------------
@@ -15,6 +15,8 @@
 
 namespace OC
 {
+	class MetricsRegistry;
+
 	class InputInterface
 	{
 	public:
@@ -75,5 +77,10 @@ namespace OC
 
 		// Description: Updates the state of the input system.
 		virtual void Update() = 0;
+
+		// Description: Registers the input system's metrics and starts updating them.
+		// Parameters: 
+		//    MetricsRegistry& _registry, the registry to add the metrics to. Must outlive the input system.
+		virtual void RegisterMetrics(MetricsRegistry& _registry) = 0;
 	};
 }
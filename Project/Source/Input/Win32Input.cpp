@@ -3,7 +3,7 @@
 	File: Win32Input.cpp
 	Author: Ozzie Mercado
 	Created: December 7, 2020
-	Modified: December 8, 2020
+	Modified: October 18, 2026
 	Note: See header for more documentation.
 -------------------------------------------------------------------------------------------------------
 */
@@ -14,38 +14,56 @@ namespace OC
 {
 	// private
 
-	Input* Input::s_Instance = nullptr;
+	const wchar_t* const Input::s_PropertyName = L"OC::Input";
 
 	LRESULT Input::InputPocedure(HWND _hWnd, UINT _message, WPARAM _wParam, LPARAM _lParam)
 	{
-		assert(s_Instance); // Error: How are we even in here if there is no instance?
+		Input* input = static_cast<Input*>(GetPropW(_hWnd, s_PropertyName));
+		assert(input); // Error: How are we even in here if the window has no Input?
 
+		// Count the messages handled below.
 		switch (_message)
 		{
-		case WM_KEYDOWN:		s_Instance->Set(static_cast<unsigned int>(_wParam), true);	break;
-		case WM_KEYUP:			s_Instance->Set(static_cast<unsigned int>(_wParam), false);	break;
-		case WM_LBUTTONDOWN:	s_Instance->Set(Key::MOUSE_LEFT, true);						break;
-		case WM_LBUTTONUP:		s_Instance->Set(Key::MOUSE_LEFT, false);					break;
-		case WM_RBUTTONDOWN:	s_Instance->Set(Key::MOUSE_RIGHT, true);					break;
-		case WM_RBUTTONUP:		s_Instance->Set(Key::MOUSE_RIGHT, false);					break;
-		case WM_MBUTTONDOWN:	s_Instance->Set(Key::MOUSE_MIDDLE, true);					break;
-		case WM_MBUTTONUP:		s_Instance->Set(Key::MOUSE_MIDDLE, false);					break;
+		case WM_KEYDOWN:
+		case WM_KEYUP:
+		case WM_LBUTTONDOWN:
+		case WM_LBUTTONUP:
+		case WM_RBUTTONDOWN:
+		case WM_RBUTTONUP:
+		case WM_MBUTTONDOWN:
+		case WM_MBUTTONUP:
+		case WM_MOUSEWHEEL:
+		case WM_MOUSEMOVE:
+			++input->m_EventCount;
+			break;
+		}
+
+		switch (_message)
+		{
+		case WM_KEYDOWN:		input->Set(static_cast<unsigned int>(_wParam), true);	break;
+		case WM_KEYUP:			input->Set(static_cast<unsigned int>(_wParam), false);	break;
+		case WM_LBUTTONDOWN:	input->Set(Key::MOUSE_LEFT, true);						break;
+		case WM_LBUTTONUP:		input->Set(Key::MOUSE_LEFT, false);						break;
+		case WM_RBUTTONDOWN:	input->Set(Key::MOUSE_RIGHT, true);						break;
+		case WM_RBUTTONUP:		input->Set(Key::MOUSE_RIGHT, false);					break;
+		case WM_MBUTTONDOWN:	input->Set(Key::MOUSE_MIDDLE, true);					break;
+		case WM_MBUTTONUP:		input->Set(Key::MOUSE_MIDDLE, false);					break;
 		case WM_MOUSEWHEEL:
 		{
 			// TODO: Test this on a freely-rotating wheel. May have to consider using float to represent m_WheelDelta.
 			short delta = GET_WHEEL_DELTA_WPARAM(_wParam) / WHEEL_DELTA;
-			s_Instance->SetWheel(static_cast<int>(delta));
+			input->SetWheel(static_cast<int>(delta));
 			break;
 		}
 		case WM_MOUSEMOVE:
 		{
 			POINTS cursor = MAKEPOINTS(_lParam);
-			s_Instance->SetCursor(static_cast<int>(cursor.x), static_cast<int>(cursor.y));
+			input->SetCursor(static_cast<int>(cursor.x), static_cast<int>(cursor.y));
 			break;
 		}
 		}
 
-		return CallWindowProc(s_Instance->m_OriginalWindowProcedure, _hWnd, _message, _wParam, _lParam);
+		return CallWindowProc(input->m_OriginalWindowProcedure, _hWnd, _message, _wParam, _lParam);
 	}
 
 	void Input::Set(Key _key, bool _isDown)
@@ -95,13 +113,18 @@ namespace OC
 		m_MousePrevX(0), m_MousePrevY(0),
 		m_WheelDelta(0),
 		m_State(), m_PrevState(),
-		m_StateChanged(false), m_MouseMoved(false)
+		m_StateChanged(false), m_MouseMoved(false),
+		m_EventCount(0),
+		m_EventsHandled(nullptr),
+		m_EventsPerFrame(nullptr)
 	{
-		assert(!s_Instance); // Error: There can only be one instance of Input.
-
-		s_Instance = this;
 		m_WindowHandle = static_cast<HWND>(_window.GetHandle());
 
+		assert(!GetPropW(m_WindowHandle, s_PropertyName)); // Error: There can only be one Input per window.
+
+		// Let the input procedure find this instance from the window handle.
+		SetPropW(m_WindowHandle, s_PropertyName, this);
+
 		// Setup window message interception.
 		m_OriginalWindowProcedure = reinterpret_cast<WNDPROC>(SetWindowLongPtr(
 			m_WindowHandle,
@@ -121,7 +144,7 @@ namespace OC
 			reinterpret_cast<LONG_PTR>(m_OriginalWindowProcedure)
 		);
 
-		s_Instance = nullptr;
+		RemovePropW(m_WindowHandle, s_PropertyName);
 	};
 
 	bool Input::JustPressed(Key _key) const
@@ -193,5 +216,19 @@ namespace OC
 			m_WheelDelta = 0;
 			m_MouseMoved = false;
 		}
+
+		if (m_EventsHandled)
+		{
+			m_EventsHandled->Add(m_EventCount);
+			m_EventsPerFrame->Record(m_EventCount);
+		}
+
+		m_EventCount = 0;
+	}
+
+	void Input::RegisterMetrics(MetricsRegistry& _registry)
+	{
+		m_EventsHandled = &_registry.GetCounter("input_events_total", "Key and mouse messages received.");
+		m_EventsPerFrame = &_registry.GetHistogram("input_events_per_frame", "Key and mouse messages received between updates.");
 	}
 }
\ No newline at end of file
@@ -3,9 +3,10 @@
 	File: Win32Input.h
 	Author: Ozzie Mercado
 	Created: December 7, 2020
-	Modified: December 8, 2020
+	Modified: October 18, 2026
 	Description: The Win32 implementation of the input interface. Keeps track of key and mouse states,
-		while providing functions for retrieving information about them.
+		while providing functions for retrieving information about them. Each window can have its own
+		Input, found from the window handle when a message arrives.
 -------------------------------------------------------------------------------------------------------
 */
 
@@ -17,13 +18,14 @@
 #include <bitset>
 #include "Win32Keys.h"
 #include "InputInterface.h"
+#include "../Metrics/Metrics.h"
 
 namespace OC
 {
 	class Input final : public InputInterface
 	{
 	private:
-		static Input* s_Instance; // Private singleton used when receiving input messages.
+		static const wchar_t* const s_PropertyName; // Window property that points to the window's Input.
 
 		HWND m_WindowHandle; // Handle to the window.
 		WNDPROC m_OriginalWindowProcedure; // Pointer to the windows procedure function.
@@ -34,6 +36,9 @@ namespace OC
 		std::bitset<static_cast<unsigned int>(Key::_COUNT)> m_PrevState; // The previous state of all keys and mouse buttons.
 		bool m_StateChanged; // Tracks change in keys and mouse buttons since last update.
 		bool m_MouseMoved; // Tracks change in mouse movements since last update.
+		uint64_t m_EventCount; // Input messages received since last update.
+		Counter* m_EventsHandled; // Counts input messages. nullptr until metrics are registered.
+		Histogram* m_EventsPerFrame; // The number of input messages received between updates.
 
 		// Description: Handles input messages and passes them on to the window.
 		// Parameters: 
@@ -119,6 +124,11 @@ namespace OC
 
 		// Description: Updates the state of the input system.
 		void Update();
+
+		// Description: Registers the input system's metrics and starts updating them.
+		// Parameters: 
+		//    MetricsRegistry& _registry, the registry to add the metrics to. Must outlive the input system.
+		void RegisterMetrics(MetricsRegistry& _registry);
 	};
 }
 
@@ -0,0 +1,432 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Log.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <assert.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stdio.h>
+#include <thread>
+#include <vector>
+#include "Log.h"
+#include "../Threading/SpscQueue.h"
+
+namespace OC
+{
+	namespace Log
+	{
+		static const char* const LEVEL_NAMES[] = { "TRACE", "INFO", "WARNING", "FAILURE" };
+		static const char* const CATEGORY_NAMES[] = { "General", "Input", "Renderer", "Simulation", "Audio", "Server", "Saves" };
+
+		static_assert(sizeof(LEVEL_NAMES) / sizeof(LEVEL_NAMES[0]) == static_cast<size_t>(LogLevel::_COUNT), "Open Conquer Error: Every level needs a name.");
+		static_assert(sizeof(CATEGORY_NAMES) / sizeof(CATEGORY_NAMES[0]) == static_cast<size_t>(LogCategory::_COUNT), "Open Conquer Error: Every category needs a name.");
+
+		// One thread's records on their way to the drain thread.
+		struct ThreadQueue
+		{
+			SpscQueue<Record> records; // Written by the owning thread, read by the drain thread.
+			std::atomic<uint64_t> dropped; // Records that didn't fit, not yet reported.
+			std::atomic<bool> retired; // Set when the owning thread exits. Removed once drained.
+
+			explicit ThreadQueue(uint32_t _capacity) :
+				records(_capacity),
+				dropped(0),
+				retired(false)
+			{
+			}
+		};
+
+		// Retires the calling thread's queue when the thread exits.
+		struct ThreadQueueOwner
+		{
+			std::shared_ptr<ThreadQueue> queue; // The thread's queue, or nullptr until it first logs.
+
+			~ThreadQueueOwner()
+			{
+				if (queue)
+					queue->retired.store(true, std::memory_order_release);
+			}
+		};
+
+		// Everything shared between the threads that log and the drain thread.
+		struct State
+		{
+			std::mutex mutex; // Guards everything below but the atomics.
+			std::condition_variable wake; // Wakes the drain thread early, to flush or stop.
+			std::condition_variable flushed; // Wakes threads waiting for a flush.
+			std::vector<std::shared_ptr<ThreadQueue>> queues; // Every thread's queue.
+			LogSettings settings; // Where records go.
+			FILE* file; // The log file, or nullptr.
+			std::thread drainThread; // Formats and writes records.
+			bool running; // If the drain thread is running.
+			bool stopping; // Tells the drain thread to drain once more and exit.
+			uint64_t flushRequests; // Flushes requested so far.
+			uint64_t flushesDone; // Flushes finished so far.
+			std::atomic<uint64_t> droppedTotal; // Records dropped since the program started.
+
+			State() :
+				mutex(),
+				wake(),
+				flushed(),
+				queues(),
+				settings(),
+				file(nullptr),
+				drainThread(),
+				running(false),
+				stopping(false),
+				flushRequests(0),
+				flushesDone(0),
+				droppedTotal(0)
+			{
+			}
+
+			~State();
+		};
+
+		// Description: Returns the shared state, created on first use so logging works during static
+		//    initialization.
+		// Returns: The state.
+		static State& GetState()
+		{
+			static State state;
+			return state;
+		}
+
+		static thread_local ThreadQueueOwner t_Owner; // The calling thread's queue.
+
+		// Description: Writes a line to the console and the file.
+		// Parameters: 
+		//    State& _state, the state.
+		//    LogLevel _level, the level of the line.
+		//    const std::string& _line, the line, without the line break.
+		static void WriteLine(State& _state, LogLevel _level, const std::string& _line)
+		{
+			if (_state.settings.console)
+			{
+				FILE* console = _level >= LogLevel::WARNING ? stderr : stdout;
+				fwrite(_line.data(), 1, _line.size(), console);
+				fputc('\n', console);
+			}
+
+			if (_state.file)
+			{
+				fwrite(_line.data(), 1, _line.size(), _state.file);
+				fputc('\n', _state.file);
+			}
+		}
+
+		// Description: Drains every queue until told to stop.
+		// Parameters: 
+		//    State& _state, the state.
+		static void DrainLoop(State& _state)
+		{
+			std::vector<std::shared_ptr<ThreadQueue>> queues;
+			std::vector<Record> batch;
+			std::string line;
+
+			while (true)
+			{
+				uint64_t flushRequests;
+				bool stopping;
+
+				{
+					std::unique_lock<std::mutex> lock(_state.mutex);
+					_state.wake.wait_for(lock, std::chrono::milliseconds(_state.settings.drainIntervalMilliseconds),
+						[&_state]() { return _state.stopping || _state.flushRequests != _state.flushesDone; });
+
+					flushRequests = _state.flushRequests;
+					stopping = _state.stopping;
+					queues = _state.queues;
+				}
+
+				// Every record pushed before this point is popped, which is what a flush waits for.
+				batch.clear();
+				uint64_t dropped = 0;
+				Record record;
+
+				for (const std::shared_ptr<ThreadQueue>& queue : queues)
+				{
+					while (queue->records.Pop(record))
+						batch.push_back(record);
+
+					dropped += queue->dropped.exchange(0, std::memory_order_relaxed);
+				}
+
+				// Threads drain in turn, so put their records back in the order they were logged.
+				std::stable_sort(batch.begin(), batch.end(), [](const Record& _a, const Record& _b) { return _a.time < _b.time; });
+
+				for (const Record& queued : batch)
+				{
+					Format(queued, line);
+					WriteLine(_state, queued.level, line);
+				}
+
+				if (dropped)
+				{
+					char text[96];
+					snprintf(text, sizeof(text), "[WARNING] [General] %llu log records dropped, the queues were full", static_cast<unsigned long long>(dropped));
+					WriteLine(_state, LogLevel::WARNING, text);
+				}
+
+				if (!batch.empty() || dropped)
+				{
+					if (_state.settings.console)
+						fflush(stdout);
+					if (_state.file)
+						fflush(_state.file);
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(_state.mutex);
+
+					// Queues of threads that exited go once they're empty. The retired flag is read
+					// first, so a record pushed just before it was set is never missed.
+					_state.queues.erase(std::remove_if(_state.queues.begin(), _state.queues.end(),
+						[](const std::shared_ptr<ThreadQueue>& _queue)
+						{
+							return _queue->retired.load(std::memory_order_acquire) && _queue->records.IsEmpty();
+						}), _state.queues.end());
+
+					_state.flushesDone = flushRequests;
+				}
+
+				_state.flushed.notify_all();
+
+				if (stopping)
+					break;
+			}
+		}
+
+		uint64_t Now()
+		{
+			static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+		}
+
+		void Submit(const Record& _record)
+		{
+			ThreadQueueOwner& owner = t_Owner;
+
+			// The first record from a thread registers its queue. This is the only time logging locks.
+			if (!owner.queue)
+			{
+				State& state = GetState();
+				std::lock_guard<std::mutex> lock(state.mutex);
+				owner.queue = std::make_shared<ThreadQueue>(state.settings.queueCapacity);
+				state.queues.push_back(owner.queue);
+			}
+
+			if (!owner.queue->records.Push(_record))
+			{
+				owner.queue->dropped.fetch_add(1, std::memory_order_relaxed);
+				GetState().droppedTotal.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		bool Start(const LogSettings& _settings)
+		{
+			assert(_settings.queueCapacity > 0 && _settings.drainIntervalMilliseconds > 0); // Error: Invalid log settings.
+
+			State& state = GetState();
+			std::lock_guard<std::mutex> lock(state.mutex);
+
+			if (state.running)
+				return false;
+
+			FILE* file = nullptr;
+			if (!_settings.path.empty())
+			{
+				file = fopen(_settings.path.c_str(), "a");
+				if (!file)
+					return false;
+			}
+
+			state.settings = _settings;
+			state.file = file;
+			state.stopping = false;
+			state.running = true;
+			state.drainThread = std::thread(DrainLoop, std::ref(state));
+			return true;
+		}
+
+		// Description: Writes every record queued so far, then stops the drain thread.
+		// Parameters: 
+		//    State& _state, the state.
+		static void StopDraining(State& _state)
+		{
+			{
+				std::lock_guard<std::mutex> lock(_state.mutex);
+				if (!_state.running)
+					return;
+
+				_state.stopping = true;
+			}
+
+			_state.wake.notify_one();
+			_state.drainThread.join();
+
+			std::lock_guard<std::mutex> lock(_state.mutex);
+			if (_state.file)
+				fclose(_state.file);
+
+			_state.file = nullptr;
+			_state.running = false;
+		}
+
+		// Records logged during shutdown are still written if the program forgot to stop the log.
+		State::~State()
+		{
+			StopDraining(*this);
+		}
+
+		void Stop()
+		{
+			StopDraining(GetState());
+		}
+
+		void Flush()
+		{
+			State& state = GetState();
+			std::unique_lock<std::mutex> lock(state.mutex);
+
+			if (!state.running)
+				return;
+
+			uint64_t request = ++state.flushRequests;
+			state.wake.notify_one();
+			state.flushed.wait(lock, [&state, request]() { return state.flushesDone >= request || !state.running; });
+		}
+
+		void Format(const Record& _record, std::string& _outLine)
+		{
+			char buffer[256];
+			char specification[32];
+
+			snprintf(buffer, sizeof(buffer), "[%.3f] [%s] [%s] ",
+				static_cast<double>(_record.time) / 1e9,
+				LEVEL_NAMES[static_cast<size_t>(_record.level)],
+				CATEGORY_NAMES[static_cast<size_t>(_record.category)]);
+			_outLine = buffer;
+
+			const char* format = _record.format;
+			uint32_t next = 0;
+
+			while (*format)
+			{
+				if (*format != '%')
+				{
+					const char* literal = format;
+					while (*format && *format != '%')
+						++format;
+
+					_outLine.append(literal, format - literal);
+					continue;
+				}
+
+				if (format[1] == '%')
+				{
+					_outLine += '%';
+					format += 2;
+					continue;
+				}
+
+				// Keep the flags, width and precision. Drop the length, since the type is known.
+				const char* start = format++;
+				while (*format && strchr("-+ #0123456789.", *format))
+					++format;
+
+				size_t kept = std::min(static_cast<size_t>(format - start), sizeof(specification) - 4);
+				memcpy(specification, start, kept);
+
+				while (*format && strchr("hljztL", *format))
+					++format;
+
+				const char conversion = *format;
+				if (!conversion)
+					break;
+				++format;
+
+				if (next >= _record.argumentCount)
+				{
+					_outLine += "(missing)";
+					continue;
+				}
+
+				const Argument& argument = _record.arguments[next];
+				const ArgumentType type = _record.types[next];
+				++next;
+
+				// Convert what was captured to what the conversion expects.
+				long long integer = type == ArgumentType::SIGNED ? argument.integer :
+					type == ArgumentType::UNSIGNED ? static_cast<long long>(argument.natural) :
+					type == ArgumentType::FLOAT ? static_cast<long long>(argument.real) : 0;
+				double real = type == ArgumentType::FLOAT ? argument.real :
+					type == ArgumentType::SIGNED ? static_cast<double>(argument.integer) :
+					type == ArgumentType::UNSIGNED ? static_cast<double>(argument.natural) : 0.0;
+
+				switch (conversion)
+				{
+				case 'd':
+				case 'i':
+					memcpy(specification + kept, "lld", 4);
+					snprintf(buffer, sizeof(buffer), specification, integer);
+					break;
+				case 'u':
+				case 'x':
+				case 'X':
+				case 'o':
+				{
+					const char length[4] = { 'l', 'l', conversion, '\0' };
+					memcpy(specification + kept, length, 4);
+					snprintf(buffer, sizeof(buffer), specification, type == ArgumentType::UNSIGNED ? static_cast<unsigned long long>(argument.natural) : static_cast<unsigned long long>(integer));
+					break;
+				}
+				case 'c':
+					memcpy(specification + kept, "c", 2);
+					snprintf(buffer, sizeof(buffer), specification, static_cast<int>(integer));
+					break;
+				case 'f':
+				case 'F':
+				case 'e':
+				case 'E':
+				case 'g':
+				case 'G':
+				case 'a':
+				case 'A':
+					specification[kept] = conversion;
+					specification[kept + 1] = '\0';
+					snprintf(buffer, sizeof(buffer), specification, real);
+					break;
+				case 's':
+					memcpy(specification + kept, "s", 2);
+					snprintf(buffer, sizeof(buffer), specification, type == ArgumentType::TEXT ? &_record.text[argument.textOffset] : "(not text)");
+					break;
+				case 'p':
+					memcpy(specification + kept, "p", 2);
+					snprintf(buffer, sizeof(buffer), specification, type == ArgumentType::POINTER ? argument.pointer : nullptr);
+					break;
+				default:
+					snprintf(buffer, sizeof(buffer), "(bad conversion '%c')", conversion);
+					break;
+				}
+
+				_outLine += buffer;
+			}
+		}
+
+		uint64_t GetDroppedCount()
+		{
+			return GetState().droppedTotal.load(std::memory_order_relaxed);
+		}
+	}
+}
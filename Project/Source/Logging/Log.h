@@ -0,0 +1,255 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Log.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Logging that costs the calling thread a timestamp and a copy, never a lock, a format
+		or a write. OC_LOG stores the format string and raw arguments in a fixed-size record on a queue
+		owned by the calling thread. A background thread drains every queue, formats the records in
+		time order and writes them to the console and a file. If a thread logs faster than the drain
+		keeps up, records are dropped and counted rather than blocking.
+
+		Levels and categories are filtered at compile time: a disabled OC_LOG compiles to nothing,
+		arguments included. Define OC_LOG_MIN_LEVEL (a LogLevel value) and OC_LOG_CATEGORIES (a bit per
+		LogCategory) to change the filter:
+
+			OC_LOG(INFO, INPUT, "Pressed %c at %d, %d", 'A', x, y);
+
+		Formats use printf conversions. Length modifiers are ignored, since the record already knows
+		each argument's type, so "%d" logs any integer. Strings are copied, up to TEXT_SIZE bytes per
+		record. The format itself is not copied and must outlive the log, like a string literal.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <type_traits>
+
+#ifndef OC_LOG_MIN_LEVEL
+#if defined(NDEBUG)
+#define OC_LOG_MIN_LEVEL 1 // LogLevel::INFO
+#else
+#define OC_LOG_MIN_LEVEL 0 // LogLevel::TRACE
+#endif
+#endif
+
+#ifndef OC_LOG_CATEGORIES
+#define OC_LOG_CATEGORIES 0xFFFFFFFFu // Every category.
+#endif
+
+// Description: Logs a record if its level and category are enabled at compile time.
+// Parameters: 
+//    _level, a LogLevel, without the enum name.
+//    _category, a LogCategory, without the enum name.
+//    ..., the format, then up to Log::MAX_ARGUMENTS arguments.
+#define OC_LOG(_level, _category, ...) \
+	do \
+	{ \
+		if constexpr (::OC::Log::IsEnabled(::OC::LogLevel::_level, ::OC::LogCategory::_category)) \
+			::OC::Log::Write(::OC::LogLevel::_level, ::OC::LogCategory::_category, __VA_ARGS__); \
+	} while (false)
+
+namespace OC
+{
+	enum class LogLevel : uint8_t
+	{
+		TRACE,		// Step-by-step detail. Compiled out of release builds by default.
+		INFO,		// Things worth knowing happened.
+		WARNING,	// Something went wrong but was handled.
+		FAILURE,	// Something went wrong and wasn't. Not ERROR, which windows.h defines.
+		_COUNT
+	};
+
+	enum class LogCategory : uint8_t
+	{
+		GENERAL,
+		INPUT,
+		RENDERER,
+		SIMULATION,
+		AUDIO,
+		SERVER,
+		SAVES,
+		_COUNT
+	};
+
+	struct LogSettings
+	{
+		std::string path; // The file records are appended to. Empty writes no file.
+		bool console = true; // If records are written to the console. WARNING and up go to stderr.
+		uint32_t queueCapacity = 4096; // Records each thread can have waiting before more are dropped.
+		uint32_t drainIntervalMilliseconds = 10; // How often the queues are drained.
+	};
+
+	namespace Log
+	{
+		constexpr uint32_t MAX_ARGUMENTS = 6; // The most arguments one record holds.
+		constexpr uint32_t TEXT_SIZE = 48; // Bytes for the strings of one record, terminators included.
+
+		enum class ArgumentType : uint8_t
+		{
+			SIGNED,
+			UNSIGNED,
+			FLOAT,
+			POINTER,
+			TEXT
+		};
+
+		union Argument
+		{
+			int64_t integer; // SIGNED.
+			uint64_t natural; // UNSIGNED.
+			double real; // FLOAT.
+			const void* pointer; // POINTER.
+			uint32_t textOffset; // TEXT: where the string starts in the record's text.
+		};
+
+		// Everything needed to format a line later, on the drain thread.
+		struct Record
+		{
+			uint64_t time; // Nanoseconds since the log started counting.
+			const char* format; // The printf-style format.
+			Argument arguments[MAX_ARGUMENTS]; // The arguments, as captured.
+			ArgumentType types[MAX_ARGUMENTS]; // What each argument is.
+			uint8_t argumentCount; // The number of arguments.
+			LogLevel level; // The record's level.
+			LogCategory category; // The record's category.
+			char text[TEXT_SIZE]; // Copies of the string arguments, each terminated.
+		};
+
+		// Description: Returns if a level and category are compiled in.
+		// Parameters: 
+		//    LogLevel _level, the level.
+		//    LogCategory _category, the category.
+		// Returns: true, if records of both are logged.
+		constexpr bool IsEnabled(LogLevel _level, LogCategory _category)
+		{
+			// Written as a greater-than so a minimum of 0 doesn't warn about an always-true comparison.
+			return static_cast<uint32_t>(_level) + 1 > OC_LOG_MIN_LEVEL && ((OC_LOG_CATEGORIES >> static_cast<uint32_t>(_category)) & 1u) != 0;
+		}
+
+		// Description: Returns the time records are stamped with.
+		// Returns: Nanoseconds since the log started counting.
+		uint64_t Now();
+
+		// Description: Queues a record on the calling thread's queue. Never blocks.
+		// Parameters: 
+		//    const Record& _record, the record.
+		void Submit(const Record& _record);
+
+		// Description: Stores one argument in a record.
+		// Parameters: 
+		//    Record& _record, the record.
+		//    uint32_t _index, the argument's position.
+		//    uint32_t& _textUsed, bytes of the record's text used so far. Advanced past copied strings.
+		//    const T& _value, the argument.
+		template<typename T>
+		inline void Capture(Record& _record, uint32_t _index, uint32_t& _textUsed, const T& _value)
+		{
+			typedef typename std::decay<T>::type Type;
+			Argument& argument = _record.arguments[_index];
+
+			if constexpr (std::is_same<Type, char*>::value || std::is_same<Type, const char*>::value || std::is_same<Type, std::string>::value)
+			{
+				const char* string;
+				if constexpr (std::is_same<Type, std::string>::value)
+					string = _value.c_str();
+				else
+					string = _value;
+
+				if (!string)
+					string = "(null)";
+
+				// Truncated to the room left. When none is left, points at the last byte, which is kept 0.
+				size_t room = TEXT_SIZE - 1 - _textUsed;
+				size_t length = strnlen(string, room);
+				memcpy(&_record.text[_textUsed], string, length);
+				_record.text[_textUsed + length] = '\0';
+				argument.textOffset = _textUsed;
+				_textUsed += static_cast<uint32_t>(length) + (_textUsed + length < TEXT_SIZE - 1 ? 1 : 0);
+				_record.types[_index] = ArgumentType::TEXT;
+			}
+			else if constexpr (std::is_floating_point<Type>::value)
+			{
+				argument.real = static_cast<double>(_value);
+				_record.types[_index] = ArgumentType::FLOAT;
+			}
+			else if constexpr (std::is_enum<Type>::value)
+			{
+				argument.integer = static_cast<int64_t>(_value);
+				_record.types[_index] = ArgumentType::SIGNED;
+			}
+			else if constexpr (std::is_integral<Type>::value && std::is_signed<Type>::value)
+			{
+				argument.integer = static_cast<int64_t>(_value);
+				_record.types[_index] = ArgumentType::SIGNED;
+			}
+			else if constexpr (std::is_integral<Type>::value)
+			{
+				argument.natural = static_cast<uint64_t>(_value);
+				_record.types[_index] = ArgumentType::UNSIGNED;
+			}
+			else
+			{
+				static_assert(std::is_pointer<Type>::value, "Open Conquer Error: Only numbers, strings and pointers can be logged.");
+				argument.pointer = static_cast<const void*>(_value);
+				_record.types[_index] = ArgumentType::POINTER;
+			}
+		}
+
+		// Description: Captures a record and queues it. Use OC_LOG instead, so disabled records compile
+		//    out.
+		// Parameters: 
+		//    LogLevel _level, the level.
+		//    LogCategory _category, the category.
+		//    const char* _format, the printf-style format. Must outlive the log.
+		//    const Arguments&... _arguments, the arguments.
+		template<typename... Arguments>
+		inline void Write(LogLevel _level, LogCategory _category, const char* _format, const Arguments&... _arguments)
+		{
+			static_assert(sizeof...(Arguments) <= MAX_ARGUMENTS, "Open Conquer Error: Too many arguments for one log record.");
+
+			Record record;
+			record.time = Now();
+			record.format = _format;
+			record.argumentCount = static_cast<uint8_t>(sizeof...(Arguments));
+			record.level = _level;
+			record.category = _category;
+			record.text[TEXT_SIZE - 1] = '\0';
+
+			uint32_t index = 0;
+			uint32_t textUsed = 0;
+			(Capture(record, index++, textUsed, _arguments), ...);
+			(void)index;
+			(void)textUsed;
+
+			Submit(record);
+		}
+
+		// Description: Starts the thread that writes records. Records logged before this are kept
+		//    until they are drained, as long as they fit.
+		// Parameters: 
+		//    const LogSettings& _settings, where records go.
+		// Returns: false, if already started or the file couldn't be opened. Nothing is started then.
+		bool Start(const LogSettings& _settings = LogSettings());
+
+		// Description: Writes every record queued so far, then stops the thread that writes records.
+		void Stop();
+
+		// Description: Blocks until every record queued so far is written. Not for the hot loop.
+		void Flush();
+
+		// Description: Formats a record the way it's written, without the line break.
+		// Parameters: 
+		//    const Record& _record, the record.
+		//    std::string& _outLine, replaced with the line.
+		void Format(const Record& _record, std::string& _outLine);
+
+		// Description: Returns the number of records dropped because their thread's queue was full.
+		// Returns: The number of records dropped since the program started.
+		uint64_t GetDroppedCount();
+	}
+}
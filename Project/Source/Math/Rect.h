@@ -0,0 +1,46 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Rect.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: An axis-aligned rectangle in world space, stored as its minimum and maximum corners.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+namespace OC
+{
+	struct Rect
+	{
+		float minX, minY; // The top-left corner.
+		float maxX, maxY; // The bottom-right corner.
+
+		// Description: Returns if two rectangles overlap. Touching edges count.
+		// Parameters: 
+		//    const Rect& _other, the rectangle to test against.
+		// Returns: true, if the rectangles overlap.
+		bool Overlaps(const Rect& _other) const
+		{
+			return minX <= _other.maxX && _other.minX <= maxX &&
+				   minY <= _other.maxY && _other.minY <= maxY;
+		}
+
+		// Description: Returns if another rectangle is completely inside this one.
+		// Parameters: 
+		//    const Rect& _other, the rectangle to test.
+		// Returns: true, if _other is inside.
+		bool Contains(const Rect& _other) const
+		{
+			return minX <= _other.minX && _other.maxX <= maxX &&
+				   minY <= _other.minY && _other.maxY <= maxY;
+		}
+
+		// Description: Returns the width of the rectangle.
+		float Width() const { return maxX - minX; }
+
+		// Description: Returns the height of the rectangle.
+		float Height() const { return maxY - minY; }
+	};
+}
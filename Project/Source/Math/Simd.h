@@ -0,0 +1,145 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Simd.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: A thin wrapper over 4-wide float and 128-bit integer SIMD registers. Uses SSE2 where
+		it's available and falls back to plain arrays everywhere else, so kernels are written once and
+		run on any platform. Results are identical either way; only the speed differs.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OC_SIMD_SSE2 1
+#include <emmintrin.h>
+#else
+#define OC_SIMD_SSE2 0
+#endif
+
+namespace OC
+{
+	namespace Simd
+	{
+		constexpr unsigned int WIDTH = 4; // The number of floats in a Float4.
+		constexpr unsigned int WORD_WIDTH = 2; // The number of 64-bit words in a Bits128.
+
+#if OC_SIMD_SSE2
+		typedef __m128 Float4;
+
+		// Description: Loads 4 floats from memory. No alignment required.
+		inline Float4 Load(const float* _source) { return _mm_loadu_ps(_source); }
+
+		// Description: Stores 4 floats to memory. No alignment required.
+		inline void Store(float* _destination, Float4 _value) { _mm_storeu_ps(_destination, _value); }
+
+		// Description: Returns 4 copies of a float.
+		inline Float4 Set(float _value) { return _mm_set1_ps(_value); }
+
+		inline Float4 Add(Float4 _a, Float4 _b) { return _mm_add_ps(_a, _b); }
+		inline Float4 Sub(Float4 _a, Float4 _b) { return _mm_sub_ps(_a, _b); }
+		inline Float4 Mul(Float4 _a, Float4 _b) { return _mm_mul_ps(_a, _b); }
+		inline Float4 Div(Float4 _a, Float4 _b) { return _mm_div_ps(_a, _b); }
+		inline Float4 Min(Float4 _a, Float4 _b) { return _mm_min_ps(_a, _b); }
+		inline Float4 Max(Float4 _a, Float4 _b) { return _mm_max_ps(_a, _b); }
+		inline Float4 Sqrt(Float4 _a) { return _mm_sqrt_ps(_a); }
+
+		// Description: Returns a lane mask of _a < _b. Masks are only useful with Select.
+		inline Float4 Less(Float4 _a, Float4 _b) { return _mm_cmplt_ps(_a, _b); }
+
+		// Description: Returns _a where the mask is set and _b where it isn't.
+		inline Float4 Select(Float4 _mask, Float4 _a, Float4 _b)
+		{
+			return _mm_or_ps(_mm_and_ps(_mask, _a), _mm_andnot_ps(_mask, _b));
+		}
+
+		typedef __m128i Bits128;
+
+		// Description: Loads 2 words from memory. No alignment required.
+		inline Bits128 LoadBits(const uint64_t* _source) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_source)); }
+
+		// Description: Stores 2 words to memory. No alignment required.
+		inline void StoreBits(uint64_t* _destination, Bits128 _value) { _mm_storeu_si128(reinterpret_cast<__m128i*>(_destination), _value); }
+
+		inline Bits128 Or(Bits128 _a, Bits128 _b) { return _mm_or_si128(_a, _b); }
+		inline Bits128 And(Bits128 _a, Bits128 _b) { return _mm_and_si128(_a, _b); }
+#else
+		struct Float4
+		{
+			float lane[WIDTH];
+		};
+
+		// Description: Applies an operation to every lane of two values.
+		template<typename Operation>
+		inline Float4 Each(Float4 _a, Float4 _b, Operation _operation)
+		{
+			Float4 result;
+			for (unsigned int i = 0; i < WIDTH; ++i)
+				result.lane[i] = _operation(_a.lane[i], _b.lane[i]);
+			return result;
+		}
+
+		// Description: Loads 4 floats from memory. No alignment required.
+		inline Float4 Load(const float* _source)
+		{
+			Float4 result;
+			for (unsigned int i = 0; i < WIDTH; ++i)
+				result.lane[i] = _source[i];
+			return result;
+		}
+
+		// Description: Stores 4 floats to memory. No alignment required.
+		inline void Store(float* _destination, Float4 _value)
+		{
+			for (unsigned int i = 0; i < WIDTH; ++i)
+				_destination[i] = _value.lane[i];
+		}
+
+		// Description: Returns 4 copies of a float.
+		inline Float4 Set(float _value) { return Float4{ { _value, _value, _value, _value } }; }
+
+		inline Float4 Add(Float4 _a, Float4 _b) { return Each(_a, _b, [](float _x, float _y) { return _x + _y; }); }
+		inline Float4 Sub(Float4 _a, Float4 _b) { return Each(_a, _b, [](float _x, float _y) { return _x - _y; }); }
+		inline Float4 Mul(Float4 _a, Float4 _b) { return Each(_a, _b, [](float _x, float _y) { return _x * _y; }); }
+		inline Float4 Div(Float4 _a, Float4 _b) { return Each(_a, _b, [](float _x, float _y) { return _x / _y; }); }
+		inline Float4 Min(Float4 _a, Float4 _b) { return Each(_a, _b, [](float _x, float _y) { return _y < _x ? _y : _x; }); }
+		inline Float4 Max(Float4 _a, Float4 _b) { return Each(_a, _b, [](float _x, float _y) { return _x < _y ? _y : _x; }); }
+		inline Float4 Sqrt(Float4 _a) { return Each(_a, _a, [](float _x, float) { return sqrtf(_x); }); }
+
+		// Description: Returns a lane mask of _a < _b. Masks are only useful with Select.
+		inline Float4 Less(Float4 _a, Float4 _b) { return Each(_a, _b, [](float _x, float _y) { return _x < _y ? 1.0f : 0.0f; }); }
+
+		// Description: Returns _a where the mask is set and _b where it isn't.
+		inline Float4 Select(Float4 _mask, Float4 _a, Float4 _b)
+		{
+			Float4 result;
+			for (unsigned int i = 0; i < WIDTH; ++i)
+				result.lane[i] = _mask.lane[i] != 0.0f ? _a.lane[i] : _b.lane[i];
+			return result;
+		}
+
+		struct Bits128
+		{
+			uint64_t word[WORD_WIDTH];
+		};
+
+		// Description: Loads 2 words from memory. No alignment required.
+		inline Bits128 LoadBits(const uint64_t* _source) { return Bits128{ { _source[0], _source[1] } }; }
+
+		// Description: Stores 2 words to memory. No alignment required.
+		inline void StoreBits(uint64_t* _destination, Bits128 _value)
+		{
+			_destination[0] = _value.word[0];
+			_destination[1] = _value.word[1];
+		}
+
+		inline Bits128 Or(Bits128 _a, Bits128 _b) { return Bits128{ { _a.word[0] | _b.word[0], _a.word[1] | _b.word[1] } }; }
+		inline Bits128 And(Bits128 _a, Bits128 _b) { return Bits128{ { _a.word[0] & _b.word[0], _a.word[1] & _b.word[1] } }; }
+#endif
+	}
+}
@@ -0,0 +1,208 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Metrics.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include "Metrics.h"
+
+namespace OC
+{
+	// Histogram private
+
+	unsigned int Histogram::GetBucket(uint64_t _value)
+	{
+		if (_value < (1ull << SUB_BUCKET_BITS))
+			return static_cast<unsigned int>(_value);
+
+		unsigned int highestBit = 63;
+		while (!(_value >> highestBit))
+			--highestBit;
+
+		// Keep the top SUB_BUCKET_BITS bits. The shift picks the power of two.
+		unsigned int shift = highestBit - (SUB_BUCKET_BITS - 1);
+		return shift * HALF_SUB_BUCKETS + static_cast<unsigned int>(_value >> shift);
+	}
+
+	uint64_t Histogram::GetBucketMax(unsigned int _bucket)
+	{
+		if (_bucket < (1u << SUB_BUCKET_BITS))
+			return _bucket;
+
+		unsigned int shift = _bucket / HALF_SUB_BUCKETS - 1;
+		uint64_t subBucket = _bucket - shift * HALF_SUB_BUCKETS;
+		return (subBucket << shift) + ((1ull << shift) - 1);
+	}
+
+	// Histogram public
+
+	Histogram::Histogram() :
+		m_Count(0),
+		m_Sum(0),
+		m_Max(0)
+	{
+		for (std::atomic<uint64_t>& bucket : m_Buckets)
+			bucket.store(0, std::memory_order_relaxed);
+	}
+
+	void Histogram::Record(uint64_t _value)
+	{
+		m_Buckets[GetBucket(_value)].fetch_add(1, std::memory_order_relaxed);
+		m_Count.fetch_add(1, std::memory_order_relaxed);
+		m_Sum.fetch_add(_value, std::memory_order_relaxed);
+
+		uint64_t max = m_Max.load(std::memory_order_relaxed);
+		while (_value > max && !m_Max.compare_exchange_weak(max, _value, std::memory_order_relaxed));
+	}
+
+	uint64_t Histogram::GetQuantile(double _quantile) const
+	{
+		assert(_quantile >= 0.0 && _quantile <= 1.0); // Error: Quantiles are between 0 and 1.
+
+		// Buckets may be updated while they are read, so count them rather than trusting m_Count.
+		uint64_t total = 0;
+		for (const std::atomic<uint64_t>& bucket : m_Buckets)
+			total += bucket.load(std::memory_order_relaxed);
+
+		if (total == 0)
+			return 0;
+
+		uint64_t rank = static_cast<uint64_t>(_quantile * static_cast<double>(total) + 0.5);
+		rank = rank < 1 ? 1 : (rank > total ? total : rank);
+
+		uint64_t seen = 0;
+		for (unsigned int i = 0; i < BUCKET_COUNT; ++i)
+		{
+			seen += m_Buckets[i].load(std::memory_order_relaxed);
+
+			if (seen >= rank)
+			{
+				uint64_t bucketMax = GetBucketMax(i);
+				uint64_t max = GetMax();
+				return bucketMax < max ? bucketMax : max;
+			}
+		}
+
+		return GetMax();
+	}
+
+	uint64_t Histogram::GetCount() const
+	{
+		return m_Count.load(std::memory_order_relaxed);
+	}
+
+	uint64_t Histogram::GetSum() const
+	{
+		return m_Sum.load(std::memory_order_relaxed);
+	}
+
+	uint64_t Histogram::GetMax() const
+	{
+		return m_Max.load(std::memory_order_relaxed);
+	}
+
+	// MetricsRegistry private
+
+	MetricsRegistry::Entry& MetricsRegistry::Find(const char* _name, const char* _help, Type _type)
+	{
+		assert(_name && *_name); // Error: Metrics need a name.
+
+		for (Entry& entry : m_Entries)
+		{
+			if (entry.name == _name)
+			{
+				assert(entry.type == _type); // Error: The metric was registered as another type.
+				return entry;
+			}
+		}
+
+		Entry entry;
+		entry.name = _name;
+		entry.help = _help ? _help : "";
+		entry.type = _type;
+
+		switch (_type)
+		{
+		case Type::COUNTER:		entry.counter.reset(new Counter());		break;
+		case Type::GAUGE:		entry.gauge.reset(new Gauge());			break;
+		case Type::HISTOGRAM:	entry.histogram.reset(new Histogram());	break;
+		}
+
+		m_Entries.push_back(std::move(entry));
+		return m_Entries.back();
+	}
+
+	// MetricsRegistry public
+
+	MetricsRegistry::MetricsRegistry() :
+		m_Entries(),
+		m_Mutex()
+	{}
+
+	Counter& MetricsRegistry::GetCounter(const char* _name, const char* _help)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return *Find(_name, _help, Type::COUNTER).counter;
+	}
+
+	Gauge& MetricsRegistry::GetGauge(const char* _name, const char* _help)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return *Find(_name, _help, Type::GAUGE).gauge;
+	}
+
+	Histogram& MetricsRegistry::GetHistogram(const char* _name, const char* _help)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return *Find(_name, _help, Type::HISTOGRAM).histogram;
+	}
+
+	void MetricsRegistry::Write(std::string& _out) const
+	{
+		constexpr double QUANTILES[] = { 0.5, 0.9, 0.99, 0.999 };
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		for (const Entry& entry : m_Entries)
+		{
+			const char* typeName = entry.type == Type::COUNTER ? "counter" : (entry.type == Type::GAUGE ? "gauge" : "summary");
+
+			_out += "# HELP " + entry.name + " " + entry.help + "\n";
+			_out += "# TYPE " + entry.name + " " + typeName + "\n";
+
+			switch (entry.type)
+			{
+			case Type::COUNTER:
+				_out += entry.name + " " + std::to_string(entry.counter->Get()) + "\n";
+				break;
+
+			case Type::GAUGE:
+				_out += entry.name + " " + std::to_string(entry.gauge->Get()) + "\n";
+				break;
+
+			case Type::HISTOGRAM:
+			{
+				const Histogram& histogram = *entry.histogram;
+
+				for (double quantile : QUANTILES)
+				{
+					char label[32];
+					snprintf(label, sizeof(label), "{quantile=\"%g\"} ", quantile);
+					_out += entry.name + label + std::to_string(histogram.GetQuantile(quantile)) + "\n";
+				}
+
+				_out += entry.name + "_sum " + std::to_string(histogram.GetSum()) + "\n";
+				_out += entry.name + "_count " + std::to_string(histogram.GetCount()) + "\n";
+				_out += entry.name + "_max " + std::to_string(histogram.GetMax()) + "\n";
+				break;
+			}
+			}
+		}
+	}
+}
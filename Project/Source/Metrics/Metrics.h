@@ -0,0 +1,226 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Metrics.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Runtime statistics. Counters, gauges and histograms are plain atomics, so any thread
+		can update them without locking. Subsystems look their metrics up in a MetricsRegistry once and
+		keep the pointer. The registry writes every metric in a Prometheus-like text format.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace OC
+{
+	// A value that only goes up, like the number of ticks run.
+	class Counter
+	{
+	private:
+		std::atomic<uint64_t> m_Value; // The count so far.
+
+	public:
+		// Description: Constructs the counter at 0.
+		Counter() : m_Value(0) {}
+
+		// Description: Counter's cannot be created from other Counter's.
+		Counter(const Counter& _counter) = delete;
+
+		// Description: Counter's cannot be assigned to other Counter's.
+		void operator=(const Counter& _counter) = delete;
+
+		// Description: Adds to the counter.
+		// Parameters: 
+		//    uint64_t _amount, how much to add.
+		void Add(uint64_t _amount = 1)
+		{
+			m_Value.fetch_add(_amount, std::memory_order_relaxed);
+		}
+
+		// Description: Returns the count.
+		// Returns: The count.
+		uint64_t Get() const
+		{
+			return m_Value.load(std::memory_order_relaxed);
+		}
+	};
+
+	// A value that goes up and down, like memory in use.
+	class Gauge
+	{
+	private:
+		std::atomic<int64_t> m_Value; // The current value.
+
+	public:
+		// Description: Constructs the gauge at 0.
+		Gauge() : m_Value(0) {}
+
+		// Description: Gauge's cannot be created from other Gauge's.
+		Gauge(const Gauge& _gauge) = delete;
+
+		// Description: Gauge's cannot be assigned to other Gauge's.
+		void operator=(const Gauge& _gauge) = delete;
+
+		// Description: Sets the gauge.
+		// Parameters: 
+		//    int64_t _value, the new value.
+		void Set(int64_t _value)
+		{
+			m_Value.store(_value, std::memory_order_relaxed);
+		}
+
+		// Description: Adds to the gauge.
+		// Parameters: 
+		//    int64_t _amount, how much to add. May be negative.
+		void Add(int64_t _amount)
+		{
+			m_Value.fetch_add(_amount, std::memory_order_relaxed);
+		}
+
+		// Description: Returns the value.
+		// Returns: The value.
+		int64_t Get() const
+		{
+			return m_Value.load(std::memory_order_relaxed);
+		}
+	};
+
+	// A distribution of values, like tick times. Buckets are log-linear the way HDR histograms are:
+	// values below 2^SUB_BUCKET_BITS are exact, and every power of two above is split into
+	// 2^(SUB_BUCKET_BITS - 1) buckets, so any recorded value is off by at most 1/32 of itself.
+	class Histogram
+	{
+	public:
+		static constexpr unsigned int SUB_BUCKET_BITS = 6; // Sets the precision.
+		static constexpr unsigned int HALF_SUB_BUCKETS = 1u << (SUB_BUCKET_BITS - 1); // Buckets per power of two.
+		static constexpr unsigned int BUCKET_COUNT = (66 - SUB_BUCKET_BITS) * HALF_SUB_BUCKETS; // Covers every uint64_t.
+
+	private:
+		std::atomic<uint64_t> m_Buckets[BUCKET_COUNT]; // The number of values recorded in each bucket.
+		std::atomic<uint64_t> m_Count; // The number of values recorded.
+		std::atomic<uint64_t> m_Sum; // The sum of the values recorded.
+		std::atomic<uint64_t> m_Max; // The largest value recorded.
+
+		// Description: Returns the bucket a value is counted in.
+		// Parameters: 
+		//    uint64_t _value, the value.
+		// Returns: The index of the bucket.
+		static unsigned int GetBucket(uint64_t _value);
+
+		// Description: Returns the largest value counted in a bucket.
+		// Parameters: 
+		//    unsigned int _bucket, the index of the bucket.
+		// Returns: The largest value.
+		static uint64_t GetBucketMax(unsigned int _bucket);
+
+	public:
+		// Description: Constructs an empty histogram.
+		Histogram();
+
+		// Description: Histogram's cannot be created from other Histogram's.
+		Histogram(const Histogram& _histogram) = delete;
+
+		// Description: Histogram's cannot be assigned to other Histogram's.
+		void operator=(const Histogram& _histogram) = delete;
+
+		// Description: Records a value.
+		// Parameters: 
+		//    uint64_t _value, the value.
+		void Record(uint64_t _value);
+
+		// Description: Returns a value at or below which a share of the recorded values fall.
+		// Parameters: 
+		//    double _quantile, the share, from 0 to 1.
+		// Returns: The value, within the histogram's precision. 0 if nothing was recorded.
+		uint64_t GetQuantile(double _quantile) const;
+
+		// Description: Returns the number of values recorded.
+		// Returns: The number of values.
+		uint64_t GetCount() const;
+
+		// Description: Returns the sum of the values recorded.
+		// Returns: The sum.
+		uint64_t GetSum() const;
+
+		// Description: Returns the largest value recorded.
+		// Returns: The largest value. 0 if nothing was recorded.
+		uint64_t GetMax() const;
+	};
+
+	class MetricsRegistry
+	{
+	private:
+		enum class Type
+		{
+			COUNTER,
+			GAUGE,
+			HISTOGRAM
+		};
+
+		struct Entry
+		{
+			std::string name; // The metric name, like server_ticks_total.
+			std::string help; // A line describing the metric.
+			Type type; // Which of the pointers below is set.
+			std::unique_ptr<Counter> counter; // The counter, if a counter.
+			std::unique_ptr<Gauge> gauge; // The gauge, if a gauge.
+			std::unique_ptr<Histogram> histogram; // The histogram, if a histogram.
+		};
+
+		std::vector<Entry> m_Entries; // Every metric, in the order registered.
+		mutable std::mutex m_Mutex; // Guards m_Entries. Metrics themselves are updated without it.
+
+		// Description: Finds a metric, or adds it if it doesn't exist. m_Mutex must be held.
+		// Parameters: 
+		//    const char* _name, the metric name.
+		//    const char* _help, a line describing the metric.
+		//    Type _type, the metric type. Must match the type it was registered with.
+		// Returns: The metric.
+		Entry& Find(const char* _name, const char* _help, Type _type);
+
+	public:
+		// Description: Constructs an empty registry.
+		MetricsRegistry();
+
+		// Description: MetricsRegistry's cannot be created from other MetricsRegistry's.
+		MetricsRegistry(const MetricsRegistry& _registry) = delete;
+
+		// Description: MetricsRegistry's cannot be assigned to other MetricsRegistry's.
+		void operator=(const MetricsRegistry& _registry) = delete;
+
+		// Description: Returns a counter, registering it the first time it's asked for.
+		// Parameters: 
+		//    const char* _name, the metric name. Letters, digits and underscores.
+		//    const char* _help, a line describing the metric.
+		// Returns: The counter. It lives as long as the registry.
+		Counter& GetCounter(const char* _name, const char* _help);
+
+		// Description: Returns a gauge, registering it the first time it's asked for.
+		// Parameters: 
+		//    const char* _name, the metric name. Letters, digits and underscores.
+		//    const char* _help, a line describing the metric.
+		// Returns: The gauge. It lives as long as the registry.
+		Gauge& GetGauge(const char* _name, const char* _help);
+
+		// Description: Returns a histogram, registering it the first time it's asked for.
+		// Parameters: 
+		//    const char* _name, the metric name. Letters, digits and underscores.
+		//    const char* _help, a line describing the metric.
+		// Returns: The histogram. It lives as long as the registry.
+		Histogram& GetHistogram(const char* _name, const char* _help);
+
+		// Description: Writes every metric as text. Histograms are written as summaries with
+		//    quantiles, a sum, a count and a max.
+		// Parameters: 
+		//    std::string& _out, the text is appended to this.
+		void Write(std::string& _out) const;
+	};
+}
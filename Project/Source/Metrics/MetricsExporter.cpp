@@ -0,0 +1,213 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: MetricsExporter.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <chrono>
+#include "MetricsExporter.h"
+#include "ProcessMemory.h"
+#include "../Serialization/AtomicFile.h"
+
+#if defined(WIN32)
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+#define CloseSocket closesocket
+typedef SOCKET SocketHandle;
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#define CloseSocket close
+typedef int SocketHandle;
+#endif
+
+namespace OC
+{
+	// private
+
+	void MetricsExporter::ThreadLoop()
+	{
+		using Clock = std::chrono::steady_clock;
+
+		constexpr unsigned int POLL_MILLISECONDS = 100; // How often a listening thread checks if it should stop.
+
+		const auto interval = std::chrono::milliseconds(m_Settings.intervalMilliseconds);
+		Clock::time_point nextPublish = Clock::now();
+
+		while (!m_Stopping)
+		{
+			Clock::time_point now = Clock::now();
+
+			if (now >= nextPublish)
+			{
+				Publish();
+				nextPublish = now + interval;
+			}
+
+			if (m_Listener >= 0)
+			{
+				auto untilPublish = std::chrono::duration_cast<std::chrono::milliseconds>(nextPublish - Clock::now()).count();
+				Serve(untilPublish < POLL_MILLISECONDS ? static_cast<unsigned int>(untilPublish < 0 ? 0 : untilPublish) : POLL_MILLISECONDS);
+			}
+			else
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_Wake.wait_until(lock, nextPublish, [this] { return m_Stopping.load(); });
+			}
+		}
+	}
+
+	bool MetricsExporter::Listen()
+	{
+#if defined(WIN32)
+		WSADATA data;
+		if (WSAStartup(MAKEWORD(2, 2), &data) != 0)
+			return false;
+#endif
+
+		SocketHandle listener = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+		if (listener == static_cast<SocketHandle>(-1))
+			return false;
+
+		int reuse = 1;
+		setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+
+		// Only local processes may connect. Remote collection goes through whatever runs on the host.
+		sockaddr_in address = {};
+		address.sin_family = AF_INET;
+		address.sin_port = htons(m_Settings.port);
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+		if (bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listener, 8) != 0)
+		{
+			CloseSocket(listener);
+			return false;
+		}
+
+		m_Listener = static_cast<int64_t>(listener);
+		return true;
+	}
+
+	void MetricsExporter::Serve(unsigned int _timeoutMilliseconds)
+	{
+		SocketHandle listener = static_cast<SocketHandle>(m_Listener);
+
+		fd_set readable;
+		FD_ZERO(&readable);
+		FD_SET(listener, &readable);
+
+		timeval timeout;
+		timeout.tv_sec = static_cast<long>(_timeoutMilliseconds / 1000);
+		timeout.tv_usec = static_cast<long>((_timeoutMilliseconds % 1000) * 1000);
+
+		if (select(static_cast<int>(listener + 1), &readable, nullptr, nullptr, &timeout) <= 0)
+			return;
+
+		SocketHandle client = accept(listener, nullptr, nullptr);
+		if (client == static_cast<SocketHandle>(-1))
+			return;
+
+		// Every request gets the same answer, so the request only needs reading, not parsing. Wait
+		// briefly for it so the client doesn't see the connection reset before it finished sending.
+		fd_set request;
+		FD_ZERO(&request);
+		FD_SET(client, &request);
+
+		timeval requestTimeout = { 0, 50000 };
+		if (select(static_cast<int>(client + 1), &request, nullptr, nullptr, &requestTimeout) > 0)
+		{
+			char buffer[1024];
+			recv(client, buffer, sizeof(buffer), 0);
+		}
+
+		std::string body;
+		m_Registry.Write(body);
+
+		std::string response = "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: ";
+		response += std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+
+		size_t sent = 0;
+		while (sent < response.size())
+		{
+			int result = send(client, response.data() + sent, static_cast<int>(response.size() - sent), 0);
+			if (result <= 0)
+				break;
+
+			sent += static_cast<size_t>(result);
+		}
+
+		CloseSocket(client);
+	}
+
+	void MetricsExporter::Publish()
+	{
+		m_ResidentBytes.Set(static_cast<int64_t>(ProcessMemory::GetResidentBytes()));
+		m_PeakResidentBytes.Set(static_cast<int64_t>(ProcessMemory::GetPeakResidentBytes()));
+
+		if (m_Settings.path.empty())
+			return;
+
+		std::string text;
+		m_Registry.Write(text);
+
+		// Readers never see a half-written file, or no file at all.
+		AtomicFile::Write(m_Settings.path, text.data(), text.size());
+	}
+
+	// public
+
+	MetricsExporter::MetricsExporter(MetricsRegistry& _registry, const MetricsExportSettings& _settings) :
+		m_Registry(_registry),
+		m_Settings(_settings),
+		m_ResidentBytes(_registry.GetGauge("process_resident_bytes", "Physical memory used by the process.")),
+		m_PeakResidentBytes(_registry.GetGauge("process_peak_resident_bytes", "The most physical memory the process has used.")),
+		m_Listener(-1),
+		m_Thread(),
+		m_Mutex(),
+		m_Wake(),
+		m_Stopping(false)
+	{
+		if (m_Settings.intervalMilliseconds == 0)
+			m_Settings.intervalMilliseconds = 1;
+
+		if (m_Settings.port)
+			Listen();
+
+		m_Thread = std::thread(&MetricsExporter::ThreadLoop, this);
+	}
+
+	MetricsExporter::~MetricsExporter()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Stopping = true;
+		}
+
+		m_Wake.notify_all();
+		m_Thread.join();
+
+		// The final numbers are the ones worth keeping.
+		Publish();
+
+		if (m_Listener >= 0)
+		{
+			CloseSocket(static_cast<SocketHandle>(m_Listener));
+#if defined(WIN32)
+			WSACleanup();
+#endif
+		}
+	}
+
+	bool MetricsExporter::IsListening() const
+	{
+		return m_Listener >= 0;
+	}
+}
@@ -0,0 +1,80 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: MetricsExporter.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Publishes a MetricsRegistry from a thread of its own, so nothing on the frame or tick
+		loop waits on disk or network. The text is rewritten to a file every interval, served to anyone
+		connecting to a localhost port (plain HTTP, so Prometheus and curl can scrape it), or both.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include "Metrics.h"
+
+namespace OC
+{
+	struct MetricsExportSettings
+	{
+		std::string path; // The file rewritten every interval. Empty to not write one.
+		unsigned short port = 0; // The localhost port to serve the metrics on. 0 to not listen.
+		unsigned int intervalMilliseconds = 1000; // Time between file writes and process memory samples.
+	};
+
+	class MetricsExporter
+	{
+	private:
+		MetricsRegistry& m_Registry; // The metrics to publish.
+		MetricsExportSettings m_Settings; // Where and how often to publish.
+		Gauge& m_ResidentBytes; // Physical memory in use, sampled every interval.
+		Gauge& m_PeakResidentBytes; // The most physical memory used so far.
+		int64_t m_Listener; // The listening socket. -1 if not listening.
+		std::thread m_Thread; // Publishes the metrics.
+		std::mutex m_Mutex; // Pairs with m_Wake.
+		std::condition_variable m_Wake; // Wakes the thread early to stop.
+		std::atomic<bool> m_Stopping; // Tells the thread to exit.
+
+		// Description: Publishes the metrics until the exporter is destroyed.
+		void ThreadLoop();
+
+		// Description: Opens the listening socket on localhost.
+		// Returns: true, if listening.
+		bool Listen();
+
+		// Description: Waits for a connection and answers it with the metrics.
+		// Parameters: 
+		//    unsigned int _timeoutMilliseconds, the longest time to wait.
+		void Serve(unsigned int _timeoutMilliseconds);
+
+		// Description: Samples process memory and rewrites the file.
+		void Publish();
+
+	public:
+		// Description: Constructs the exporter and starts publishing.
+		// Parameters: 
+		//    MetricsRegistry& _registry, the metrics to publish. Must outlive the exporter.
+		//    const MetricsExportSettings& _settings, where and how often to publish.
+		MetricsExporter(MetricsRegistry& _registry, const MetricsExportSettings& _settings);
+
+		// Description: MetricsExporter's cannot be created from other MetricsExporter's.
+		MetricsExporter(const MetricsExporter& _exporter) = delete;
+
+		// Description: Publishes one last time, then stops the thread and closes the socket.
+		~MetricsExporter();
+
+		// Description: MetricsExporter's cannot be assigned to other MetricsExporter's.
+		void operator=(const MetricsExporter& _exporter) = delete;
+
+		// Description: Returns if the exporter is serving metrics on its port.
+		// Returns: true, if listening.
+		bool IsListening() const;
+	};
+}
@@ -0,0 +1,70 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: ProcessMemory.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include "ProcessMemory.h"
+
+#if defined(WIN32)
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#elif defined(__linux__)
+#include <stdio.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace OC
+{
+	namespace ProcessMemory
+	{
+		uint64_t GetResidentBytes()
+		{
+#if defined(WIN32)
+			PROCESS_MEMORY_COUNTERS counters;
+			if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+				return 0;
+
+			return counters.WorkingSetSize;
+#elif defined(__linux__)
+			// The second field of statm is the resident set size in pages.
+			FILE* file = fopen("/proc/self/statm", "r");
+			if (!file)
+				return 0;
+
+			unsigned long long size = 0, resident = 0;
+			int read = fscanf(file, "%llu %llu", &size, &resident);
+			fclose(file);
+
+			return read == 2 ? resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE)) : 0;
+#else
+			return 0;
+#endif
+		}
+
+		uint64_t GetPeakResidentBytes()
+		{
+#if defined(WIN32)
+			PROCESS_MEMORY_COUNTERS counters;
+			if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+				return 0;
+
+			return counters.PeakWorkingSetSize;
+#elif defined(__linux__)
+			rusage usage;
+			if (getrusage(RUSAGE_SELF, &usage) != 0)
+				return 0;
+
+			return static_cast<uint64_t>(usage.ru_maxrss) * 1024; // Reported in kilobytes.
+#else
+			return 0;
+#endif
+		}
+	}
+}
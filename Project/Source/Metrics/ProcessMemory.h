@@ -0,0 +1,27 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: ProcessMemory.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Asks the operating system how much physical memory the process is using.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+namespace OC
+{
+	namespace ProcessMemory
+	{
+		// Description: Returns the physical memory the process is using right now.
+		// Returns: The resident set size in bytes. 0 if the platform can't tell.
+		uint64_t GetResidentBytes();
+
+		// Description: Returns the most physical memory the process has used since it started.
+		// Returns: The peak resident set size in bytes. 0 if the platform can't tell.
+		uint64_t GetPeakResidentBytes();
+	}
+}
@@ -0,0 +1,244 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: OrderSystem.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <assert.h>
+#include <math.h>
+#include "OrderSystem.h"
+
+namespace OC
+{
+	// private
+
+	void OrderSystem::LayOutSlots(uint32_t _count, float _x, float _y, float _facingX, float _facingY)
+	{
+		uint32_t columns = _count;
+
+		if (m_Settings.shape == FormationShape::BOX)
+		{
+			columns = static_cast<uint32_t>(ceilf(sqrtf(_count * m_Settings.aspect)));
+			columns = columns < 1 ? 1 : columns > _count ? _count : columns;
+		}
+
+		const uint32_t rows = (_count + columns - 1) / columns;
+		const float sideX = -_facingY, sideY = _facingX;
+		m_Columns = columns;
+		m_SlotX.resize(_count);
+		m_SlotY.resize(_count);
+
+		for (uint32_t slot = 0; slot < _count; ++slot)
+		{
+			const uint32_t row = slot / columns;
+			const uint32_t column = slot % columns;
+
+			// A short last row is centred behind the others.
+			const uint32_t rowColumns = row + 1 < rows ? columns : _count - row * columns;
+			const float forward = ((rows - 1) * 0.5f - row) * m_Settings.spacing;
+			const float side = (column - (rowColumns - 1) * 0.5f) * m_Settings.spacing;
+
+			m_SlotX[slot] = _x + _facingX * forward + sideX * side;
+			m_SlotY[slot] = _y + _facingY * forward + sideY * side;
+		}
+	}
+
+	void OrderSystem::AssignSlots(const UnitData& _units, float _centerX, float _centerY, float _facingX, float _facingY)
+	{
+		const float sideX = -_facingY, sideY = _facingX;
+
+		// Ids break ties, so the same selection and target always give the same orders.
+		auto byForward = [&](UnitId _a, UnitId _b)
+		{
+			float a = (_units.positionX[_a] - _centerX) * _facingX + (_units.positionY[_a] - _centerY) * _facingY;
+			float b = (_units.positionX[_b] - _centerX) * _facingX + (_units.positionY[_b] - _centerY) * _facingY;
+			return a != b ? a > b : _a < _b;
+		};
+
+		auto bySide = [&](UnitId _a, UnitId _b)
+		{
+			float a = (_units.positionX[_a] - _centerX) * sideX + (_units.positionY[_a] - _centerY) * sideY;
+			float b = (_units.positionX[_b] - _centerX) * sideX + (_units.positionY[_b] - _centerY) * sideY;
+			return a != b ? a < b : _a < _b;
+		};
+
+		// The units furthest toward the target take the front row, and so on back. Each row is then
+		// filled from one side to the other, so units keep their places and don't cross paths.
+		const uint32_t count = static_cast<uint32_t>(m_Units.size());
+		std::sort(m_Units.begin(), m_Units.end(), byForward);
+
+		for (uint32_t row = 0; row < count; row += m_Columns)
+		{
+			const uint32_t rowEnd = row + m_Columns < count ? row + m_Columns : count;
+			std::sort(m_Units.begin() + row, m_Units.begin() + rowEnd, bySide);
+		}
+
+		// Rows were cut by rank alone, so units near a row boundary can be better off in the next row.
+		for (uint32_t pass = 0; pass < m_Settings.swapPasses; ++pass)
+		{
+			for (uint32_t slot = 0; slot < count; ++slot)
+			{
+				if ((slot + 1) % m_Columns != 0 && slot + 1 < count)
+					TrySwap(_units, slot, slot + 1);
+
+				if (slot + m_Columns < count)
+					TrySwap(_units, slot, slot + m_Columns);
+			}
+		}
+	}
+
+	void OrderSystem::TrySwap(const UnitData& _units, uint32_t _a, uint32_t _b)
+	{
+		const UnitId a = m_Units[_a], b = m_Units[_b];
+
+		auto distance = [&](UnitId _unit, uint32_t _slot)
+		{
+			float x = m_SlotX[_slot] - _units.positionX[_unit];
+			float y = m_SlotY[_slot] - _units.positionY[_unit];
+			return sqrtf(x * x + y * y);
+		};
+
+		// Strictly shorter, so passes can't swap back and forth.
+		if (distance(a, _b) + distance(b, _a) < distance(a, _a) + distance(b, _b) - 0.001f)
+		{
+			m_Units[_a] = b;
+			m_Units[_b] = a;
+		}
+	}
+
+	// public
+
+	OrderSystem::OrderSystem(uint8_t _team, const FormationSettings& _settings) :
+		m_Settings(_settings),
+		m_Team(_team),
+		m_Selection(),
+		m_Units(),
+		m_SlotX(),
+		m_SlotY(),
+		m_Columns(1)
+	{
+		assert(_settings.shape < FormationShape::_COUNT); // Error: Unknown formation shape.
+		assert(_settings.spacing > 0.0f && _settings.aspect > 0.0f); // Error: Invalid formation settings.
+	}
+
+	uint32_t OrderSystem::Select(const UnitData& _units, const Rect& _area, bool _add)
+	{
+		const size_t existing = _add ? m_Selection.size() : 0;
+		m_Selection.resize(existing);
+
+		for (UnitId unit = 0; unit < _units.Count(); ++unit)
+		{
+			if (_units.team[unit] != m_Team || !_units.IsAlive(unit))
+				continue;
+
+			const float x = _units.positionX[unit], y = _units.positionY[unit];
+
+			if (x >= _area.minX && x <= _area.maxX && y >= _area.minY && y <= _area.maxY)
+				m_Selection.push_back(unit);
+		}
+
+		// Both parts are in id order, so adding to a selection is a merge.
+		if (existing)
+		{
+			std::inplace_merge(m_Selection.begin(), m_Selection.begin() + existing, m_Selection.end());
+			m_Selection.erase(std::unique(m_Selection.begin(), m_Selection.end()), m_Selection.end());
+		}
+
+		return static_cast<uint32_t>(m_Selection.size() - existing);
+	}
+
+	void OrderSystem::ClearSelection()
+	{
+		m_Selection.clear();
+	}
+
+	uint32_t OrderSystem::Move(const UnitData& _units, float _x, float _y, uint64_t _tick, std::vector<Command>& _outCommands)
+	{
+		m_Units.clear();
+		float centerX = 0.0f, centerY = 0.0f;
+
+		for (UnitId unit : m_Selection)
+		{
+			if (unit >= _units.Count() || _units.team[unit] != m_Team || !_units.IsAlive(unit))
+				continue;
+
+			m_Units.push_back(unit);
+			centerX += _units.positionX[unit];
+			centerY += _units.positionY[unit];
+		}
+
+		const uint32_t count = static_cast<uint32_t>(m_Units.size());
+		m_SlotX.clear();
+		m_SlotY.clear();
+
+		if (count == 0)
+			return 0;
+
+		centerX /= count;
+		centerY /= count;
+
+		// The formation faces the way the group travels. A group ordered onto itself keeps facing up.
+		float facingX = _x - centerX, facingY = _y - centerY;
+		const float length = sqrtf(facingX * facingX + facingY * facingY);
+
+		if (length > m_Settings.spacing * 0.5f)
+		{
+			facingX /= length;
+			facingY /= length;
+		}
+		else
+		{
+			facingX = 0.0f;
+			facingY = -1.0f;
+		}
+
+		LayOutSlots(count, _x, _y, facingX, facingY);
+		AssignSlots(_units, centerX, centerY, facingX, facingY);
+
+		_outCommands.reserve(_outCommands.size() + count);
+
+		for (uint32_t slot = 0; slot < count; ++slot)
+		{
+			Command command = {};
+			command.tick = _tick;
+			command.type = CommandType::MOVE_UNIT;
+			command.team = m_Team;
+			command.x = m_SlotX[slot];
+			command.y = m_SlotY[slot];
+			command.unit = m_Units[slot];
+			_outCommands.push_back(command);
+		}
+
+		return count;
+	}
+
+	const std::vector<UnitId>& OrderSystem::GetSelection() const
+	{
+		return m_Selection;
+	}
+
+	uint32_t OrderSystem::GetSlots(const float*& _outX, const float*& _outY) const
+	{
+		_outX = m_SlotX.data();
+		_outY = m_SlotY.data();
+		return static_cast<uint32_t>(m_SlotX.size());
+	}
+
+	const FormationSettings& OrderSystem::GetSettings() const
+	{
+		return m_Settings;
+	}
+
+	void OrderSystem::SetSettings(const FormationSettings& _settings)
+	{
+		assert(_settings.shape < FormationShape::_COUNT); // Error: Unknown formation shape.
+		assert(_settings.spacing > 0.0f && _settings.aspect > 0.0f); // Error: Invalid formation settings.
+
+		m_Settings = _settings;
+	}
+}
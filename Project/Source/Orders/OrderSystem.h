@@ -0,0 +1,137 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: OrderSystem.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Turns a player's selection and a target into orders for the simulation. Units are
+		selected by dragging a box over them. A move lays out formation slots around the target, facing
+		away from the group, and assigns one unit to each slot.
+
+		Assignment is approximate rather than an optimal matching, which is cubic. Units are ranked by
+		how far forward they are toward the target and dealt out to the formation's rows front to back.
+		Within a row, they are sorted side to side and paired with the row's slots in order. A few
+		passes then swap neighbouring units where that shortens the total walk. Units keep their
+		relative places and rarely cross paths, and a move of hundreds of units costs a sort rather
+		than a hitch.
+
+		Orders are returned as one MOVE_UNIT command per unit, all on the same tick, for World::Queue
+		to merge into its queue in one pass.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include "../Math/Rect.h"
+#include "../Simulation/Command.h"
+#include "../Simulation/Units.h"
+
+namespace OC
+{
+	enum class FormationShape : uint8_t
+	{
+		BOX,	// Rows wider than they are deep.
+		LINE,	// A single row.
+		_COUNT
+	};
+
+	struct FormationSettings
+	{
+		FormationShape shape = FormationShape::BOX; // How the slots are laid out.
+		float spacing = 16.0f; // The distance between neighbouring slots, in world units.
+		float aspect = 2.0f; // BOX: how many times wider than deep the formation is.
+		uint32_t swapPasses = 2; // Passes over neighbouring slots, swapping units where it shortens the walk.
+	};
+
+	class OrderSystem
+	{
+	private:
+		FormationSettings m_Settings; // How formations are laid out.
+		uint8_t m_Team; // The team whose units are selected and ordered.
+		std::vector<UnitId> m_Selection; // The selected units, in id order.
+		std::vector<UnitId> m_Units; // The unit of each slot of the last move.
+		std::vector<float> m_SlotX, m_SlotY; // The slots of the last move, row by row, front first.
+		uint32_t m_Columns; // The slots per row of the last move.
+
+		// Description: Lays out the slots of a formation.
+		// Parameters: 
+		//    uint32_t _count, the number of slots.
+		//    float _x, the x position of the centre of the formation.
+		//    float _y, the y position of the centre of the formation.
+		//    float _facingX, the x part of the unit direction the formation faces.
+		//    float _facingY, the y part of the unit direction the formation faces.
+		void LayOutSlots(uint32_t _count, float _x, float _y, float _facingX, float _facingY);
+
+		// Description: Assigns the units in m_Units to the slots, leaving m_Units in slot order.
+		// Parameters: 
+		//    const UnitData& _units, every unit in the world.
+		//    float _centerX, the x position of the group's centre.
+		//    float _centerY, the y position of the group's centre.
+		//    float _facingX, the x part of the unit direction the formation faces.
+		//    float _facingY, the y part of the unit direction the formation faces.
+		void AssignSlots(const UnitData& _units, float _centerX, float _centerY, float _facingX, float _facingY);
+
+		// Description: Swaps the units of two slots if that shortens their combined walk.
+		// Parameters: 
+		//    const UnitData& _units, every unit in the world.
+		//    uint32_t _a, the first slot.
+		//    uint32_t _b, the second slot.
+		void TrySwap(const UnitData& _units, uint32_t _a, uint32_t _b);
+
+	public:
+		// Description: Constructs an order system with nothing selected.
+		// Parameters: 
+		//    uint8_t _team, the team whose units are selected and ordered.
+		//    const FormationSettings& _settings, how formations are laid out.
+		explicit OrderSystem(uint8_t _team, const FormationSettings& _settings = FormationSettings());
+
+		// Description: OrderSystem's cannot be created from other OrderSystem's.
+		OrderSystem(const OrderSystem& _orders) = delete;
+
+		// Description: OrderSystem's cannot be assigned to other OrderSystem's.
+		void operator=(const OrderSystem& _orders) = delete;
+
+		// Description: Selects the team's living units inside a box.
+		// Parameters: 
+		//    const UnitData& _units, every unit in the world.
+		//    const Rect& _area, the box, in world units.
+		//    bool _add, if the units are added to the selection rather than replacing it.
+		// Returns: The number of units selected.
+		uint32_t Select(const UnitData& _units, const Rect& _area, bool _add = false);
+
+		// Description: Deselects every unit.
+		void ClearSelection();
+
+		// Description: Orders the selected units that are alive into formation around a target.
+		// Parameters: 
+		//    const UnitData& _units, every unit in the world.
+		//    float _x, the x position of the target, in world units.
+		//    float _y, the y position of the target, in world units.
+		//    uint64_t _tick, the tick the orders apply on.
+		//    std::vector<Command>& _outCommands, receives one MOVE_UNIT command per unit, appended.
+		// Returns: The number of units ordered.
+		uint32_t Move(const UnitData& _units, float _x, float _y, uint64_t _tick, std::vector<Command>& _outCommands);
+
+		// Description: Returns the selected units. Some may have died since they were selected.
+		// Returns: The units, in id order.
+		const std::vector<UnitId>& GetSelection() const;
+
+		// Description: Returns the slots of the last move, to draw where units are headed.
+		// Parameters: 
+		//    const float*& _outX, receives the x positions.
+		//    const float*& _outY, receives the y positions.
+		// Returns: The number of slots.
+		uint32_t GetSlots(const float*& _outX, const float*& _outY) const;
+
+		// Description: Returns how formations are laid out.
+		// Returns: The settings.
+		const FormationSettings& GetSettings() const;
+
+		// Description: Changes how formations are laid out, from the next move.
+		// Parameters: 
+		//    const FormationSettings& _settings, the new settings.
+		void SetSettings(const FormationSettings& _settings);
+	};
+}
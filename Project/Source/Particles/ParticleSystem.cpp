@@ -0,0 +1,396 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: ParticleSystem.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+#include "ParticleSystem.h"
+#include "../Math/Simd.h"
+
+namespace OC
+{
+	// private
+
+	void ParticleSystem::Spawn(EffectId _effect, float _x, float _y, uint32_t _count)
+	{
+		constexpr float TWO_PI = 6.28318531f;
+
+		const ParticleEffect& effect = m_Effects[_effect];
+
+		for (uint32_t i = 0; i < _count; ++i)
+		{
+			if (m_Count == m_Capacity)
+			{
+				m_Dropped += _count - i;
+				return;
+			}
+
+			float x = _x, y = _y;
+
+			if (effect.spawnRadius > 0.0f)
+			{
+				// The square root spreads particles evenly over the disc instead of bunching them in the middle.
+				float distance = effect.spawnRadius * sqrtf(m_Random.NextFloat());
+				float angle = m_Random.NextFloat(0.0f, TWO_PI);
+				x += cosf(angle) * distance;
+				y += sinf(angle) * distance;
+			}
+
+			float angle = effect.direction + m_Random.NextFloat(-effect.spread, effect.spread);
+			float speed = m_Random.NextFloat(effect.minSpeed, effect.maxSpeed);
+			float lifetime = m_Random.NextFloat(effect.minLifetime, effect.maxLifetime);
+
+			uint32_t particle = m_Count++;
+			m_X[particle] = x;
+			m_Y[particle] = y;
+			m_VelocityX[particle] = cosf(angle) * speed;
+			m_VelocityY[particle] = sinf(angle) * speed;
+			m_Age[particle] = 0.0f;
+			m_AgeRate[particle] = 1.0f / lifetime;
+			m_Drag[particle] = effect.drag;
+			m_Lift[particle] = effect.lift;
+			m_Effect[particle] = _effect;
+		}
+	}
+
+	void ParticleSystem::Simulate(float _seconds, uint32_t _begin, uint32_t _end)
+	{
+		using namespace Simd;
+
+		std::vector<uint32_t>& deaths = m_ChunkDeaths[_begin / CHUNK_SIZE];
+		deaths.clear();
+
+		const Float4 seconds = Set(_seconds);
+		const Float4 zero = Set(0.0f);
+		const Float4 one = Set(1.0f);
+
+		// The arrays are padded to a whole number of lanes, so the last chunk can run past _end.
+		for (uint32_t i = _begin; i < _end; i += WIDTH)
+		{
+			Float4 damping = Max(zero, Sub(one, Mul(Simd::Load(&m_Drag[i]), seconds)));
+			Float4 velocityX = Mul(Simd::Load(&m_VelocityX[i]), damping);
+			Float4 velocityY = Add(Mul(Simd::Load(&m_VelocityY[i]), damping), Mul(Simd::Load(&m_Lift[i]), seconds));
+
+			Store(&m_VelocityX[i], velocityX);
+			Store(&m_VelocityY[i], velocityY);
+			Store(&m_X[i], Add(Simd::Load(&m_X[i]), Mul(velocityX, seconds)));
+			Store(&m_Y[i], Add(Simd::Load(&m_Y[i]), Mul(velocityY, seconds)));
+			Store(&m_Age[i], Add(Simd::Load(&m_Age[i]), Mul(Simd::Load(&m_AgeRate[i]), seconds)));
+		}
+
+		for (uint32_t i = _begin; i < _end; ++i)
+		{
+			if (m_Age[i] >= 1.0f)
+				deaths.push_back(i);
+		}
+	}
+
+	void ParticleSystem::WriteVertices(const Rect& _bounds, float _zoom, ParticleVertex* _vertices, uint32_t _begin, uint32_t _end)
+	{
+		uint32_t written = 0;
+
+		for (uint32_t i = _begin; i < _end; ++i)
+		{
+			const Style& style = m_Styles[m_Effect[i]];
+			const float age = m_Age[i];
+			const float size = style.startSize + style.sizeChange * age;
+			const float halfSize = size * 0.5f;
+			const float x = m_X[i];
+			const float y = m_Y[i];
+
+			if (x + halfSize < _bounds.minX || x - halfSize > _bounds.maxX || y + halfSize < _bounds.minY || y - halfSize > _bounds.maxY)
+				continue;
+
+			if (size * _zoom < m_MinPixelSize)
+				continue;
+
+			ParticleVertex& vertex = _vertices[_begin + written++];
+			vertex.x = (x - _bounds.minX) * _zoom;
+			vertex.y = (y - _bounds.minY) * _zoom;
+			vertex.size = size * _zoom;
+			vertex.color = style.colors[static_cast<uint32_t>(age * COLOR_STEPS)]; // Ages are below 1.
+		}
+
+		m_ChunkVertexCounts[_begin / CHUNK_SIZE] = written;
+	}
+
+	// public
+
+	ParticleSystem::ParticleSystem(uint32_t _capacity, uint64_t _seed) :
+		m_Capacity(_capacity),
+		m_Count(0),
+		m_X(), m_Y(),
+		m_VelocityX(), m_VelocityY(),
+		m_Age(),
+		m_AgeRate(),
+		m_Drag(),
+		m_Lift(),
+		m_Effect(),
+		m_Effects(),
+		m_Styles(),
+		m_Emitters(),
+		m_FreeEmitters(),
+		m_Random(_seed),
+		m_Dropped(0),
+		m_SpawnScale(1.0f),
+		m_BurstOwed(0.0f),
+		m_MinPixelSize(0.0f),
+		m_ChunkDeaths(),
+		m_ChunkVertexCounts()
+	{
+		assert(_capacity > 0); // Error: The pool must hold at least one particle.
+
+		const uint32_t padded = (_capacity + Simd::WIDTH - 1) / Simd::WIDTH * Simd::WIDTH;
+
+		m_X.resize(padded);
+		m_Y.resize(padded);
+		m_VelocityX.resize(padded);
+		m_VelocityY.resize(padded);
+		m_Age.resize(padded);
+		m_AgeRate.resize(padded);
+		m_Drag.resize(padded);
+		m_Lift.resize(padded);
+		m_Effect.resize(padded);
+
+		const uint32_t chunkCount = (_capacity + CHUNK_SIZE - 1) / CHUNK_SIZE;
+		m_ChunkDeaths.resize(chunkCount);
+		m_ChunkVertexCounts.resize(chunkCount);
+	}
+
+	EffectId ParticleSystem::AddEffect(const ParticleEffect& _effect)
+	{
+		assert(m_Effects.size() < 0xFFFF); // Error: Too many effects.
+		assert(_effect.minLifetime > 0.0f && _effect.minLifetime <= _effect.maxLifetime); // Error: Invalid lifetime.
+		assert(_effect.minSpeed <= _effect.maxSpeed); // Error: Invalid speed.
+
+		// Colors are blended ahead of time, so writing a vertex only looks its color up.
+		Style style;
+		style.startSize = _effect.startSize;
+		style.sizeChange = _effect.endSize - _effect.startSize;
+
+		for (uint32_t step = 0; step < COLOR_STEPS; ++step)
+		{
+			float age = (step + 0.5f) / COLOR_STEPS;
+			uint32_t color = 0;
+
+			for (unsigned int channel = 0; channel < 4; ++channel)
+			{
+				float start = static_cast<float>((_effect.startColor >> (channel * 8)) & 0xFF);
+				float end = static_cast<float>((_effect.endColor >> (channel * 8)) & 0xFF);
+				color |= static_cast<uint32_t>(start + (end - start) * age + 0.5f) << (channel * 8);
+			}
+
+			style.colors[step] = color;
+		}
+
+		m_Effects.push_back(_effect);
+		m_Styles.push_back(style);
+		return static_cast<EffectId>(m_Effects.size() - 1);
+	}
+
+	void ParticleSystem::Burst(EffectId _effect, float _x, float _y, uint32_t _count)
+	{
+		assert(_effect < m_Effects.size()); // Error: Invalid effect.
+
+		if (m_SpawnScale >= 1.0f)
+		{
+			Spawn(_effect, _x, _y, _count);
+			return;
+		}
+
+		float scaled = _count * m_SpawnScale + m_BurstOwed;
+		uint32_t count = static_cast<uint32_t>(scaled);
+		m_BurstOwed = scaled - static_cast<float>(count);
+		Spawn(_effect, _x, _y, count);
+	}
+
+	EmitterId ParticleSystem::StartEmitter(EffectId _effect, float _x, float _y, float _rate, float _duration)
+	{
+		assert(_effect < m_Effects.size()); // Error: Invalid effect.
+		assert(_rate >= 0.0f); // Error: Emitters can't take particles back.
+
+		EmitterId emitter;
+
+		if (!m_FreeEmitters.empty())
+		{
+			emitter = m_FreeEmitters.back();
+			m_FreeEmitters.pop_back();
+		}
+		else
+		{
+			emitter = static_cast<EmitterId>(m_Emitters.size());
+			m_Emitters.emplace_back();
+		}
+
+		m_Emitters[emitter] = Emitter{ _effect, true, _x, _y, _rate, _duration, 0.0f };
+		return emitter;
+	}
+
+	void ParticleSystem::MoveEmitter(EmitterId _emitter, float _x, float _y)
+	{
+		assert(_emitter < m_Emitters.size() && m_Emitters[_emitter].active); // Error: Invalid emitter.
+
+		m_Emitters[_emitter].x = _x;
+		m_Emitters[_emitter].y = _y;
+	}
+
+	void ParticleSystem::StopEmitter(EmitterId _emitter)
+	{
+		assert(_emitter < m_Emitters.size()); // Error: Invalid emitter.
+
+		if (!m_Emitters[_emitter].active)
+			return;
+
+		m_Emitters[_emitter].active = false;
+		m_FreeEmitters.push_back(_emitter);
+	}
+
+	void ParticleSystem::Update(float _seconds, JobSystem* _jobs)
+	{
+		// Emit.
+		for (EmitterId emitter = 0; emitter < m_Emitters.size(); ++emitter)
+		{
+			Emitter& source = m_Emitters[emitter];
+
+			if (!source.active)
+				continue;
+
+			float seconds = source.remaining >= 0.0f && source.remaining < _seconds ? source.remaining : _seconds;
+			source.owed += source.rate * m_SpawnScale * seconds;
+
+			uint32_t count = static_cast<uint32_t>(source.owed);
+			source.owed -= static_cast<float>(count);
+			Spawn(source.effect, source.x, source.y, count);
+
+			if (source.remaining >= 0.0f)
+			{
+				source.remaining -= _seconds;
+				if (source.remaining <= 0.0f)
+					StopEmitter(emitter);
+			}
+		}
+
+		// Move and age. Chunks only touch their own particles.
+		auto simulate = [this, _seconds](uint32_t _begin, uint32_t _end)
+		{
+			for (uint32_t begin = _begin; begin < _end; begin += CHUNK_SIZE)
+				Simulate(_seconds, begin, begin + CHUNK_SIZE < _end ? begin + CHUNK_SIZE : _end);
+		};
+
+		const uint32_t count = m_Count;
+
+		if (_jobs)
+			_jobs->ParallelFor(count, CHUNK_SIZE, simulate);
+		else if (count)
+			simulate(0, count);
+
+		// Remove the dead from the highest index down, moving the last particle into each hole. Every
+		// particle above the current hole has already been removed if dead, so the last one is alive.
+		const uint32_t chunkCount = (count + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+		for (uint32_t chunk = chunkCount; chunk-- > 0;)
+		{
+			const std::vector<uint32_t>& deaths = m_ChunkDeaths[chunk];
+
+			for (size_t i = deaths.size(); i-- > 0;)
+			{
+				uint32_t hole = deaths[i];
+				uint32_t last = --m_Count;
+
+				if (hole == last)
+					continue;
+
+				m_X[hole] = m_X[last];
+				m_Y[hole] = m_Y[last];
+				m_VelocityX[hole] = m_VelocityX[last];
+				m_VelocityY[hole] = m_VelocityY[last];
+				m_Age[hole] = m_Age[last];
+				m_AgeRate[hole] = m_AgeRate[last];
+				m_Drag[hole] = m_Drag[last];
+				m_Lift[hole] = m_Lift[last];
+				m_Effect[hole] = m_Effect[last];
+			}
+		}
+	}
+
+	void ParticleSystem::BuildVertices(const Camera& _camera, std::vector<ParticleVertex>& _outVertices, JobSystem* _jobs)
+	{
+		const Rect bounds = _camera.GetVisibleBounds();
+		const float zoom = _camera.GetZoom();
+		const uint32_t count = m_Count;
+
+		_outVertices.resize(count);
+		ParticleVertex* vertices = _outVertices.data();
+
+		// Every chunk writes its visible particles to the start of its own slots...
+		auto write = [this, &bounds, zoom, vertices](uint32_t _begin, uint32_t _end)
+		{
+			for (uint32_t begin = _begin; begin < _end; begin += CHUNK_SIZE)
+				WriteVertices(bounds, zoom, vertices, begin, begin + CHUNK_SIZE < _end ? begin + CHUNK_SIZE : _end);
+		};
+
+		if (_jobs)
+			_jobs->ParallelFor(count, CHUNK_SIZE, write);
+		else if (count)
+			write(0, count);
+
+		// ...then the chunks are packed together, in order.
+		const uint32_t chunkCount = (count + CHUNK_SIZE - 1) / CHUNK_SIZE;
+		uint32_t written = 0;
+
+		for (uint32_t chunk = 0; chunk < chunkCount; ++chunk)
+		{
+			uint32_t visible = m_ChunkVertexCounts[chunk];
+
+			if (written != chunk * CHUNK_SIZE && visible)
+				memmove(vertices + written, vertices + chunk * CHUNK_SIZE, visible * sizeof(ParticleVertex));
+
+			written += visible;
+		}
+
+		_outVertices.resize(written);
+	}
+
+	void ParticleSystem::SetSpawnScale(float _scale)
+	{
+		assert(_scale >= 0.0f && _scale <= 1.0f); // Error: The spawn scale must be from 0 to 1.
+
+		m_SpawnScale = _scale;
+	}
+
+	void ParticleSystem::SetMinPixelSize(float _pixels)
+	{
+		assert(_pixels >= 0.0f); // Error: Sizes can't be negative.
+
+		m_MinPixelSize = _pixels;
+	}
+
+	void ParticleSystem::Clear()
+	{
+		m_Count = 0;
+		m_Emitters.clear();
+		m_FreeEmitters.clear();
+	}
+
+	uint32_t ParticleSystem::Count() const
+	{
+		return m_Count;
+	}
+
+	uint32_t ParticleSystem::GetCapacity() const
+	{
+		return m_Capacity;
+	}
+
+	uint64_t ParticleSystem::GetDroppedCount() const
+	{
+		return m_Dropped;
+	}
+}
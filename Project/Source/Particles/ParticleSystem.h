@@ -0,0 +1,210 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: ParticleSystem.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Explosions, smoke and other effects made of many short-lived particles. Particles live
+		in a fixed pool stored as arrays, one per field, and are moved 4 at a time in chunks that run in
+		parallel. What a particle looks like over its life comes from its effect, so each particle only
+		stores what changes. Emitters are pooled too. The result is written out as a compact vertex
+		stream, culled to the camera, for the renderer to draw.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include "../Camera/Camera.h"
+#include "../Renderer/ParticleVertex.h"
+#include "../Simulation/Random.h"
+#include "../Threading/JobSystem.h"
+
+namespace OC
+{
+	typedef uint16_t EffectId; // Identifies an effect added to a particle system.
+	typedef uint32_t EmitterId; // Identifies an emitter. Reused once the emitter stops.
+
+	constexpr EmitterId INVALID_EMITTER = 0xFFFFFFFF; // Never a valid emitter. Use it to mean "no emitter".
+
+	// How the particles of one kind of effect start and change over their life.
+	struct ParticleEffect
+	{
+		float minLifetime = 0.5f; // The shortest a particle lives, in seconds.
+		float maxLifetime = 1.0f; // The longest a particle lives, in seconds.
+		float minSpeed = 20.0f; // The slowest a particle starts, in world units per second.
+		float maxSpeed = 80.0f; // The fastest a particle starts, in world units per second.
+		float direction = 0.0f; // The direction particles head in, in radians.
+		float spread = 3.14159265f; // How far from the direction particles may head, in radians.
+		float spawnRadius = 0.0f; // How far from the emitter particles may start.
+		float drag = 1.0f; // The share of its speed a particle loses per second.
+		float lift = 0.0f; // Acceleration along y, in world units per second squared. Negative rises.
+		float startSize = 4.0f; // The size of a new particle, in world units.
+		float endSize = 8.0f; // The size of a particle about to die, in world units.
+		uint32_t startColor = PackColor(255, 255, 255, 255); // The color of a new particle.
+		uint32_t endColor = PackColor(255, 255, 255, 0); // The color of a particle about to die.
+	};
+
+	class ParticleSystem
+	{
+	private:
+		struct Emitter
+		{
+			EffectId effect; // The effect emitted.
+			bool active; // If the emitter is in use.
+			float x, y; // Where particles are emitted.
+			float rate; // Particles per second.
+			float remaining; // Seconds left to emit for. Negative emits until stopped.
+			float owed; // Fractions of a particle carried over between updates.
+		};
+
+		static constexpr uint32_t COLOR_STEPS = 256; // Colors per effect, from birth to death.
+
+		// An effect's look, ready to be looked up by age.
+		struct Style
+		{
+			float startSize; // The size of a new particle.
+			float sizeChange; // The end size minus the start size.
+			uint32_t colors[COLOR_STEPS]; // The packed color at evenly spaced ages.
+		};
+
+		// The per-field arrays are sized for the capacity, rounded up to a whole number of SIMD lanes.
+		uint32_t m_Capacity; // The most particles alive at once.
+		uint32_t m_Count; // The number of particles alive.
+		std::vector<float> m_X, m_Y; // World position.
+		std::vector<float> m_VelocityX, m_VelocityY; // Velocity, in world units per second.
+		std::vector<float> m_Age; // The share of its life a particle has lived, from 0 to 1.
+		std::vector<float> m_AgeRate; // One over the lifetime of each particle.
+		std::vector<float> m_Drag; // Copied from the effect so the update doesn't look it up.
+		std::vector<float> m_Lift; // Copied from the effect so the update doesn't look it up.
+		std::vector<EffectId> m_Effect; // The effect each particle belongs to.
+
+		std::vector<ParticleEffect> m_Effects; // Every effect added.
+		std::vector<Style> m_Styles; // The look of every effect, by effect id.
+		std::vector<Emitter> m_Emitters; // Every emitter, active or not.
+		std::vector<EmitterId> m_FreeEmitters; // Inactive emitters ready for reuse.
+		Random m_Random; // Randomizes new particles.
+		uint64_t m_Dropped; // Particles not spawned because the pool was full.
+		float m_SpawnScale; // The share of requested particles actually spawned.
+		float m_BurstOwed; // Fractions of a particle carried over between scaled bursts.
+		float m_MinPixelSize; // Particles smaller than this on screen aren't drawn.
+
+		std::vector<std::vector<uint32_t>> m_ChunkDeaths; // Particles that died in each chunk this update.
+		std::vector<uint32_t> m_ChunkVertexCounts; // Visible particles in each chunk when building vertices.
+
+		// Description: Spawns particles of an effect.
+		// Parameters: 
+		//    EffectId _effect, the effect.
+		//    float _x, the x position to spawn around.
+		//    float _y, the y position to spawn around.
+		//    uint32_t _count, the number of particles.
+		void Spawn(EffectId _effect, float _x, float _y, uint32_t _count);
+
+		// Description: Moves and ages a range of particles, noting the ones that die.
+		// Parameters: 
+		//    float _seconds, the time to advance by.
+		//    uint32_t _begin, the first particle. A multiple of CHUNK_SIZE.
+		//    uint32_t _end, one past the last particle.
+		void Simulate(float _seconds, uint32_t _begin, uint32_t _end);
+
+		// Description: Writes the vertices of the visible particles in a range, starting at _begin.
+		// Parameters: 
+		//    const Rect& _bounds, the visible part of the world.
+		//    float _zoom, pixels per world unit.
+		//    ParticleVertex* _vertices, one slot per particle.
+		//    uint32_t _begin, the first particle. A multiple of CHUNK_SIZE.
+		//    uint32_t _end, one past the last particle.
+		void WriteVertices(const Rect& _bounds, float _zoom, ParticleVertex* _vertices, uint32_t _begin, uint32_t _end);
+
+	public:
+		static constexpr uint32_t CHUNK_SIZE = 8192; // Particles per job.
+
+		// Description: Constructs an empty particle system.
+		// Parameters: 
+		//    uint32_t _capacity, the most particles alive at once.
+		//    uint64_t _seed, seeds the randomness of new particles.
+		explicit ParticleSystem(uint32_t _capacity, uint64_t _seed = 1);
+
+		// Description: ParticleSystem's cannot be created from other ParticleSystem's.
+		ParticleSystem(const ParticleSystem& _particles) = delete;
+
+		// Description: ParticleSystem's cannot be assigned to other ParticleSystem's.
+		void operator=(const ParticleSystem& _particles) = delete;
+
+		// Description: Adds an effect.
+		// Parameters: 
+		//    const ParticleEffect& _effect, the effect.
+		// Returns: The id of the effect.
+		EffectId AddEffect(const ParticleEffect& _effect);
+
+		// Description: Spawns particles all at once, like an explosion.
+		// Parameters: 
+		//    EffectId _effect, the effect.
+		//    float _x, the world x position.
+		//    float _y, the world y position.
+		//    uint32_t _count, the number of particles.
+		void Burst(EffectId _effect, float _x, float _y, uint32_t _count);
+
+		// Description: Starts emitting particles over time, like smoke from a wreck.
+		// Parameters: 
+		//    EffectId _effect, the effect.
+		//    float _x, the world x position.
+		//    float _y, the world y position.
+		//    float _rate, particles per second.
+		//    float _duration, seconds to emit for. Negative emits until stopped.
+		// Returns: The emitter.
+		EmitterId StartEmitter(EffectId _effect, float _x, float _y, float _rate, float _duration = -1.0f);
+
+		// Description: Moves an emitter.
+		// Parameters: 
+		//    EmitterId _emitter, the emitter.
+		//    float _x, the world x position.
+		//    float _y, the world y position.
+		void MoveEmitter(EmitterId _emitter, float _x, float _y);
+
+		// Description: Stops an emitter. Its particles live out their lives.
+		// Parameters: 
+		//    EmitterId _emitter, the emitter.
+		void StopEmitter(EmitterId _emitter);
+
+		// Description: Runs the emitters, then moves and ages every particle and removes the dead.
+		// Parameters: 
+		//    float _seconds, the time to advance by.
+		//    JobSystem* _jobs, updates chunks of particles in parallel if not nullptr.
+		void Update(float _seconds, JobSystem* _jobs = nullptr);
+
+		// Description: Writes a vertex for every particle the camera can see.
+		// Parameters: 
+		//    const Camera& _camera, the camera.
+		//    std::vector<ParticleVertex>& _outVertices, replaced with the vertices.
+		//    JobSystem* _jobs, builds chunks of vertices in parallel if not nullptr.
+		void BuildVertices(const Camera& _camera, std::vector<ParticleVertex>& _outVertices, JobSystem* _jobs = nullptr);
+
+		// Description: Scales the particles spawned by bursts and emitters from now on, to shed load
+		//    without changing effects. Fractions carry over, so small bursts still spawn on average.
+		// Parameters: 
+		//    float _scale, the share of particles spawned, from 0 to 1.
+		void SetSpawnScale(float _scale);
+
+		// Description: Stops drawing particles too small to make out, to shed load at low zoom.
+		// Parameters: 
+		//    float _pixels, the smallest size drawn, in pixels. 0 draws everything.
+		void SetMinPixelSize(float _pixels);
+
+		// Description: Removes every particle and stops every emitter.
+		void Clear();
+
+		// Description: Returns the number of particles alive.
+		// Returns: The number of particles.
+		uint32_t Count() const;
+
+		// Description: Returns the most particles alive at once.
+		// Returns: The capacity.
+		uint32_t GetCapacity() const;
+
+		// Description: Returns the number of particles not spawned because the pool was full.
+		// Returns: The number of particles.
+		uint64_t GetDroppedCount() const;
+	};
+}
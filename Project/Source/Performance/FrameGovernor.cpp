@@ -0,0 +1,141 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: FrameGovernor.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include "FrameGovernor.h"
+#include "../Metrics/Metrics.h"
+
+namespace OC
+{
+	constexpr float MAX_SAMPLE_BUDGETS = 2.0f; // Frames are clipped to this many budgets before averaging.
+
+	// private
+
+	void FrameGovernor::ChangeLevel(uint32_t _level)
+	{
+		m_Raised = _level < m_Level;
+		m_Level = _level;
+		m_FramesAtLevel = 0;
+		m_FramesOver = 0;
+		m_FramesUnder = 0;
+
+		if (m_LevelGauge)
+		{
+			m_LevelGauge->Set(m_Level);
+			(m_Raised ? m_Upshifts : m_Downshifts)->Add();
+		}
+	}
+
+	// public
+
+	FrameGovernor::FrameGovernor(const GovernorSettings& _settings) :
+		m_Settings(_settings),
+		m_Level(0),
+		m_Average(-1.0f),
+		m_FramesAtLevel(0),
+		m_FramesOver(0),
+		m_FramesUnder(0),
+		m_UpshiftFrames(_settings.upshiftFrames),
+		m_Raised(false),
+		m_LevelGauge(nullptr),
+		m_AverageGauge(nullptr),
+		m_Downshifts(nullptr),
+		m_Upshifts(nullptr)
+	{
+		assert(!_settings.levels.empty()); // Error: The governor needs at least one quality level.
+		assert(_settings.budgetMilliseconds > 0.0f); // Error: The budget must be positive.
+		assert(_settings.underBudget < _settings.overBudget); // Error: Without a gap between the thresholds, quality would flicker.
+	}
+
+	bool FrameGovernor::Record(float _milliseconds)
+	{
+		const float budget = m_Settings.budgetMilliseconds;
+		const float sample = _milliseconds < budget * MAX_SAMPLE_BUDGETS ? _milliseconds : budget * MAX_SAMPLE_BUDGETS;
+
+		m_Average = m_Average < 0.0f ? sample : m_Average + (sample - m_Average) * m_Settings.smoothing;
+		++m_FramesAtLevel;
+
+		if (m_AverageGauge)
+			m_AverageGauge->Set(static_cast<int64_t>(m_Average * 1000.0f));
+
+		// A raised level that has held long enough has proven itself. Raises wait the usual time again.
+		if (m_Raised && m_FramesAtLevel == m_UpshiftFrames)
+			m_UpshiftFrames = m_Settings.upshiftFrames;
+
+		if (m_FramesAtLevel <= m_Settings.settleFrames)
+			return false;
+
+		if (m_Average > budget * m_Settings.overBudget)
+		{
+			++m_FramesOver;
+			m_FramesUnder = 0;
+		}
+		else if (m_Average < budget * m_Settings.underBudget)
+		{
+			++m_FramesUnder;
+			m_FramesOver = 0;
+		}
+		else
+		{
+			m_FramesOver = 0;
+			m_FramesUnder = 0;
+		}
+
+		const uint32_t lowest = static_cast<uint32_t>(m_Settings.levels.size()) - 1;
+
+		if (m_FramesOver >= m_Settings.downshiftFrames && m_Level < lowest)
+		{
+			// Dropping a level that was only just raised means the raise was premature.
+			if (m_Raised && m_FramesAtLevel < m_UpshiftFrames)
+				m_UpshiftFrames = m_UpshiftFrames * 2 < m_Settings.maxUpshiftFrames ? m_UpshiftFrames * 2 : m_Settings.maxUpshiftFrames;
+
+			ChangeLevel(m_Level + 1);
+			return true;
+		}
+
+		if (m_FramesUnder >= m_UpshiftFrames && m_Level > 0)
+		{
+			ChangeLevel(m_Level - 1);
+			return true;
+		}
+
+		return false;
+	}
+
+	uint32_t FrameGovernor::GetLevel() const
+	{
+		return m_Level;
+	}
+
+	const QualityLevel& FrameGovernor::GetQuality() const
+	{
+		return m_Settings.levels[m_Level];
+	}
+
+	float FrameGovernor::GetAverageMilliseconds() const
+	{
+		return m_Average < 0.0f ? 0.0f : m_Average;
+	}
+
+	const GovernorSettings& FrameGovernor::GetSettings() const
+	{
+		return m_Settings;
+	}
+
+	void FrameGovernor::RegisterMetrics(MetricsRegistry& _registry)
+	{
+		m_LevelGauge = &_registry.GetGauge("governor_quality_level", "The frame governor's quality level. 0 is the best.");
+		m_AverageGauge = &_registry.GetGauge("governor_average_microseconds", "The smoothed cost of recent frames or ticks.");
+		m_Downshifts = &_registry.GetCounter("governor_downshifts_total", "Times the frame governor lowered quality.");
+		m_Upshifts = &_registry.GetCounter("governor_upshifts_total", "Times the frame governor raised quality.");
+
+		m_LevelGauge->Set(m_Level);
+	}
+}
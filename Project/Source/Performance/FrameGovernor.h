@@ -0,0 +1,122 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: FrameGovernor.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Keeps frames or ticks inside a time budget by trading away optional work. It is fed the
+		cost of every frame and picks a quality level from a table ordered from best to cheapest: fewer
+		particles, no particles too small to see, less frequent AI re-thinks and a lower resolution in
+		CPU renderers. The caller applies the level to its systems.
+
+		Costs are smoothed, and single hitches are clipped so they can't change the level by themselves.
+		Quality drops quickly once the average stays over budget, and rises slowly only after a long
+		stretch with real headroom. After any change, frames are ignored until the average reflects the
+		new level. A raised level that soon has to be dropped again doubles the wait before the next
+		raise, so a machine sitting right at the edge of a level settles instead of flickering between
+		two.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+namespace OC
+{
+	class Counter;
+	class Gauge;
+	class MetricsRegistry;
+
+	// How much optional work to do at one quality level.
+	struct QualityLevel
+	{
+		float particleScale; // The share of requested particles spawned.
+		float minParticlePixels; // Particles smaller than this on screen aren't drawn.
+		uint32_t thinkIntervalScale; // AI re-thinks this many times less often.
+		float renderScale; // The share of the window's width and height CPU renderers draw at.
+	};
+
+	struct GovernorSettings
+	{
+		float budgetMilliseconds = 1000.0f / 60.0f; // The cost to stay under.
+		float overBudget = 0.95f; // An average above this share of the budget is over it...
+		float underBudget = 0.7f; // ...and one below this share has room to raise quality.
+		float smoothing = 0.1f; // The weight of the newest frame in the average.
+		uint32_t downshiftFrames = 10; // Frames over budget in a row before quality drops a level.
+		uint32_t upshiftFrames = 120; // Frames with room in a row before quality rises a level...
+		uint32_t maxUpshiftFrames = 1920; // ...doubling up to this each time a raised level is dropped again soon.
+		uint32_t settleFrames = 30; // Frames ignored after a change, while the average catches up.
+		std::vector<QualityLevel> levels = // From best to cheapest. The first is used at start.
+		{
+			{ 1.0f, 0.0f, 1, 1.0f },
+			{ 1.0f, 1.0f, 1, 1.0f },
+			{ 0.5f, 2.0f, 1, 1.0f },
+			{ 0.5f, 2.0f, 2, 1.0f },
+			{ 0.5f, 3.0f, 2, 0.75f },
+			{ 0.25f, 4.0f, 4, 0.5f }
+		};
+	};
+
+	class FrameGovernor
+	{
+	private:
+		GovernorSettings m_Settings; // Tuning values.
+		uint32_t m_Level; // The current quality level, an index into m_Settings.levels.
+		float m_Average; // The smoothed cost, in milliseconds. Negative until the first frame.
+		uint32_t m_FramesAtLevel; // Frames recorded since the level last changed.
+		uint32_t m_FramesOver; // Frames in a row with the average over budget.
+		uint32_t m_FramesUnder; // Frames in a row with room to raise quality.
+		uint32_t m_UpshiftFrames; // Frames with room needed before the next raise.
+		bool m_Raised; // If the last change raised quality.
+		Gauge* m_LevelGauge; // The current level. nullptr until metrics are registered.
+		Gauge* m_AverageGauge; // The smoothed cost, in microseconds.
+		Counter* m_Downshifts; // Times quality dropped.
+		Counter* m_Upshifts; // Times quality rose.
+
+		// Description: Moves to another quality level and starts settling.
+		// Parameters: 
+		//    uint32_t _level, the new level.
+		void ChangeLevel(uint32_t _level);
+
+	public:
+		// Description: Constructs a governor at the best quality level.
+		// Parameters: 
+		//    const GovernorSettings& _settings, tuning values. Needs at least one level.
+		explicit FrameGovernor(const GovernorSettings& _settings = GovernorSettings());
+
+		// Description: FrameGovernor's cannot be created from other FrameGovernor's.
+		FrameGovernor(const FrameGovernor& _governor) = delete;
+
+		// Description: FrameGovernor's cannot be assigned to other FrameGovernor's.
+		void operator=(const FrameGovernor& _governor) = delete;
+
+		// Description: Records what a frame cost and changes the quality level if needed.
+		// Parameters: 
+		//    float _milliseconds, the frame's cost. Leave out time spent waiting, like on vertical sync.
+		// Returns: true, if the quality level changed and should be applied.
+		bool Record(float _milliseconds);
+
+		// Description: Returns the current quality level.
+		// Returns: The index of the level, 0 being the best.
+		uint32_t GetLevel() const;
+
+		// Description: Returns what to do at the current quality level.
+		// Returns: The quality level.
+		const QualityLevel& GetQuality() const;
+
+		// Description: Returns the smoothed cost of recent frames.
+		// Returns: The cost, in milliseconds. 0 before the first frame.
+		float GetAverageMilliseconds() const;
+
+		// Description: Returns the tuning values.
+		// Returns: The settings.
+		const GovernorSettings& GetSettings() const;
+
+		// Description: Registers the governor's metrics and starts updating them.
+		// Parameters: 
+		//    MetricsRegistry& _registry, the registry to add the metrics to. Must outlive the governor.
+		void RegisterMetrics(MetricsRegistry& _registry);
+	};
+}
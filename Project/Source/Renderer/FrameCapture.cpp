@@ -0,0 +1,278 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: FrameCapture.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <chrono>
+#include <filesystem>
+#include "FrameCapture.h"
+#include "../Metrics/Metrics.h"
+#include "../Serialization/AtomicFile.h"
+
+namespace OC
+{
+	namespace fs = std::filesystem;
+
+	static const char* const RAW_STREAM_NAME = "frames.rgba"; // The file RAW captures append to.
+
+	// private
+
+	void FrameCapture::ThreadLoop()
+	{
+		std::vector<uint8_t> buffer; // Reused across frames, so encoding allocates once.
+		std::unique_lock<std::mutex> lock(m_Mutex);
+
+		while (true)
+		{
+			m_Changed.wait(lock, [this] { return m_Stopping || !m_Queue.empty(); });
+
+			if (m_Queue.empty())
+				return; // Stopping, and nothing left to write.
+
+			Frame frame = std::move(m_Queue.front());
+			m_Queue.pop_front();
+
+			lock.unlock();
+			auto start = std::chrono::steady_clock::now();
+			bool written = WriteFrame(frame, buffer);
+			auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+			lock.lock();
+
+			if (written)
+			{
+				++m_Stats.written;
+
+				if (m_FramesWritten)
+				{
+					m_FramesWritten->Add();
+					m_EncodeTimes->Record(static_cast<uint64_t>(elapsed.count()));
+				}
+			}
+
+			m_FreeImages.push_back(std::move(frame.image));
+			m_Changed.notify_all();
+		}
+	}
+
+	bool FrameCapture::WriteFrame(const Frame& _frame, std::vector<uint8_t>& _buffer)
+	{
+		if (m_Settings.format == CaptureFormat::RAW)
+		{
+			// Only this thread writes the stream, so only the size check needs the lock.
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+
+				if (m_RawWidth == 0)
+				{
+					m_RawWidth = _frame.image.width;
+					m_RawHeight = _frame.image.height;
+				}
+				else if (_frame.image.width != m_RawWidth || _frame.image.height != m_RawHeight)
+				{
+					// A raw stream has no room to say the size changed, so frames of another size are left out.
+					++m_Stats.dropped;
+					if (m_FramesDropped)
+						m_FramesDropped->Add();
+
+					return false;
+				}
+			}
+
+			if (fwrite(_frame.image.pixels.data(), 1, _frame.image.pixels.size(), m_RawFile) == _frame.image.pixels.size())
+				return true;
+
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			++m_Stats.failed;
+			return false;
+		}
+
+		ImageFile::EncodePng(_frame.image, _buffer);
+
+		char name[32];
+		snprintf(name, sizeof(name), "frame_%06llu.png", static_cast<unsigned long long>(_frame.number));
+		const std::string path = (fs::path(m_Settings.folder) / name).string();
+
+		if (!AtomicFile::Write(path, _buffer.data(), _buffer.size()))
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			++m_Stats.failed;
+			return false;
+		}
+
+		return true;
+	}
+
+	// public
+
+	FrameCapture::FrameCapture() :
+		m_Settings(),
+		m_Threads(),
+		m_Queue(),
+		m_FreeImages(),
+		m_Acquired(),
+		m_AcquiredNumber(0),
+		m_Presented(0),
+		m_NextNumber(0),
+		m_Capturing(false),
+		m_Mutex(),
+		m_Changed(),
+		m_RawFile(nullptr),
+		m_RawWidth(0),
+		m_RawHeight(0),
+		m_Stopping(false),
+		m_Stats(),
+		m_FramesWritten(nullptr),
+		m_FramesDropped(nullptr),
+		m_EncodeTimes(nullptr)
+	{
+	}
+
+	FrameCapture::~FrameCapture()
+	{
+		Stop();
+	}
+
+	bool FrameCapture::Start(const CaptureSettings& _settings)
+	{
+		assert(_settings.format < CaptureFormat::_COUNT); // Error: Invalid format.
+		assert(_settings.interval > 0 && _settings.queueFrames > 0 && _settings.encoderThreads > 0); // Error: Invalid capture settings.
+
+		Stop();
+
+		std::error_code error;
+		fs::create_directories(_settings.folder, error);
+		if (!fs::is_directory(_settings.folder, error))
+			return false;
+
+		FILE* rawFile = nullptr;
+		if (_settings.format == CaptureFormat::RAW)
+		{
+			rawFile = fopen((fs::path(_settings.folder) / RAW_STREAM_NAME).string().c_str(), "wb");
+			if (!rawFile)
+				return false;
+		}
+
+		m_Settings = _settings;
+		m_Presented = 0;
+		m_NextNumber = 0;
+		m_Capturing = true;
+		m_RawFile = rawFile;
+		m_RawWidth = 0;
+		m_RawHeight = 0;
+		m_Stopping = false;
+		m_Stats = CaptureStats();
+
+		const uint32_t threadCount = _settings.format == CaptureFormat::RAW ? 1 : _settings.encoderThreads;
+		for (uint32_t i = 0; i < threadCount; ++i)
+			m_Threads.emplace_back(&FrameCapture::ThreadLoop, this);
+
+		return true;
+	}
+
+	void FrameCapture::Stop()
+	{
+		if (!m_Capturing)
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Stopping = true;
+		}
+
+		m_Changed.notify_all();
+		for (std::thread& thread : m_Threads)
+			thread.join();
+
+		m_Threads.clear();
+		m_Capturing = false;
+
+		if (m_RawFile && fclose(m_RawFile) != 0)
+			++m_Stats.failed;
+
+		m_RawFile = nullptr;
+	}
+
+	bool FrameCapture::IsCapturing() const
+	{
+		return m_Capturing;
+	}
+
+	bool FrameCapture::CountFrame()
+	{
+		return m_Capturing && m_Presented++ % m_Settings.interval == 0;
+	}
+
+	Image* FrameCapture::AcquireFrame(uint32_t _width, uint32_t _height)
+	{
+		assert(m_Capturing); // Error: Frames can only be acquired while capturing.
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		const uint64_t number = m_NextNumber++;
+
+		if (m_Queue.size() >= m_Settings.queueFrames)
+		{
+			if (m_Settings.dropWhenBehind)
+			{
+				++m_Stats.dropped;
+				if (m_FramesDropped)
+					m_FramesDropped->Add();
+
+				return nullptr;
+			}
+
+			m_Changed.wait(lock, [this] { return m_Queue.size() < m_Settings.queueFrames; });
+		}
+
+		// Reuse a written frame's buffer, so steady capture stops allocating after the first few frames.
+		if (!m_FreeImages.empty())
+		{
+			m_Acquired = std::move(m_FreeImages.back());
+			m_FreeImages.pop_back();
+		}
+
+		lock.unlock();
+
+		m_Acquired.width = _width;
+		m_Acquired.height = _height;
+		m_Acquired.channels = 4;
+		m_Acquired.pixels.resize(static_cast<size_t>(_width) * _height * 4);
+		m_AcquiredNumber = number;
+
+		return &m_Acquired;
+	}
+
+	void FrameCapture::SubmitFrame()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Queue.push_back(Frame{ std::move(m_Acquired), m_AcquiredNumber });
+			++m_Stats.captured;
+		}
+
+		m_Changed.notify_one();
+	}
+
+	CaptureStats FrameCapture::GetStats()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Stats;
+	}
+
+	const CaptureSettings& FrameCapture::GetSettings() const
+	{
+		return m_Settings;
+	}
+
+	void FrameCapture::RegisterMetrics(MetricsRegistry& _registry)
+	{
+		m_FramesWritten = &_registry.GetCounter("capture_frames_written_total", "Captured frames written to disk.");
+		m_FramesDropped = &_registry.GetCounter("capture_frames_dropped_total", "Captured frames dropped because the encoders were behind.");
+		m_EncodeTimes = &_registry.GetHistogram("capture_encode_microseconds", "Time taken to encode and write one captured frame.");
+	}
+}
@@ -0,0 +1,156 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: FrameCapture.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Streams presented frames to disk without holding up the renderer. Renderers copy each
+		captured frame into a buffer from a small pool and queue it. Background encoder threads turn
+		queued frames into PNG files, or append them to one raw RGBA stream, and hand the buffers back
+		for reuse. When the encoders fall behind, Present either waits for room, so offline renders
+		keep every frame, or drops the frame, so live play keeps its frame rate.
+
+		Raw streams are what video encoders read fastest, for example:
+
+			ffmpeg -f rawvideo -pixel_format rgba -video_size 1920x1080 -framerate 60 -i frames.rgba replay.mp4
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../Content/Image.h"
+
+namespace OC
+{
+	class Counter;
+	class Histogram;
+	class MetricsRegistry;
+
+	enum class CaptureFormat : uint8_t
+	{
+		PNG,	// One file per frame, frame_000000.png and so on, numbered by captured frame.
+		RAW,	// Every frame appended to frames.rgba, 4 bytes per pixel, rows from the top.
+		_COUNT
+	};
+
+	struct CaptureSettings
+	{
+		std::string folder; // Where frames are written. Created if it doesn't exist.
+		CaptureFormat format = CaptureFormat::PNG; // How frames are written.
+		uint32_t interval = 1; // Captures every this many presented frames.
+		uint32_t queueFrames = 8; // The most frames waiting for the encoders.
+		uint32_t encoderThreads = 1; // The threads encoding PNG frames. RAW always uses one, to keep frames in order.
+		uint32_t stagingFrames = 3; // GPU backends: frames between copying a frame and reading it back, so reading never waits on the GPU.
+		bool dropWhenBehind = false; // Drops frames when the queue is full, rather than making Present wait.
+	};
+
+	struct CaptureStats
+	{
+		uint64_t captured; // Frames queued for the encoders.
+		uint64_t written; // Frames written to disk.
+		uint64_t dropped; // Frames skipped because the encoders were behind, or because a raw stream's size changed.
+		uint64_t failed; // Frames that couldn't be written.
+	};
+
+	class FrameCapture
+	{
+	private:
+		// A captured frame waiting for an encoder.
+		struct Frame
+		{
+			Image image; // The pixels, RGBA.
+			uint64_t number; // The frame's number since capture started.
+		};
+
+		CaptureSettings m_Settings; // How frames are captured and written.
+		std::vector<std::thread> m_Threads; // Encode and write frames.
+		std::deque<Frame> m_Queue; // Frames waiting for an encoder.
+		std::vector<Image> m_FreeImages; // Buffers of written frames, kept for the next captures.
+		Image m_Acquired; // The buffer handed out by AcquireFrame, until SubmitFrame queues it.
+		uint64_t m_AcquiredNumber; // The number of the frame in m_Acquired.
+		uint64_t m_Presented; // Frames presented since capture started.
+		uint64_t m_NextNumber; // The number of the next frame offered to AcquireFrame, so dropped frames leave gaps.
+		bool m_Capturing; // If frames are being captured.
+		std::mutex m_Mutex; // Guards everything below, which the threads share.
+		std::condition_variable m_Changed; // Signalled when a frame is queued or written, or capture stops.
+		FILE* m_RawFile; // The raw stream, while capturing RAW.
+		uint32_t m_RawWidth, m_RawHeight; // The size of the raw stream's frames, set by its first frame.
+		bool m_Stopping; // Tells the threads to exit once the queue is empty.
+		CaptureStats m_Stats; // What happened to the frames of the current or last capture.
+		Counter* m_FramesWritten; // Counts frames written. nullptr until metrics are registered.
+		Counter* m_FramesDropped; // Counts frames dropped.
+		Histogram* m_EncodeTimes; // How long each frame took to encode and write, in microseconds.
+
+		// Description: Encodes queued frames until capture stops.
+		void ThreadLoop();
+
+		// Description: Encodes a frame and writes it.
+		// Parameters: 
+		//    const Frame& _frame, the frame.
+		//    std::vector<uint8_t>& _buffer, scratch space for the encoded file.
+		// Returns: true, if the frame was written.
+		bool WriteFrame(const Frame& _frame, std::vector<uint8_t>& _buffer);
+
+	public:
+		// Description: Constructs a capture that isn't capturing.
+		FrameCapture();
+
+		// Description: FrameCapture's cannot be created from other FrameCapture's.
+		FrameCapture(const FrameCapture& _capture) = delete;
+
+		// Description: Writes the queued frames and stops capturing.
+		~FrameCapture();
+
+		// Description: FrameCapture's cannot be assigned to other FrameCapture's.
+		void operator=(const FrameCapture& _capture) = delete;
+
+		// Description: Starts capturing, stopping any capture already running.
+		// Parameters: 
+		//    const CaptureSettings& _settings, how frames are captured and written.
+		// Returns: true, if the folder and, for RAW, the stream could be created.
+		bool Start(const CaptureSettings& _settings);
+
+		// Description: Waits for the queued frames to be written and stops capturing.
+		void Stop();
+
+		// Description: Returns if frames are being captured.
+		// Returns: true, if capturing.
+		bool IsCapturing() const;
+
+		// Description: Counts a presented frame. Called once per Present while capturing.
+		// Returns: true, if the frame is due to be captured.
+		bool CountFrame();
+
+		// Description: Returns a buffer to copy a captured frame into. Waits for room in the queue, or
+		//    drops the frame when dropWhenBehind is set.
+		// Parameters: 
+		//    uint32_t _width, the width of the frame, in pixels.
+		//    uint32_t _height, the height of the frame, in pixels.
+		// Returns: The buffer, sized and RGBA, or nullptr if the frame was dropped. Valid until SubmitFrame.
+		Image* AcquireFrame(uint32_t _width, uint32_t _height);
+
+		// Description: Queues the frame copied into the buffer from AcquireFrame for the encoders.
+		void SubmitFrame();
+
+		// Description: Returns what happened to the frames of the current or last capture.
+		// Returns: The counts.
+		CaptureStats GetStats();
+
+		// Description: Returns how frames are captured and written.
+		// Returns: The settings.
+		const CaptureSettings& GetSettings() const;
+
+		// Description: Registers the capture's metrics and starts updating them.
+		// Parameters: 
+		//    MetricsRegistry& _registry, the registry to add the metrics to. Must outlive the capture.
+		void RegisterMetrics(MetricsRegistry& _registry);
+	};
+}
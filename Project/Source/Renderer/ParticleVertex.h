@@ -0,0 +1,39 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: ParticleVertex.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: One particle as the renderer draws it: a square sprite already placed on the screen.
+		Kept to 16 bytes, so a million particles upload in 16 MB.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+namespace OC
+{
+	struct ParticleVertex
+	{
+		float x, y; // The centre of the sprite, in pixels from the top-left of the screen.
+		float size; // The width and height of the sprite, in pixels.
+		uint32_t color; // RGBA, 8 bits each, red in the lowest byte.
+	};
+
+	static_assert(sizeof(ParticleVertex) == 16, "Open Conquer Error: ParticleVertex must stay 16 bytes");
+
+	// Description: Packs a color into the ParticleVertex format.
+	// Parameters: 
+	//    uint8_t _red, the red channel.
+	//    uint8_t _green, the green channel.
+	//    uint8_t _blue, the blue channel.
+	//    uint8_t _alpha, the opacity.
+	// Returns: The packed color.
+	constexpr uint32_t PackColor(uint8_t _red, uint8_t _green, uint8_t _blue, uint8_t _alpha)
+	{
+		return static_cast<uint32_t>(_red) | (static_cast<uint32_t>(_green) << 8) |
+			(static_cast<uint32_t>(_blue) << 16) | (static_cast<uint32_t>(_alpha) << 24);
+	}
+}
@@ -3,18 +3,24 @@
 	File: RendererInterface.h
 	Author: Ozzie Mercado
 	Created: December 9, 2020
-	Modified: December 10, 2020
+	Modified: October 18, 2026
 	Description: The interface that all renderer implementations share. Interface for creating the
-		renderer and drawing to the screen.
+		renderer, drawing to the screen and capturing what was drawn.
 -------------------------------------------------------------------------------------------------------
 */
 
 #pragma once
 
-#include "../Window/Window.h"
+#include <stdint.h>
+#include "FrameCapture.h"
+#include "ParticleVertex.h"
+#include "UiQuad.h"
 
 namespace OC
 {
+	class MetricsRegistry;
+	class Window;
+
 	class RendererInterface
 	{
 	private:
@@ -27,6 +33,9 @@ namespace OC
 		//    const Window& _window, the window to render to.
 		RendererInterface(const Window& _window) {};
 
+		// Description: Constructs a renderer that draws off screen, without a window.
+		RendererInterface() {};
+
 		// Description: Renderer's cannot be created from other renderer's.
 		RendererInterface(const RendererInterface& _renderer) = delete;
 
@@ -36,7 +45,45 @@ namespace OC
 		// Description: Renderer's cannot be assigned to other renderer's.
 		virtual void operator=(const RendererInterface& _renderer) = delete;
 
+		// Description: Queues particles to be drawn by the next Present, on top of the clear color.
+		// Parameters: 
+		//    const ParticleVertex* _vertices, the particles, positioned in pixels from the top-left corner.
+		//    uint32_t _count, the number of particles.
+		virtual void SubmitParticles(const ParticleVertex* _vertices, uint32_t _count) = 0;
+
+		// Description: Queues UI quads to be drawn by the next Present, on top of everything else.
+		// Parameters: 
+		//    const UiQuad* _quads, the quads, in drawing order.
+		//    uint32_t _count, the number of quads.
+		//    const UiAtlasImage& _atlas, the atlas the quads sample. Its dirty region is uploaded now.
+		virtual void SubmitUi(const UiQuad* _quads, uint32_t _count, const UiAtlasImage& _atlas) = 0;
+
 		// Description: Renders to the window.
 		virtual void Present() = 0;
+
+		// Description: Sets the share of the window's width and height to render at, to shed load.
+		//    Backends that draw on the CPU scale their output up to the window. GPU backends may ignore it.
+		// Parameters: 
+		//    float _scale, the share, greater than 0 and at most 1.
+		virtual void SetResolutionScale(float _scale) = 0;
+
+		// Description: Starts writing presented frames to disk, at the window's size. Frames are read back
+		//    and encoded in the background, so capturing doesn't stall rendering.
+		// Parameters: 
+		//    const CaptureSettings& _settings, how frames are captured and written.
+		// Returns: true, if capture started.
+		virtual bool StartCapture(const CaptureSettings& _settings) = 0;
+
+		// Description: Writes the frames still being read back or encoded, then stops capturing.
+		virtual void StopCapture() = 0;
+
+		// Description: Returns what happened to the frames of the current or last capture.
+		// Returns: The counts.
+		virtual CaptureStats GetCaptureStats() = 0;
+
+		// Description: Registers the renderer's metrics and starts updating them.
+		// Parameters: 
+		//    MetricsRegistry& _registry, the registry to add the metrics to. Must outlive the renderer.
+		virtual void RegisterMetrics(MetricsRegistry& _registry) = 0;
 	};
 }
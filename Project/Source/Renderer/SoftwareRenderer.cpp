@@ -0,0 +1,278 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: SoftwareRenderer.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <assert.h>
+#include <chrono>
+#include <math.h>
+#include <string.h>
+#include "SoftwareRenderer.h"
+#include "../Metrics/Metrics.h"
+
+namespace OC
+{
+	constexpr uint32_t CLEAR_COLOR = PackColor(51, 102, 204, 255); // The same blue the GPU backends clear to.
+
+	// Description: Returns the first and one past the last pixel whose centre lies in a span.
+	// Parameters: 
+	//    float _min, the start of the span, in pixels.
+	//    float _max, the end of the span, in pixels.
+	//    uint32_t _size, the number of pixels.
+	//    int32_t& _outFirst, receives the first pixel.
+	//    int32_t& _outEnd, receives one past the last pixel. Not past _outFirst if none are covered.
+	static void CoveredPixels(float _min, float _max, uint32_t _size, int32_t& _outFirst, int32_t& _outEnd)
+	{
+		const float first = ceilf(_min - 0.5f), end = ceilf(_max - 0.5f);
+		_outFirst = first > 0.0f ? (first < static_cast<float>(_size) ? static_cast<int32_t>(first) : static_cast<int32_t>(_size)) : 0;
+		_outEnd = end > 0.0f ? (end < static_cast<float>(_size) ? static_cast<int32_t>(end) : static_cast<int32_t>(_size)) : 0;
+	}
+
+	// private
+
+	void SoftwareRenderer::Resize()
+	{
+		m_DrawWidth = static_cast<uint32_t>(m_Width * m_Scale + 0.5f);
+		m_DrawHeight = static_cast<uint32_t>(m_Height * m_Scale + 0.5f);
+		m_DrawWidth = m_DrawWidth > 0 ? m_DrawWidth : 1;
+		m_DrawHeight = m_DrawHeight > 0 ? m_DrawHeight : 1;
+		m_Frame.assign(static_cast<size_t>(m_DrawWidth) * m_DrawHeight, CLEAR_COLOR);
+
+		m_ScaledColumns.resize(m_Width);
+		for (uint32_t x = 0; x < m_Width; ++x)
+			m_ScaledColumns[x] = static_cast<uint32_t>(static_cast<uint64_t>(x) * m_DrawWidth / m_Width);
+	}
+
+	void SoftwareRenderer::Blend(uint32_t& _pixel, uint32_t _color, float _alpha)
+	{
+		// Color is blended by the source alpha. Alpha itself adds the source to what the destination leaves.
+		const float keep = 1.0f - _alpha;
+		uint32_t result = 0;
+
+		for (uint32_t shift = 0; shift < 24; shift += 8)
+		{
+			const float channel = ((_color >> shift) & 0xFF) * _alpha + ((_pixel >> shift) & 0xFF) * keep;
+			result |= static_cast<uint32_t>(channel + 0.5f) << shift;
+		}
+
+		const float alpha = _alpha * 255.0f + (_pixel >> 24) * keep;
+		_pixel = result | (static_cast<uint32_t>(alpha + 0.5f) << 24);
+	}
+
+	void SoftwareRenderer::DrawParticles()
+	{
+		const float scale = static_cast<float>(m_DrawWidth) / m_Width;
+
+		for (const ParticleVertex& particle : m_Particles)
+		{
+			const float x = particle.x * scale, y = particle.y * scale, radius = particle.size * scale * 0.5f;
+			const float opacity = (particle.color >> 24) / 255.0f;
+
+			if (!(radius > 0.0f) || opacity <= 0.0f)
+				continue;
+
+			int32_t firstX, endX, firstY, endY;
+			CoveredPixels(x - radius, x + radius, m_DrawWidth, firstX, endX);
+			CoveredPixels(y - radius, y + radius, m_DrawHeight, firstY, endY);
+
+			// Fade from the centre to the edge like the GPU's pixel shader, reaching 0 at the quad's sides.
+			const float inverseRadius = 1.0f / radius;
+
+			for (int32_t row = firstY; row < endY; ++row)
+			{
+				const float offsetY = (row + 0.5f - y) * inverseRadius;
+				uint32_t* pixels = &m_Frame[static_cast<size_t>(row) * m_DrawWidth];
+
+				for (int32_t column = firstX; column < endX; ++column)
+				{
+					const float offsetX = (column + 0.5f - x) * inverseRadius;
+					const float fade = 1.0f - (offsetX * offsetX + offsetY * offsetY);
+
+					if (fade > 0.0f)
+						Blend(pixels[column], particle.color, opacity * (fade < 1.0f ? fade : 1.0f));
+				}
+			}
+		}
+
+		m_Particles.clear();
+	}
+
+	void SoftwareRenderer::DrawUi()
+	{
+		const float scale = static_cast<float>(m_DrawWidth) / m_Width;
+
+		for (const UiQuad& quad : m_UiQuads)
+		{
+			const float x = quad.x * scale, y = quad.y * scale, width = quad.width * scale, height = quad.height * scale;
+			const float opacity = (quad.color >> 24) / 255.0f;
+
+			if (!(width > 0.0f) || !(height > 0.0f) || opacity <= 0.0f || m_UiAtlas.empty())
+				continue;
+
+			int32_t firstX, endX, firstY, endY;
+			CoveredPixels(x, x + width, m_DrawWidth, firstX, endX);
+			CoveredPixels(y, y + height, m_DrawHeight, firstY, endY);
+
+			// Sample the atlas without filtering, at the texel under each pixel's centre.
+			const float stepU = (static_cast<float>(quad.u1) - quad.u0) / width, stepV = (static_cast<float>(quad.v1) - quad.v0) / height;
+
+			for (int32_t row = firstY; row < endY; ++row)
+			{
+				const float v = quad.v0 + (row + 0.5f - y) * stepV;
+				const uint32_t texelY = v > 0.0f ? (v < m_UiAtlasHeight - 1.0f ? static_cast<uint32_t>(v) : m_UiAtlasHeight - 1) : 0;
+				const uint8_t* coverage = &m_UiAtlas[static_cast<size_t>(texelY) * m_UiAtlasWidth];
+				uint32_t* pixels = &m_Frame[static_cast<size_t>(row) * m_DrawWidth];
+
+				for (int32_t column = firstX; column < endX; ++column)
+				{
+					const float u = quad.u0 + (column + 0.5f - x) * stepU;
+					const uint32_t texelX = u > 0.0f ? (u < m_UiAtlasWidth - 1.0f ? static_cast<uint32_t>(u) : m_UiAtlasWidth - 1) : 0;
+
+					if (coverage[texelX])
+						Blend(pixels[column], quad.color, opacity * (coverage[texelX] / 255.0f));
+				}
+			}
+		}
+
+		m_UiQuads.clear();
+	}
+
+	void SoftwareRenderer::CaptureFrame()
+	{
+		Image* frame = m_Capture.AcquireFrame(m_Width, m_Height);
+		if (!frame)
+			return;
+
+		// Rows and columns are repeated to scale up. Full-size frames are copied as they are.
+		for (uint32_t y = 0; y < m_Height; ++y)
+		{
+			const uint32_t* source = &m_Frame[static_cast<size_t>(static_cast<uint64_t>(y) * m_DrawHeight / m_Height) * m_DrawWidth];
+			uint8_t* destination = &frame->pixels[static_cast<size_t>(y) * m_Width * 4];
+
+			if (m_DrawWidth == m_Width)
+			{
+				memcpy(destination, source, static_cast<size_t>(m_Width) * 4);
+				continue;
+			}
+
+			for (uint32_t x = 0; x < m_Width; ++x)
+				memcpy(destination + static_cast<size_t>(x) * 4, &source[m_ScaledColumns[x]], 4);
+		}
+
+		m_Capture.SubmitFrame();
+	}
+
+	// public
+
+	SoftwareRenderer::SoftwareRenderer(uint32_t _width, uint32_t _height) :
+		RendererInterface(),
+		m_Width(_width),
+		m_Height(_height),
+		m_Scale(1.0f),
+		m_DrawWidth(0),
+		m_DrawHeight(0),
+		m_Frame(),
+		m_ScaledColumns(),
+		m_Particles(),
+		m_UiQuads(),
+		m_UiAtlas(),
+		m_UiAtlasWidth(0),
+		m_UiAtlasHeight(0),
+		m_Capture(),
+		m_PresentTimes(nullptr),
+		m_FramesPresented(nullptr)
+	{
+		assert(_width > 0 && _height > 0); // Error: The output can't be empty.
+
+		Resize();
+	}
+
+	SoftwareRenderer::~SoftwareRenderer()
+	{
+		StopCapture();
+	}
+
+	void SoftwareRenderer::SubmitParticles(const ParticleVertex* _vertices, uint32_t _count)
+	{
+		m_Particles.insert(m_Particles.end(), _vertices, _vertices + _count);
+	}
+
+	void SoftwareRenderer::SubmitUi(const UiQuad* _quads, uint32_t _count, const UiAtlasImage& _atlas)
+	{
+		if (m_UiAtlas.empty() || m_UiAtlasWidth != _atlas.width || m_UiAtlasHeight != _atlas.height)
+		{
+			// A new atlas is copied whole.
+			m_UiAtlas.assign(_atlas.pixels, _atlas.pixels + static_cast<size_t>(_atlas.width) * _atlas.height);
+			m_UiAtlasWidth = _atlas.width;
+			m_UiAtlasHeight = _atlas.height;
+		}
+		else if (_atlas.dirtyMinX < _atlas.dirtyMaxX && _atlas.dirtyMinY < _atlas.dirtyMaxY)
+		{
+			for (uint32_t y = _atlas.dirtyMinY; y < _atlas.dirtyMaxY; ++y)
+			{
+				const size_t offset = static_cast<size_t>(y) * _atlas.width + _atlas.dirtyMinX;
+				memcpy(&m_UiAtlas[offset], _atlas.pixels + offset, _atlas.dirtyMaxX - _atlas.dirtyMinX);
+			}
+		}
+
+		m_UiQuads.insert(m_UiQuads.end(), _quads, _quads + _count);
+	}
+
+	void SoftwareRenderer::Present()
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		std::fill(m_Frame.begin(), m_Frame.end(), CLEAR_COLOR);
+		DrawParticles();
+		DrawUi();
+
+		if (m_Capture.CountFrame())
+			CaptureFrame();
+
+		if (m_PresentTimes)
+		{
+			auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+			m_PresentTimes->Record(static_cast<uint64_t>(elapsed.count()));
+			m_FramesPresented->Add();
+		}
+	}
+
+	void SoftwareRenderer::SetResolutionScale(float _scale)
+	{
+		assert(_scale > 0.0f && _scale <= 1.0f); // Error: The scale must be greater than 0 and at most 1.
+
+		if (_scale == m_Scale)
+			return;
+
+		m_Scale = _scale;
+		Resize();
+	}
+
+	bool SoftwareRenderer::StartCapture(const CaptureSettings& _settings)
+	{
+		return m_Capture.Start(_settings);
+	}
+
+	void SoftwareRenderer::StopCapture()
+	{
+		m_Capture.Stop();
+	}
+
+	CaptureStats SoftwareRenderer::GetCaptureStats()
+	{
+		return m_Capture.GetStats();
+	}
+
+	void SoftwareRenderer::RegisterMetrics(MetricsRegistry& _registry)
+	{
+		m_PresentTimes = &_registry.GetHistogram("renderer_present_microseconds", "Time taken to clear and present one frame.");
+		m_FramesPresented = &_registry.GetCounter("renderer_frames_total", "Frames presented.");
+		m_Capture.RegisterMetrics(_registry);
+	}
+}
@@ -0,0 +1,113 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: SoftwareRenderer.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: A renderer that draws on the CPU into memory, without a window or a GPU. It draws the
+		same particles and UI as the other backends, blended the same way, so headless tools and servers
+		can render replays and capture them on any platform.
+
+		Frames are drawn at the resolution scale's share of the output size and scaled up to it when
+		captured, so shedding resolution makes drawing cheaper while captured frames keep their size.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include "RendererInterface.h"
+
+namespace OC
+{
+	class Counter;
+	class Histogram;
+
+	class SoftwareRenderer final : public RendererInterface
+	{
+	private:
+		uint32_t m_Width, m_Height; // The size of the output, in pixels.
+		float m_Scale; // The share of the output's width and height frames are drawn at.
+		uint32_t m_DrawWidth, m_DrawHeight; // The size frames are drawn at, in pixels.
+		std::vector<uint32_t> m_Frame; // The frame being drawn, in the ParticleVertex color format, row by row.
+		std::vector<uint32_t> m_ScaledColumns; // The column of the frame each output column shows.
+		std::vector<ParticleVertex> m_Particles; // Particles submitted since the last Present.
+		std::vector<UiQuad> m_UiQuads; // UI quads submitted since the last Present.
+		std::vector<uint8_t> m_UiAtlas; // A copy of the UI atlas, kept up to date by SubmitUi.
+		uint32_t m_UiAtlasWidth, m_UiAtlasHeight; // The size of m_UiAtlas, in pixels.
+		FrameCapture m_Capture; // Encodes and writes captured frames in the background.
+		Histogram* m_PresentTimes; // How long each Present took, in microseconds. nullptr until metrics are registered.
+		Counter* m_FramesPresented; // Counts presented frames.
+
+		// Description: Sizes the frame for the output size and resolution scale.
+		void Resize();
+
+		// Description: Blends a color over a pixel, the way the GPU backends' alpha blending does.
+		// Parameters: 
+		//    uint32_t& _pixel, the pixel.
+		//    uint32_t _color, the color, in the ParticleVertex color format.
+		//    float _alpha, the color's opacity, from 0 to 1.
+		static void Blend(uint32_t& _pixel, uint32_t _color, float _alpha);
+
+		// Description: Draws the submitted particles as soft round dots, then forgets them.
+		void DrawParticles();
+
+		// Description: Draws the submitted UI quads, tinting the atlas coverage they sample, then forgets them.
+		void DrawUi();
+
+		// Description: Scales the frame up to the output size and queues it for encoding.
+		void CaptureFrame();
+
+	public:
+		// Description: Constructs a renderer that draws frames of a given size into memory.
+		// Parameters: 
+		//    uint32_t _width, the width of the output, in pixels.
+		//    uint32_t _height, the height of the output, in pixels.
+		SoftwareRenderer(uint32_t _width, uint32_t _height);
+
+		// Description: Writes the frames still being encoded and cleans up this instance.
+		~SoftwareRenderer();
+
+		// Description: Queues particles to be drawn by the next Present, on top of the clear color.
+		// Parameters: 
+		//    const ParticleVertex* _vertices, the particles, positioned in pixels from the top-left corner.
+		//    uint32_t _count, the number of particles.
+		void SubmitParticles(const ParticleVertex* _vertices, uint32_t _count);
+
+		// Description: Queues UI quads to be drawn by the next Present, on top of everything else.
+		// Parameters: 
+		//    const UiQuad* _quads, the quads, in drawing order.
+		//    uint32_t _count, the number of quads.
+		//    const UiAtlasImage& _atlas, the atlas the quads sample. Its dirty region is copied now.
+		void SubmitUi(const UiQuad* _quads, uint32_t _count, const UiAtlasImage& _atlas);
+
+		// Description: Draws the submitted particles and UI into memory, and captures the frame if due.
+		void Present();
+
+		// Description: Sets the share of the output's width and height to draw at. Captured frames are
+		//    scaled back up to the output size.
+		// Parameters: 
+		//    float _scale, the share, greater than 0 and at most 1.
+		void SetResolutionScale(float _scale);
+
+		// Description: Starts writing presented frames to disk, at the output size. Frames are encoded in
+		//    the background, so capturing costs Present one copy per frame.
+		// Parameters: 
+		//    const CaptureSettings& _settings, how frames are captured and written.
+		// Returns: true, if capture started.
+		bool StartCapture(const CaptureSettings& _settings);
+
+		// Description: Writes the frames still being encoded, then stops capturing.
+		void StopCapture();
+
+		// Description: Returns what happened to the frames of the current or last capture.
+		// Returns: The counts.
+		CaptureStats GetCaptureStats();
+
+		// Description: Registers the renderer's metrics and starts updating them.
+		// Parameters: 
+		//    MetricsRegistry& _registry, the registry to add the metrics to. Must outlive the renderer.
+		void RegisterMetrics(MetricsRegistry& _registry);
+	};
+}
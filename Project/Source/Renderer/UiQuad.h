@@ -0,0 +1,40 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: UiQuad.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: The interface between the UI layer and the renderer. Every panel and glyph on screen
+		is one UiQuad that samples a rectangle of a single-channel atlas, so the whole HUD is one
+		instanced draw. The atlas travels with the quads as a UiAtlasImage, along with the region that
+		changed since it was last submitted.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+namespace OC
+{
+	struct UiQuad
+	{
+		float x, y; // The top-left corner, in pixels from the top-left of the screen.
+		float width, height; // The size, in pixels.
+		uint16_t u0, v0; // The top-left of the atlas rectangle sampled, in atlas pixels.
+		uint16_t u1, v1; // The bottom-right of the atlas rectangle sampled, in atlas pixels.
+		uint32_t color; // RGBA, 8 bits each, red in the lowest byte. Multiplied by the atlas coverage.
+	};
+
+	static_assert(sizeof(UiQuad) == 28, "Open Conquer Error: UiQuad must stay 28 bytes");
+
+	// The atlas quads sample from. Only the dirty region needs uploading, unless the renderer has never
+	// seen an atlas of this size.
+	struct UiAtlasImage
+	{
+		const uint8_t* pixels; // Coverage from 0 to 255, row by row.
+		uint32_t width, height; // The size of the atlas, in pixels.
+		uint32_t dirtyMinX, dirtyMinY; // The top-left of the region that changed.
+		uint32_t dirtyMaxX, dirtyMaxY; // One past the bottom-right of the region that changed. Empty if not past the top-left.
+	};
+}
@@ -3,19 +3,103 @@
 	File: Win32DirectX11Renderer.cpp	
 	Author: Ozzie Mercado
 	Created: December 9, 2020
-	Modified: December 10, 2020
+	Modified: October 18, 2026
 	Note: See header for more documentation.
 -------------------------------------------------------------------------------------------------------
 */
 
 #include <assert.h>
+#include <chrono>
+#include <d3dcompiler.h>
+#include <stddef.h>
+#include <string.h>
 #include "Win32DirectX11Renderer.h"
 
 namespace OC
 {
 	// private
 
-	Renderer* Renderer::s_Instance = nullptr;
+	// Each instance is one particle or UI quad. The quad's corner comes from the vertex id, so no vertex
+	// buffer is needed beyond the instances.
+	static const char QUAD_SHADERS[] = R"(
+		cbuffer Viewport : register(b0)
+		{
+			float2 g_ViewportSize;
+			float2 g_AtlasSize;
+		};
+
+		Texture2D<float> g_Atlas : register(t0);
+		SamplerState g_Sampler : register(s0);
+
+		float4 ToClip(float2 _pixel)
+		{
+			return float4(_pixel.x / g_ViewportSize.x * 2.0f - 1.0f, 1.0f - _pixel.y / g_ViewportSize.y * 2.0f, 0.0f, 1.0f);
+		}
+
+		struct ParticleIn
+		{
+			float2 position : POSITION;
+			float size : SIZE;
+			float4 color : COLOR;
+			uint corner : SV_VertexID;
+		};
+
+		struct ParticlePixelIn
+		{
+			float4 position : SV_POSITION;
+			float2 offset : TEXCOORD0;
+			float4 color : COLOR;
+		};
+
+		ParticlePixelIn ParticleVertexMain(ParticleIn _in)
+		{
+			float2 offset = float2((_in.corner & 1) ? 1.0f : -1.0f, (_in.corner & 2) ? 1.0f : -1.0f);
+
+			ParticlePixelIn result;
+			result.position = ToClip(_in.position + offset * (_in.size * 0.5f));
+			result.offset = offset;
+			result.color = _in.color;
+			return result;
+		}
+
+		float4 ParticlePixelMain(ParticlePixelIn _in) : SV_TARGET
+		{
+			float fade = saturate(1.0f - dot(_in.offset, _in.offset));
+			return float4(_in.color.rgb, _in.color.a * fade);
+		}
+
+		struct UiIn
+		{
+			float2 position : POSITION;
+			float2 size : SIZE;
+			uint4 atlasRect : TEXCOORD0;
+			float4 color : COLOR;
+			uint corner : SV_VertexID;
+		};
+
+		struct UiPixelIn
+		{
+			float4 position : SV_POSITION;
+			float2 uv : TEXCOORD0;
+			float4 color : COLOR;
+		};
+
+		UiPixelIn UiVertexMain(UiIn _in)
+		{
+			float2 corner = float2(_in.corner & 1, (_in.corner >> 1) & 1);
+
+			UiPixelIn result;
+			result.position = ToClip(_in.position + corner * _in.size);
+			result.uv = lerp(float2(_in.atlasRect.xy), float2(_in.atlasRect.zw), corner) / g_AtlasSize;
+			result.color = _in.color;
+			return result;
+		}
+
+		float4 UiPixelMain(UiPixelIn _in) : SV_TARGET
+		{
+			return float4(_in.color.rgb, _in.color.a * g_Atlas.Sample(g_Sampler, _in.uv));
+		}
+	)";
 
 	void Renderer::Resize() // TODO: A way to call this when the window resizes. Event System or intercepting window messages would help.
 	{
@@ -23,6 +107,200 @@ namespace OC
 		AssertHResult( m_swapChain->ResizeBuffers(2, 0, 0, DXGI_FORMAT_B8G8R8A8_UNORM, 0) );
 	}
 
+	void Renderer::CreateQuadPipelines()
+	{
+		// Compile the shaders.
+
+		const char* entryPoints[4] = { "ParticleVertexMain", "ParticlePixelMain", "UiVertexMain", "UiPixelMain" };
+		const char* targets[4] = { "vs_5_0", "ps_5_0", "vs_5_0", "ps_5_0" };
+		ID3DBlob* code[4] = {};
+
+		for (unsigned int i = 0; i < 4; ++i)
+			AssertHResult(D3DCompile(QUAD_SHADERS, sizeof(QUAD_SHADERS) - 1, "QuadShaders", nullptr, nullptr, entryPoints[i], targets[i], 0, 0, &code[i], nullptr));
+
+		AssertHResult(m_d3dDevice->CreateVertexShader(code[0]->GetBufferPointer(), code[0]->GetBufferSize(), nullptr, &m_ParticleVertexShader));
+		AssertHResult(m_d3dDevice->CreatePixelShader(code[1]->GetBufferPointer(), code[1]->GetBufferSize(), nullptr, &m_ParticlePixelShader));
+		AssertHResult(m_d3dDevice->CreateVertexShader(code[2]->GetBufferPointer(), code[2]->GetBufferSize(), nullptr, &m_UiVertexShader));
+		AssertHResult(m_d3dDevice->CreatePixelShader(code[3]->GetBufferPointer(), code[3]->GetBufferSize(), nullptr, &m_UiPixelShader));
+
+		// Describe ParticleVertex and UiQuad, advancing once per instance.
+
+		D3D11_INPUT_ELEMENT_DESC particleElements[] =
+		{
+			{ "POSITION", 0, DXGI_FORMAT_R32G32_FLOAT, 0, offsetof(ParticleVertex, x), D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+			{ "SIZE", 0, DXGI_FORMAT_R32_FLOAT, 0, offsetof(ParticleVertex, size), D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+			{ "COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, offsetof(ParticleVertex, color), D3D11_INPUT_PER_INSTANCE_DATA, 1 }
+		};
+		AssertHResult(m_d3dDevice->CreateInputLayout(particleElements, 3, code[0]->GetBufferPointer(), code[0]->GetBufferSize(), &m_ParticleLayout));
+
+		D3D11_INPUT_ELEMENT_DESC uiElements[] =
+		{
+			{ "POSITION", 0, DXGI_FORMAT_R32G32_FLOAT, 0, offsetof(UiQuad, x), D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+			{ "SIZE", 0, DXGI_FORMAT_R32G32_FLOAT, 0, offsetof(UiQuad, width), D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+			{ "TEXCOORD", 0, DXGI_FORMAT_R16G16B16A16_UINT, 0, offsetof(UiQuad, u0), D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+			{ "COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, offsetof(UiQuad, color), D3D11_INPUT_PER_INSTANCE_DATA, 1 }
+		};
+		AssertHResult(m_d3dDevice->CreateInputLayout(uiElements, 4, code[2]->GetBufferPointer(), code[2]->GetBufferSize(), &m_UiLayout));
+
+		for (unsigned int i = 0; i < 4; ++i)
+			code[i]->Release();
+
+		D3D11_SAMPLER_DESC samplerDesc;
+		ZeroMemory(&samplerDesc, sizeof(D3D11_SAMPLER_DESC));
+		samplerDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_POINT;
+		samplerDesc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
+		samplerDesc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
+		samplerDesc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
+		samplerDesc.MaxLOD = D3D11_FLOAT32_MAX;
+		AssertHResult(m_d3dDevice->CreateSamplerState(&samplerDesc, &m_PointSampler));
+
+		// Create the viewport constants and the blend state.
+
+		D3D11_BUFFER_DESC viewportDesc;
+		ZeroMemory(&viewportDesc, sizeof(D3D11_BUFFER_DESC));
+		viewportDesc.ByteWidth = 4 * sizeof(float);
+		viewportDesc.Usage = D3D11_USAGE_DYNAMIC;
+		viewportDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+		viewportDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		AssertHResult(m_d3dDevice->CreateBuffer(&viewportDesc, nullptr, &m_ViewportBuffer));
+
+		D3D11_BLEND_DESC blendDesc;
+		ZeroMemory(&blendDesc, sizeof(D3D11_BLEND_DESC));
+		blendDesc.RenderTarget[0].BlendEnable = true;
+		blendDesc.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA;
+		blendDesc.RenderTarget[0].DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
+		blendDesc.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD;
+		blendDesc.RenderTarget[0].SrcBlendAlpha = D3D11_BLEND_ONE;
+		blendDesc.RenderTarget[0].DestBlendAlpha = D3D11_BLEND_INV_SRC_ALPHA;
+		blendDesc.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
+		blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+		AssertHResult(m_d3dDevice->CreateBlendState(&blendDesc, &m_AlphaBlend));
+	}
+
+	void Renderer::UploadInstances(ID3D11Buffer*& _buffer, uint32_t& _capacity, const void* _instances, uint32_t _count, uint32_t _stride)
+	{
+		// Grow by doubling, so a frame with a few more instances doesn't recreate the buffer each time.
+		if (_count > _capacity)
+		{
+			SafeRelease(_buffer);
+			_buffer = nullptr;
+
+			uint32_t capacity = _capacity > 0 ? _capacity : 4096;
+			while (capacity < _count)
+				capacity *= 2;
+
+			D3D11_BUFFER_DESC bufferDesc;
+			ZeroMemory(&bufferDesc, sizeof(D3D11_BUFFER_DESC));
+			bufferDesc.ByteWidth = capacity * _stride;
+			bufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+			bufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+			bufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+			AssertHResult(m_d3dDevice->CreateBuffer(&bufferDesc, nullptr, &_buffer));
+			_capacity = capacity;
+		}
+
+		D3D11_MAPPED_SUBRESOURCE mapped;
+		AssertHResult(m_d3dDeviceContext->Map(_buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped));
+		memcpy(mapped.pData, _instances, static_cast<size_t>(_count) * _stride);
+		m_d3dDeviceContext->Unmap(_buffer, 0);
+	}
+
+	void Renderer::DrawParticles()
+	{
+		if (m_Particles.empty())
+			return;
+
+		uint32_t count = static_cast<uint32_t>(m_Particles.size());
+		UploadInstances(m_ParticleBuffer, m_ParticleBufferCapacity, m_Particles.data(), count, sizeof(ParticleVertex));
+
+		UINT stride = sizeof(ParticleVertex);
+		UINT offset = 0;
+		m_d3dDeviceContext->IASetInputLayout(m_ParticleLayout);
+		m_d3dDeviceContext->IASetVertexBuffers(0, 1, &m_ParticleBuffer, &stride, &offset);
+		m_d3dDeviceContext->VSSetShader(m_ParticleVertexShader, nullptr, 0);
+		m_d3dDeviceContext->PSSetShader(m_ParticlePixelShader, nullptr, 0);
+		m_d3dDeviceContext->DrawInstanced(4, count, 0, 0);
+
+		m_Particles.clear();
+	}
+
+	void Renderer::DrawUi()
+	{
+		if (m_UiQuads.empty())
+			return;
+
+		uint32_t count = static_cast<uint32_t>(m_UiQuads.size());
+		UploadInstances(m_UiBuffer, m_UiBufferCapacity, m_UiQuads.data(), count, sizeof(UiQuad));
+
+		UINT stride = sizeof(UiQuad);
+		UINT offset = 0;
+		m_d3dDeviceContext->IASetInputLayout(m_UiLayout);
+		m_d3dDeviceContext->IASetVertexBuffers(0, 1, &m_UiBuffer, &stride, &offset);
+		m_d3dDeviceContext->VSSetShader(m_UiVertexShader, nullptr, 0);
+		m_d3dDeviceContext->PSSetShader(m_UiPixelShader, nullptr, 0);
+		m_d3dDeviceContext->PSSetShaderResources(0, 1, &m_UiAtlasView);
+		m_d3dDeviceContext->PSSetSamplers(0, 1, &m_PointSampler);
+		m_d3dDeviceContext->DrawInstanced(4, count, 0, 0);
+
+		m_UiQuads.clear();
+	}
+
+	void Renderer::CaptureBackBuffer()
+	{
+		if (m_CapturePending == m_CaptureStaging.size())
+			ReadBackCapture(true);
+
+		ID3D11Texture2D* backBuffer;
+		AssertHResult(m_swapChain->GetBuffer(0, IID_PPV_ARGS(&backBuffer)));
+		m_d3dDeviceContext->CopyResource(m_CaptureStaging[m_CaptureNext], backBuffer);
+		backBuffer->Release();
+
+		m_CaptureNext = (m_CaptureNext + 1) % static_cast<uint32_t>(m_CaptureStaging.size());
+		++m_CapturePending;
+	}
+
+	bool Renderer::ReadBackCapture(bool _wait)
+	{
+		const uint32_t ringSize = static_cast<uint32_t>(m_CaptureStaging.size());
+		ID3D11Texture2D* staging = m_CaptureStaging[(m_CaptureNext + ringSize - m_CapturePending) % ringSize];
+
+		D3D11_MAPPED_SUBRESOURCE mapped;
+		HRESULT result = m_d3dDeviceContext->Map(staging, 0, D3D11_MAP_READ, _wait ? 0 : D3D11_MAP_FLAG_DO_NOT_WAIT, &mapped);
+		if (result == DXGI_ERROR_WAS_STILL_DRAWING)
+			return false;
+
+		AssertHResult(result);
+		--m_CapturePending;
+
+		// The encoders may be behind, in which case the frame is dropped or this waits for room.
+		Image* frame = m_Capture.AcquireFrame(m_CaptureWidth, m_CaptureHeight);
+
+		if (frame)
+		{
+			const size_t stride = static_cast<size_t>(m_CaptureWidth) * 4;
+
+			for (uint32_t y = 0; y < m_CaptureHeight; ++y)
+			{
+				uint8_t* destination = &frame->pixels[y * stride];
+				memcpy(destination, static_cast<const uint8_t*>(mapped.pData) + static_cast<size_t>(y) * mapped.RowPitch, stride);
+
+				for (size_t i = 0; m_CaptureSwizzle && i < stride; i += 4)
+				{
+					uint8_t blue = destination[i];
+					destination[i] = destination[i + 2];
+					destination[i + 2] = blue;
+				}
+			}
+		}
+
+		m_d3dDeviceContext->Unmap(staging, 0);
+
+		if (frame)
+			m_Capture.SubmitFrame();
+
+		return true;
+	}
+
 	// public
 
 	Renderer::Renderer(const Window& _window) :
@@ -31,11 +309,38 @@ namespace OC
 		m_d3dDevice(nullptr),
 		m_d3dDeviceContext(nullptr),
 		m_swapChain(nullptr),
-		m_renderTargetView(nullptr)
+		m_renderTargetView(nullptr),
+		m_ParticleVertexShader(nullptr),
+		m_ParticlePixelShader(nullptr),
+		m_ParticleLayout(nullptr),
+		m_ParticleBuffer(nullptr),
+		m_UiVertexShader(nullptr),
+		m_UiPixelShader(nullptr),
+		m_UiLayout(nullptr),
+		m_UiBuffer(nullptr),
+		m_UiAtlas(nullptr),
+		m_UiAtlasView(nullptr),
+		m_PointSampler(nullptr),
+		m_ViewportBuffer(nullptr),
+		m_AlphaBlend(nullptr),
+		m_ParticleBufferCapacity(0),
+		m_UiBufferCapacity(0),
+		m_UiAtlasWidth(0),
+		m_UiAtlasHeight(0),
+		m_Particles(),
+		m_UiQuads(),
+		m_ViewportWidth(0.0f),
+		m_ViewportHeight(0.0f),
+		m_PresentTimes(nullptr),
+		m_FramesPresented(nullptr),
+		m_Capture(),
+		m_CaptureStaging(),
+		m_CaptureNext(0),
+		m_CapturePending(0),
+		m_CaptureWidth(0),
+		m_CaptureHeight(0),
+		m_CaptureSwizzle(false)
 	{
-		assert(!s_Instance); // Error: There can only be one instance of Renderer.
-
-		s_Instance = this;
 		m_WindowHandle = static_cast<HWND>(_window.GetHandle());
 
 		// Create the device and swap chain.
@@ -105,20 +410,83 @@ namespace OC
 		viewport.MaxDepth = D3D11_MAX_DEPTH;
 
 		m_d3dDeviceContext->RSSetViewports(1, &viewport);
+		m_ViewportWidth = viewport.Width;
+		m_ViewportHeight = viewport.Height;
+
+		CreateQuadPipelines();
 	}
 
 	Renderer::~Renderer()
 	{
-		s_Instance = nullptr;
+		StopCapture();
 
+		SafeRelease(m_ParticleVertexShader);
+		SafeRelease(m_ParticlePixelShader);
+		SafeRelease(m_ParticleLayout);
+		SafeRelease(m_ParticleBuffer);
+		SafeRelease(m_UiVertexShader);
+		SafeRelease(m_UiPixelShader);
+		SafeRelease(m_UiLayout);
+		SafeRelease(m_UiBuffer);
+		SafeRelease(m_UiAtlasView);
+		SafeRelease(m_UiAtlas);
+		SafeRelease(m_PointSampler);
+		SafeRelease(m_ViewportBuffer);
+		SafeRelease(m_AlphaBlend);
 		SafeRelease(m_d3dDevice);
 		SafeRelease(m_d3dDeviceContext);
 		SafeRelease(m_swapChain);
 		SafeRelease(m_renderTargetView);
 	}
 
+	void Renderer::SubmitParticles(const ParticleVertex* _vertices, uint32_t _count)
+	{
+		m_Particles.insert(m_Particles.end(), _vertices, _vertices + _count);
+	}
+
+	void Renderer::SubmitUi(const UiQuad* _quads, uint32_t _count, const UiAtlasImage& _atlas)
+	{
+		if (!m_UiAtlas || m_UiAtlasWidth != _atlas.width || m_UiAtlasHeight != _atlas.height)
+		{
+			// A new atlas is uploaded whole.
+			SafeRelease(m_UiAtlasView);
+			SafeRelease(m_UiAtlas);
+
+			D3D11_TEXTURE2D_DESC atlasDesc;
+			ZeroMemory(&atlasDesc, sizeof(D3D11_TEXTURE2D_DESC));
+			atlasDesc.Width = _atlas.width;
+			atlasDesc.Height = _atlas.height;
+			atlasDesc.MipLevels = 1;
+			atlasDesc.ArraySize = 1;
+			atlasDesc.Format = DXGI_FORMAT_R8_UNORM;
+			atlasDesc.SampleDesc.Count = 1;
+			atlasDesc.Usage = D3D11_USAGE_DEFAULT;
+			atlasDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+			D3D11_SUBRESOURCE_DATA initialData;
+			initialData.pSysMem = _atlas.pixels;
+			initialData.SysMemPitch = _atlas.width;
+			initialData.SysMemSlicePitch = 0;
+
+			AssertHResult(m_d3dDevice->CreateTexture2D(&atlasDesc, &initialData, &m_UiAtlas));
+			AssertHResult(m_d3dDevice->CreateShaderResourceView(m_UiAtlas, nullptr, &m_UiAtlasView));
+			m_UiAtlasWidth = _atlas.width;
+			m_UiAtlasHeight = _atlas.height;
+		}
+		else if (_atlas.dirtyMinX < _atlas.dirtyMaxX && _atlas.dirtyMinY < _atlas.dirtyMaxY)
+		{
+			D3D11_BOX box = { _atlas.dirtyMinX, _atlas.dirtyMinY, 0, _atlas.dirtyMaxX, _atlas.dirtyMaxY, 1 };
+			const uint8_t* source = _atlas.pixels + static_cast<size_t>(_atlas.dirtyMinY) * _atlas.width + _atlas.dirtyMinX;
+			m_d3dDeviceContext->UpdateSubresource(m_UiAtlas, 0, &box, source, _atlas.width, 0);
+		}
+
+		m_UiQuads.insert(m_UiQuads.end(), _quads, _quads + _count);
+	}
+
 	void Renderer::Present()
 	{
+		auto start = std::chrono::steady_clock::now();
+
 		// Specify the render target.
 		m_d3dDeviceContext->OMSetRenderTargets(1, &m_renderTargetView, nullptr); // No depth stencil for now.
 
@@ -126,7 +494,106 @@ namespace OC
 		constexpr float clearColor[4] = { 0.2f, 0.4f, 0.8f, 1.0f };
 		m_d3dDeviceContext->ClearRenderTargetView(m_renderTargetView, clearColor);
 
+		// Everything drawn on top of the clear color shares the quad pipeline state.
+		if (!m_Particles.empty() || !m_UiQuads.empty())
+		{
+			D3D11_MAPPED_SUBRESOURCE mapped;
+			AssertHResult(m_d3dDeviceContext->Map(m_ViewportBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped));
+			float sizes[4] = { m_ViewportWidth, m_ViewportHeight, static_cast<float>(m_UiAtlasWidth), static_cast<float>(m_UiAtlasHeight) };
+			memcpy(mapped.pData, sizes, sizeof(sizes));
+			m_d3dDeviceContext->Unmap(m_ViewportBuffer, 0);
+
+			m_d3dDeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+			m_d3dDeviceContext->VSSetConstantBuffers(0, 1, &m_ViewportBuffer);
+			m_d3dDeviceContext->OMSetBlendState(m_AlphaBlend, nullptr, 0xFFFFFFFF);
+
+			DrawParticles();
+			DrawUi();
+		}
+
+		// Copy the frame for capture before presenting, which discards the back buffer. Frames copied
+		// earlier are read back once the GPU has finished them.
+		if (m_Capture.CountFrame())
+			CaptureBackBuffer();
+
+		while (m_CapturePending > 0)
+		{
+			if (!ReadBackCapture(false))
+				break;
+		}
+
 		// Present the rendered image to the window.
 		AssertHResult( m_swapChain->Present(0, 0) ); // m_swapChain->Present(1, 0) for 2 buffers
+
+		if (m_PresentTimes)
+		{
+			auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+			m_PresentTimes->Record(static_cast<uint64_t>(elapsed.count()));
+			m_FramesPresented->Add();
+		}
+	}
+
+	void Renderer::SetResolutionScale(float _scale)
+	{
+		assert(_scale > 0.0f && _scale <= 1.0f); // Error: The scale must be greater than 0 and at most 1.
+	}
+
+	bool Renderer::StartCapture(const CaptureSettings& _settings)
+	{
+		assert(_settings.stagingFrames > 0); // Error: Frames need at least one staging texture.
+
+		StopCapture();
+
+		if (!m_Capture.Start(_settings))
+			return false;
+
+		// The staging textures match the back buffer, so frames copy across without conversion.
+		ID3D11Texture2D* backBuffer;
+		AssertHResult(m_swapChain->GetBuffer(0, IID_PPV_ARGS(&backBuffer)));
+
+		D3D11_TEXTURE2D_DESC stagingDesc;
+		backBuffer->GetDesc(&stagingDesc);
+		backBuffer->Release();
+
+		stagingDesc.Usage = D3D11_USAGE_STAGING;
+		stagingDesc.BindFlags = 0;
+		stagingDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+		stagingDesc.MiscFlags = 0;
+
+		m_CaptureStaging.assign(_settings.stagingFrames, nullptr);
+		for (ID3D11Texture2D*& staging : m_CaptureStaging)
+			AssertHResult(m_d3dDevice->CreateTexture2D(&stagingDesc, nullptr, &staging));
+
+		m_CaptureNext = 0;
+		m_CapturePending = 0;
+		m_CaptureWidth = stagingDesc.Width;
+		m_CaptureHeight = stagingDesc.Height;
+		m_CaptureSwizzle = stagingDesc.Format == DXGI_FORMAT_B8G8R8A8_UNORM;
+
+		return true;
+	}
+
+	void Renderer::StopCapture()
+	{
+		while (m_CapturePending > 0)
+			ReadBackCapture(true);
+
+		for (ID3D11Texture2D* staging : m_CaptureStaging)
+			SafeRelease(staging);
+
+		m_CaptureStaging.clear();
+		m_Capture.Stop();
+	}
+
+	CaptureStats Renderer::GetCaptureStats()
+	{
+		return m_Capture.GetStats();
+	}
+
+	void Renderer::RegisterMetrics(MetricsRegistry& _registry)
+	{
+		m_PresentTimes = &_registry.GetHistogram("renderer_present_microseconds", "Time taken to clear and present one frame.");
+		m_FramesPresented = &_registry.GetCounter("renderer_frames_total", "Frames presented.");
+		m_Capture.RegisterMetrics(_registry);
 	}
 }
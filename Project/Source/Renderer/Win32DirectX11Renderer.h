@@ -3,9 +3,15 @@
 	File: Win32DirectX11Renderer.h
 	Author: Ozzie Mercado
 	Created: December 9, 2020
-	Modified: December 10, 2020
+	Modified: October 18, 2026
 	Description: The Win32 implementation of the renderer interface. Creates a renderer, sets it up
-		to output to a given window, and presents rendered images to the screen.
+		to output to a given window, and presents rendered images to the screen. Particles and UI are
+		drawn as instanced quads from dynamic buffers that grow to fit the largest frame, one draw
+		call each. Only the changed region of the UI atlas is uploaded.
+
+		Captured frames are copied from the back buffer into a ring of staging textures and read back a
+		few frames later, once the GPU has finished with them, so capturing never waits on the GPU unless
+		it falls a whole ring behind.
 -------------------------------------------------------------------------------------------------------
 */
 
@@ -14,10 +20,14 @@
 #if defined(WIN32)
 
 #pragma comment(lib, "d3d11.lib")
+#pragma comment(lib, "d3dcompiler.lib")
 
 #include <d3d11.h>
 #include <assert.h>
+#include <vector>
 #include "RendererInterface.h"
+#include "../Metrics/Metrics.h"
+#include "../Window/Window.h"
 
 #define AssertHResult(_hr) assert(_hr >= 0)
 
@@ -26,13 +36,38 @@ namespace OC
 	class Renderer final : public RendererInterface
 	{
 	private:
-		static Renderer* s_Instance; // Private singleton used to ensure only one instance of this class exists.
-
 		HWND m_WindowHandle; // Handle to the window.
 		ID3D11Device* m_d3dDevice;
 		ID3D11DeviceContext* m_d3dDeviceContext;
 		IDXGISwapChain* m_swapChain;
 		ID3D11RenderTargetView* m_renderTargetView;
+		ID3D11VertexShader* m_ParticleVertexShader; // Expands each particle into a quad.
+		ID3D11PixelShader* m_ParticlePixelShader; // Draws a soft round dot.
+		ID3D11InputLayout* m_ParticleLayout; // Reads one ParticleVertex per instance.
+		ID3D11Buffer* m_ParticleBuffer; // The particles of the current frame. nullptr until the first particles.
+		ID3D11VertexShader* m_UiVertexShader; // Places each UI quad and its atlas rectangle.
+		ID3D11PixelShader* m_UiPixelShader; // Tints atlas coverage by the quad's color.
+		ID3D11InputLayout* m_UiLayout; // Reads one UiQuad per instance.
+		ID3D11Buffer* m_UiBuffer; // The UI quads of the current frame. nullptr until the first quads.
+		ID3D11Texture2D* m_UiAtlas; // The UI atlas. nullptr until the first quads.
+		ID3D11ShaderResourceView* m_UiAtlasView; // Lets the UI shader sample m_UiAtlas.
+		ID3D11SamplerState* m_PointSampler; // Samples the atlas without filtering, since glyphs are drawn at their size.
+		ID3D11Buffer* m_ViewportBuffer; // The viewport and atlas sizes, for turning pixels into clip and texture space.
+		ID3D11BlendState* m_AlphaBlend; // Blends particles and UI over what is behind them.
+		uint32_t m_ParticleBufferCapacity; // The most particles m_ParticleBuffer holds.
+		uint32_t m_UiBufferCapacity; // The most quads m_UiBuffer holds.
+		uint32_t m_UiAtlasWidth, m_UiAtlasHeight; // The size of m_UiAtlas, in pixels.
+		std::vector<ParticleVertex> m_Particles; // Particles submitted since the last Present.
+		std::vector<UiQuad> m_UiQuads; // UI quads submitted since the last Present.
+		float m_ViewportWidth, m_ViewportHeight; // The size of the back buffer, in pixels.
+		Histogram* m_PresentTimes; // How long each Present took, in microseconds. nullptr until metrics are registered.
+		Counter* m_FramesPresented; // Counts presented frames.
+		FrameCapture m_Capture; // Encodes and writes captured frames in the background.
+		std::vector<ID3D11Texture2D*> m_CaptureStaging; // The ring of textures captured frames are copied to and read back from.
+		uint32_t m_CaptureNext; // The staging texture the next captured frame is copied to.
+		uint32_t m_CapturePending; // The staging textures holding frames not yet read back, ending before m_CaptureNext.
+		uint32_t m_CaptureWidth, m_CaptureHeight; // The size of the staging textures, in pixels.
+		bool m_CaptureSwizzle; // If the back buffer is BGRA, so red and blue are swapped when read back.
 
 		// Description: Releases an IUnknown object. Fails safely if the pointer points to nullptr.
 		// Parameters: 
@@ -47,6 +82,34 @@ namespace OC
 		// Description: Resize the the renderer.
 		void Resize();
 
+		// Description: Compiles the particle and UI shaders and creates the states they draw with.
+		void CreateQuadPipelines();
+
+		// Description: Copies instances into a dynamic vertex buffer, recreating it larger if they don't fit.
+		// Parameters: 
+		//    ID3D11Buffer*& _buffer, the buffer. May be nullptr.
+		//    uint32_t& _capacity, the number of instances the buffer holds. Updated if it grows.
+		//    const void* _instances, the instances.
+		//    uint32_t _count, the number of instances.
+		//    uint32_t _stride, the size of an instance, in bytes.
+		void UploadInstances(ID3D11Buffer*& _buffer, uint32_t& _capacity, const void* _instances, uint32_t _count, uint32_t _stride);
+
+		// Description: Uploads and draws the submitted particles, then forgets them.
+		void DrawParticles();
+
+		// Description: Uploads and draws the submitted UI quads, then forgets them.
+		void DrawUi();
+
+		// Description: Copies the back buffer into the next staging texture, reading back the oldest
+		//    first if every staging texture is still waiting.
+		void CaptureBackBuffer();
+
+		// Description: Reads back the oldest staging texture waiting and queues its frame for encoding.
+		// Parameters: 
+		//    bool _wait, if the GPU is waited on when it hasn't finished the copy yet.
+		// Returns: true, if a frame was read back.
+		bool ReadBackCapture(bool _wait);
+
 	public:
 		// Description: Constructs the renderer system and sets it up to output to the window.
 		// Parameters: 
@@ -56,8 +119,45 @@ namespace OC
 		// Description: Remove the renderer from the window and clean up this instance.
 		~Renderer();
 
+		// Description: Queues particles to be drawn by the next Present, on top of the clear color.
+		// Parameters: 
+		//    const ParticleVertex* _vertices, the particles, positioned in pixels from the top-left corner.
+		//    uint32_t _count, the number of particles.
+		void SubmitParticles(const ParticleVertex* _vertices, uint32_t _count);
+
+		// Description: Queues UI quads to be drawn by the next Present, on top of everything else.
+		// Parameters: 
+		//    const UiQuad* _quads, the quads, in drawing order.
+		//    uint32_t _count, the number of quads.
+		//    const UiAtlasImage& _atlas, the atlas the quads sample. Its dirty region is uploaded now.
+		void SubmitUi(const UiQuad* _quads, uint32_t _count, const UiAtlasImage& _atlas);
+
 		// Description: Renders to the window.
 		void Present();
+
+		// Description: Ignored. The GPU draws particles and UI at the window's resolution for almost nothing.
+		// Parameters: 
+		//    float _scale, the share of the window's width and height to render at.
+		void SetResolutionScale(float _scale);
+
+		// Description: Starts writing presented frames to disk, at the window's size. Frames are read back
+		//    and encoded in the background, so capturing doesn't stall rendering.
+		// Parameters: 
+		//    const CaptureSettings& _settings, how frames are captured and written.
+		// Returns: true, if capture started.
+		bool StartCapture(const CaptureSettings& _settings);
+
+		// Description: Writes the frames still being read back or encoded, then stops capturing.
+		void StopCapture();
+
+		// Description: Returns what happened to the frames of the current or last capture.
+		// Returns: The counts.
+		CaptureStats GetCaptureStats();
+
+		// Description: Registers the renderer's metrics and starts updating them.
+		// Parameters: 
+		//    MetricsRegistry& _registry, the registry to add the metrics to. Must outlive the renderer.
+		void RegisterMetrics(MetricsRegistry& _registry);
 	};
 }
 
@@ -0,0 +1,66 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: AtomicFile.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <stdio.h>
+#include "AtomicFile.h"
+
+#if defined(WIN32)
+#include <filesystem>
+#include <windows.h>
+#endif
+
+namespace OC
+{
+	namespace AtomicFile
+	{
+		std::string GetTemporaryPath(const std::string& _path)
+		{
+			return _path + ".tmp";
+		}
+
+		bool Commit(const std::string& _path)
+		{
+			const std::string temporaryPath = GetTemporaryPath(_path);
+
+#if defined(WIN32)
+			// Narrow paths are in the ANSI code page, which is what path converts them from.
+			const bool moved = MoveFileExW(
+				std::filesystem::path(temporaryPath).c_str(), std::filesystem::path(_path).c_str(), MOVEFILE_REPLACE_EXISTING
+			) != 0;
+#else
+			// rename replaces the destination atomically.
+			const bool moved = rename(temporaryPath.c_str(), _path.c_str()) == 0;
+#endif
+
+			if (!moved)
+				remove(temporaryPath.c_str());
+
+			return moved;
+		}
+
+		bool Write(const std::string& _path, const void* _data, size_t _size)
+		{
+			const std::string temporaryPath = GetTemporaryPath(_path);
+			FILE* file = fopen(temporaryPath.c_str(), "wb");
+			bool written = file && fwrite(_data, 1, _size, file) == _size;
+
+			if (file && fclose(file) != 0)
+				written = false;
+
+			if (!written)
+			{
+				remove(temporaryPath.c_str());
+				return false;
+			}
+
+			return Commit(_path);
+		}
+	}
+}
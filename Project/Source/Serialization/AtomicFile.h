@@ -0,0 +1,43 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: AtomicFile.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Writes files so they are replaced in a single step. The new contents are written next
+		to the destination and moved over it only once complete, so a failed write or a crash leaves
+		either the old file or the new one, never half of one and never neither.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <string>
+
+namespace OC
+{
+	namespace AtomicFile
+	{
+		// Description: Returns where a file's new contents are written before they replace it.
+		// Parameters: 
+		//    const std::string& _path, the destination.
+		// Returns: The path of the temporary file.
+		std::string GetTemporaryPath(const std::string& _path);
+
+		// Description: Moves a completed temporary file over the destination in a single step, replacing
+		//    any file already there. The temporary file is removed if it can't be moved.
+		// Parameters: 
+		//    const std::string& _path, the destination.
+		// Returns: true, if the destination now holds the new contents.
+		bool Commit(const std::string& _path);
+
+		// Description: Writes a whole file, replacing any file already there in a single step.
+		// Parameters: 
+		//    const std::string& _path, the destination.
+		//    const void* _data, the contents.
+		//    size_t _size, the size of the contents, in bytes.
+		// Returns: true, if the file was written.
+		bool Write(const std::string& _path, const void* _data, size_t _size);
+	}
+}
@@ -0,0 +1,105 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: BackgroundSaver.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include "BackgroundSaver.h"
+
+namespace OC
+{
+	// private
+
+	void BackgroundSaver::ThreadLoop()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+
+		while (true)
+		{
+			m_Changed.wait(lock, [this] { return m_Stopping || !m_Jobs.empty(); });
+
+			if (m_Jobs.empty())
+				return; // Stopping, and nothing left to write.
+
+			Job job = std::move(m_Jobs.front());
+			m_Jobs.pop_front();
+			m_Writing = true;
+
+			lock.unlock();
+			bool written = job.snapshot.WriteFile(job.path.c_str());
+			lock.lock();
+
+			m_Writing = false;
+			m_Failures += written ? 0 : 1;
+			m_Changed.notify_all();
+		}
+	}
+
+	// public
+
+	BackgroundSaver::BackgroundSaver() :
+		m_Thread(),
+		m_Jobs(),
+		m_Mutex(),
+		m_Changed(),
+		m_Writing(false),
+		m_Stopping(false),
+		m_Failures(0)
+	{
+		m_Thread = std::thread(&BackgroundSaver::ThreadLoop, this);
+	}
+
+	BackgroundSaver::~BackgroundSaver()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Stopping = true;
+		}
+
+		m_Changed.notify_all();
+		m_Thread.join();
+	}
+
+	void BackgroundSaver::Save(SaveWriter&& _snapshot, const std::string& _path)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+
+			// A newer snapshot of the same file makes a queued one pointless.
+			for (Job& job : m_Jobs)
+			{
+				if (job.path == _path)
+				{
+					job.snapshot = std::move(_snapshot);
+					return;
+				}
+			}
+
+			m_Jobs.push_back(Job{ std::move(_snapshot), _path });
+		}
+
+		m_Changed.notify_all();
+	}
+
+	bool BackgroundSaver::IsBusy()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Writing || !m_Jobs.empty();
+	}
+
+	void BackgroundSaver::Wait()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_Changed.wait(lock, [this] { return !m_Writing && m_Jobs.empty(); });
+	}
+
+	unsigned int BackgroundSaver::GetFailureCount()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Failures;
+	}
+}
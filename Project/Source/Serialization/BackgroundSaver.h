@@ -0,0 +1,74 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: BackgroundSaver.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Writes saves on a thread of its own. The caller takes a snapshot into a SaveWriter,
+		which is quick, and hands it over. Compression, checksums and disk writes happen here, so
+		autosaves don't stall the frame or tick loop.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "SaveGame.h"
+
+namespace OC
+{
+	class BackgroundSaver
+	{
+	private:
+		struct Job
+		{
+			SaveWriter snapshot; // The save to write.
+			std::string path; // Where to write it.
+		};
+
+		std::thread m_Thread; // Writes the saves.
+		std::deque<Job> m_Jobs; // Saves waiting to be written.
+		std::mutex m_Mutex; // Guards everything below.
+		std::condition_variable m_Changed; // Signalled when a job is queued or finished.
+		bool m_Writing; // If the thread is writing a save right now.
+		bool m_Stopping; // Tells the thread to exit once the queue is empty.
+		unsigned int m_Failures; // The number of saves that couldn't be written.
+
+		// Description: Writes queued saves until the saver is destroyed.
+		void ThreadLoop();
+
+	public:
+		// Description: Constructs the saver and starts its thread.
+		BackgroundSaver();
+
+		// Description: BackgroundSaver's cannot be created from other BackgroundSaver's.
+		BackgroundSaver(const BackgroundSaver& _saver) = delete;
+
+		// Description: Finishes writing the queued saves and stops the thread.
+		~BackgroundSaver();
+
+		// Description: BackgroundSaver's cannot be assigned to other BackgroundSaver's.
+		void operator=(const BackgroundSaver& _saver) = delete;
+
+		// Description: Queues a snapshot to be written.
+		// Parameters: 
+		//    SaveWriter&& _snapshot, the save to write. Moved from.
+		//    const std::string& _path, the file to write.
+		void Save(SaveWriter&& _snapshot, const std::string& _path);
+
+		// Description: Returns if saves are queued or being written.
+		// Returns: true, if busy.
+		bool IsBusy();
+
+		// Description: Blocks until every queued save has been written.
+		void Wait();
+
+		// Description: Returns the number of saves that couldn't be written so far.
+		// Returns: The number of failures.
+		unsigned int GetFailureCount();
+	};
+}
@@ -0,0 +1,46 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Crc32.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include "Crc32.h"
+
+namespace OC
+{
+	// Description: The CRC of every byte value, built once at compile time.
+	struct Crc32Table
+	{
+		uint32_t entries[256];
+
+		constexpr Crc32Table() : entries()
+		{
+			for (uint32_t i = 0; i < 256; ++i)
+			{
+				uint32_t crc = i;
+
+				for (int bit = 0; bit < 8; ++bit)
+					crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320U : crc >> 1;
+
+				entries[i] = crc;
+			}
+		}
+	};
+
+	static constexpr Crc32Table s_Crc32Table;
+
+	uint32_t Crc32(const void* _data, size_t _size, uint32_t _crc)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(_data);
+		uint32_t crc = ~_crc;
+
+		for (size_t i = 0; i < _size; ++i)
+			crc = s_Crc32Table.entries[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+
+		return ~crc;
+	}
+}
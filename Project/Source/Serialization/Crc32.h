@@ -0,0 +1,25 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Crc32.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: CRC-32 (the zlib/PNG polynomial), used to detect corrupted save chunks.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace OC
+{
+	// Description: Computes or continues a CRC-32.
+	// Parameters: 
+	//    const void* _data, the bytes to checksum.
+	//    size_t _size, the number of bytes.
+	//    uint32_t _crc, the CRC of the bytes before these, or 0 to start a new one.
+	// Returns: The CRC of all bytes so far.
+	uint32_t Crc32(const void* _data, size_t _size, uint32_t _crc = 0);
+}
@@ -0,0 +1,279 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Deflate.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+
+	The stream is a 2-byte zlib header, one deflate block and the Adler-32 of the input, big endian.
+	The block uses the fixed codes: literals and lengths are 7 to 9 bits, distances 5, each followed
+	by its extra bits. Huffman codes are sent from their first bit, so they're stored bit-reversed and
+	written like any other value. If the block comes out larger than the input, it's replaced with
+	stored blocks of up to 65535 bytes.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <string.h>
+#include "Deflate.h"
+
+namespace OC
+{
+	namespace Deflate
+	{
+		constexpr size_t MIN_MATCH = 4; // The shortest match looked for. Deflate allows 3, but 4 hashes in one read.
+		constexpr size_t MAX_MATCH = 258; // The longest match deflate can code.
+		constexpr size_t MAX_DISTANCE = 32768; // The furthest back a match can be.
+		constexpr size_t MAX_STORED = 65535; // The most bytes in a stored block.
+		constexpr unsigned int HASH_BITS = 15; // Size of the match finder's table.
+		constexpr uint32_t END_OF_BLOCK = 256; // The symbol that ends a block.
+
+		static constexpr uint16_t LENGTH_BASES[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 }; // The shortest length of each length symbol.
+		static constexpr uint8_t LENGTH_EXTRA[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 }; // The extra bits of each length symbol.
+		static constexpr uint16_t DISTANCE_BASES[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 }; // The shortest distance of each distance code.
+		static constexpr uint8_t DISTANCE_EXTRA[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 }; // The extra bits of each distance code.
+
+		// Description: The fixed codes of every symbol, bit-reversed, and the code of every match length
+		//    and distance, built once at compile time.
+		struct CodeTables
+		{
+			uint16_t literalCodes[288]; // The reversed code of each literal and length symbol.
+			uint8_t literalBits[288]; // The length of each literal and length code.
+			uint8_t distanceCodes[30]; // The reversed code of each distance code.
+			uint8_t lengthSymbols[MAX_MATCH + 1]; // The length symbol of each match length, minus 257.
+			uint8_t distanceSymbols[512]; // The distance code of distances 1 to 256 and, from 256 on, of (distance - 1) >> 7.
+
+			constexpr CodeTables() : literalCodes(), literalBits(), distanceCodes(), lengthSymbols(), distanceSymbols()
+			{
+				for (uint32_t symbol = 0; symbol < 288; ++symbol)
+				{
+					uint32_t code = symbol < 144 ? 0x30 + symbol : symbol < 256 ? 0x190 + symbol - 144 : symbol < 280 ? symbol - 256 : 0xC0 + symbol - 280;
+					uint32_t bits = symbol < 144 ? 8 : symbol < 256 ? 9 : symbol < 280 ? 7 : 8;
+
+					literalCodes[symbol] = static_cast<uint16_t>(Reverse(code, bits));
+					literalBits[symbol] = static_cast<uint8_t>(bits);
+				}
+
+				for (uint32_t code = 0; code < 30; ++code)
+					distanceCodes[code] = static_cast<uint8_t>(Reverse(code, 5));
+
+				for (uint32_t symbol = 0; symbol < 29; ++symbol)
+				{
+					const uint32_t last = symbol == 28 ? MAX_MATCH : LENGTH_BASES[symbol] + (1u << LENGTH_EXTRA[symbol]) - 1;
+					for (uint32_t length = LENGTH_BASES[symbol]; length <= last && length <= MAX_MATCH; ++length)
+						lengthSymbols[length] = static_cast<uint8_t>(symbol);
+				}
+
+				// Length 258 has its own symbol, rather than being the longest of 227's.
+				lengthSymbols[MAX_MATCH] = 28;
+
+				for (uint32_t code = 0; code < 30; ++code)
+				{
+					const uint32_t last = DISTANCE_BASES[code] + (1u << DISTANCE_EXTRA[code]) - 1;
+					for (uint32_t distance = DISTANCE_BASES[code]; distance <= last; ++distance)
+					{
+						if (distance <= 256)
+							distanceSymbols[distance - 1] = static_cast<uint8_t>(code);
+						else
+							distanceSymbols[256 + ((distance - 1) >> 7)] = static_cast<uint8_t>(code);
+					}
+				}
+			}
+
+			// Description: Reverses the lowest bits of a code.
+			static constexpr uint32_t Reverse(uint32_t _code, uint32_t _bits)
+			{
+				uint32_t reversed = 0;
+				for (uint32_t bit = 0; bit < _bits; ++bit)
+					reversed |= ((_code >> bit) & 1) << (_bits - 1 - bit);
+
+				return reversed;
+			}
+		};
+
+		static constexpr CodeTables s_Codes;
+
+		// Description: Appends values to a stream, least significant bit first.
+		class BitWriter
+		{
+		private:
+			std::vector<uint8_t>& m_Out; // The stream.
+			uint64_t m_Bits; // Bits not yet appended.
+			uint32_t m_Count; // The number of bits in m_Bits.
+
+		public:
+			// Description: Constructs a writer that appends to a stream.
+			explicit BitWriter(std::vector<uint8_t>& _out) : m_Out(_out), m_Bits(0), m_Count(0) {}
+
+			// Description: Appends the lowest bits of a value. At most 32 bits at a time.
+			inline void Write(uint32_t _value, uint32_t _bits)
+			{
+				m_Bits |= static_cast<uint64_t>(_value) << m_Count;
+				m_Count += _bits;
+
+				if (m_Count >= 32)
+				{
+					const uint8_t bytes[4] = { static_cast<uint8_t>(m_Bits), static_cast<uint8_t>(m_Bits >> 8), static_cast<uint8_t>(m_Bits >> 16), static_cast<uint8_t>(m_Bits >> 24) };
+					m_Out.insert(m_Out.end(), bytes, bytes + 4);
+					m_Bits >>= 32;
+					m_Count -= 32;
+				}
+			}
+
+			// Description: Appends the bits left over, padding the last byte with zeros.
+			void Flush()
+			{
+				for (; m_Count > 0; m_Count = m_Count > 8 ? m_Count - 8 : 0)
+				{
+					m_Out.push_back(static_cast<uint8_t>(m_Bits));
+					m_Bits >>= 8;
+				}
+			}
+		};
+
+		// Description: Reads 4 bytes without alignment requirements.
+		static inline uint32_t Read32(const uint8_t* _source)
+		{
+			uint32_t value;
+			memcpy(&value, _source, sizeof(value));
+			return value;
+		}
+
+		// Description: Hashes 4 bytes into a table index.
+		static inline uint32_t Hash(uint32_t _value)
+		{
+			return (_value * 2654435761U) >> (32 - HASH_BITS);
+		}
+
+		// Description: Appends a literal byte.
+		static inline void WriteLiteral(BitWriter& _writer, uint8_t _literal)
+		{
+			_writer.Write(s_Codes.literalCodes[_literal], s_Codes.literalBits[_literal]);
+		}
+
+		// Description: Appends a match: its length symbol and extra bits, then its distance code and extra bits.
+		static inline void WriteMatch(BitWriter& _writer, size_t _length, size_t _distance)
+		{
+			const uint32_t lengthSymbol = s_Codes.lengthSymbols[_length];
+			const uint32_t symbol = 257 + lengthSymbol;
+			_writer.Write(s_Codes.literalCodes[symbol], s_Codes.literalBits[symbol]);
+			_writer.Write(static_cast<uint32_t>(_length - LENGTH_BASES[lengthSymbol]), LENGTH_EXTRA[lengthSymbol]);
+
+			const uint32_t distanceCode = _distance <= 256 ? s_Codes.distanceSymbols[_distance - 1] : s_Codes.distanceSymbols[256 + ((_distance - 1) >> 7)];
+			_writer.Write(s_Codes.distanceCodes[distanceCode], 5);
+			_writer.Write(static_cast<uint32_t>(_distance - DISTANCE_BASES[distanceCode]), DISTANCE_EXTRA[distanceCode]);
+		}
+
+		// Description: Appends the input as one block with the fixed codes.
+		static void WriteFixedBlock(const uint8_t* _source, size_t _size, std::vector<uint8_t>& _out)
+		{
+			std::vector<int64_t> table(1u << HASH_BITS, -1);
+			BitWriter writer(_out);
+			writer.Write(1, 1); // The last block.
+			writer.Write(1, 2); // Fixed codes.
+
+			size_t position = 0;
+
+			while (_size >= MIN_MATCH && position <= _size - MIN_MATCH)
+			{
+				const uint32_t hash = Hash(Read32(_source + position));
+				const int64_t candidate = table[hash];
+				table[hash] = static_cast<int64_t>(position);
+
+				if (candidate < 0 || position - static_cast<size_t>(candidate) > MAX_DISTANCE || Read32(_source + candidate) != Read32(_source + position))
+				{
+					WriteLiteral(writer, _source[position++]);
+					continue;
+				}
+
+				// Extend the match as far as it goes.
+				const size_t limit = _size - position < MAX_MATCH ? _size - position : MAX_MATCH;
+				size_t length = MIN_MATCH;
+				while (length < limit && _source[candidate + length] == _source[position + length])
+					++length;
+
+				WriteMatch(writer, length, position - static_cast<size_t>(candidate));
+
+				// Remember where the match ended, so the next one can start near it.
+				if (position + length <= _size - MIN_MATCH)
+					table[Hash(Read32(_source + position + length - 1))] = static_cast<int64_t>(position + length - 1);
+
+				position += length;
+			}
+
+			for (; position < _size; ++position)
+				WriteLiteral(writer, _source[position]);
+
+			writer.Write(s_Codes.literalCodes[END_OF_BLOCK], s_Codes.literalBits[END_OF_BLOCK]);
+			writer.Flush();
+		}
+
+		// Description: Appends the input as stored blocks, uncompressed.
+		static void WriteStoredBlocks(const uint8_t* _source, size_t _size, std::vector<uint8_t>& _out)
+		{
+			size_t position = 0;
+
+			do
+			{
+				const size_t length = _size - position < MAX_STORED ? _size - position : MAX_STORED;
+				const bool last = position + length == _size;
+				const uint8_t header[5] = {
+					static_cast<uint8_t>(last ? 1 : 0),
+					static_cast<uint8_t>(length), static_cast<uint8_t>(length >> 8),
+					static_cast<uint8_t>(~length), static_cast<uint8_t>(~length >> 8)
+				};
+
+				_out.insert(_out.end(), header, header + 5);
+				_out.insert(_out.end(), _source + position, _source + position + length);
+				position += length;
+			} while (position < _size);
+		}
+
+		void Compress(const uint8_t* _source, size_t _size, std::vector<uint8_t>& _outCompressed)
+		{
+			_outCompressed.clear();
+			_outCompressed.reserve(_size / 4 + 64);
+
+			// A 32 KB window with the fastest level, which is what the fixed codes amount to.
+			_outCompressed.push_back(0x78);
+			_outCompressed.push_back(0x01);
+
+			WriteFixedBlock(_source, _size, _outCompressed);
+
+			if (_outCompressed.size() - 2 > _size + (_size / MAX_STORED + 1) * 5)
+			{
+				_outCompressed.resize(2);
+				WriteStoredBlocks(_source, _size, _outCompressed);
+			}
+
+			const uint32_t adler = Adler32(_source, _size);
+			const uint8_t trailer[4] = { static_cast<uint8_t>(adler >> 24), static_cast<uint8_t>(adler >> 16), static_cast<uint8_t>(adler >> 8), static_cast<uint8_t>(adler) };
+			_outCompressed.insert(_outCompressed.end(), trailer, trailer + 4);
+		}
+
+		uint32_t Adler32(const uint8_t* _data, size_t _size, uint32_t _adler)
+		{
+			constexpr uint32_t MODULUS = 65521;
+			constexpr size_t RUN = 5552; // The most bytes that can be summed before the sums could overflow.
+
+			uint32_t a = _adler & 0xFFFF, b = _adler >> 16;
+
+			while (_size > 0)
+			{
+				const size_t run = _size < RUN ? _size : RUN;
+				for (size_t i = 0; i < run; ++i)
+				{
+					a += _data[i];
+					b += a;
+				}
+
+				a %= MODULUS;
+				b %= MODULUS;
+				_data += run;
+				_size -= run;
+			}
+
+			return (b << 16) | a;
+		}
+	}
+}
@@ -0,0 +1,39 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Deflate.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: A fast compressor for the zlib format (RFC 1950 and 1951), for files other programs
+		read, like PNG. Like Lz, it favours speed: matches are found with one probe of a hash table and
+		coded with deflate's fixed Huffman codes, so there are no code tables to build or store. Data
+		that doesn't compress is stored instead, so the output is never much larger than the input.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace OC
+{
+	namespace Deflate
+	{
+		// Description: Compresses bytes into a zlib stream any inflater can read.
+		// Parameters: 
+		//    const uint8_t* _source, the bytes to compress.
+		//    size_t _size, the number of bytes.
+		//    std::vector<uint8_t>& _outCompressed, cleared, then filled with the zlib stream.
+		void Compress(const uint8_t* _source, size_t _size, std::vector<uint8_t>& _outCompressed);
+
+		// Description: Computes the Adler-32 checksum zlib streams end with.
+		// Parameters: 
+		//    const uint8_t* _data, the bytes.
+		//    size_t _size, the number of bytes.
+		//    uint32_t _adler, the checksum of the bytes before these, to continue it. 1 to start.
+		// Returns: The checksum.
+		uint32_t Adler32(const uint8_t* _data, size_t _size, uint32_t _adler = 1);
+	}
+}
@@ -0,0 +1,35 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Hash64.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <string.h>
+#include "Hash64.h"
+
+namespace OC
+{
+	uint64_t Hash64(const void* _data, size_t _size, uint64_t _hash)
+	{
+		constexpr uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ull;
+		const uint8_t* bytes = static_cast<const uint8_t*>(_data);
+		uint64_t word;
+
+		for (; _size >= sizeof(word); _size -= sizeof(word), bytes += sizeof(word))
+		{
+			memcpy(&word, bytes, sizeof(word));
+			_hash = (_hash ^ word) * MULTIPLIER;
+			_hash ^= _hash >> 32;
+		}
+
+		// The length goes in with the tail, so trailing zeros still change the hash.
+		word = static_cast<uint64_t>(_size) << 56;
+		memcpy(&word, bytes, _size);
+		_hash = (_hash ^ word) * MULTIPLIER;
+		return _hash ^ (_hash >> 29);
+	}
+}
@@ -0,0 +1,27 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Hash64.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: A fast 64-bit hash, used to tell when cooked or cached data no longer matches what it
+		was made from. Not cryptographic, and bytes are read in native order, so hashes are only
+		compared on the machine that made them.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace OC
+{
+	// Description: Computes or continues a 64-bit hash, 8 bytes at a time.
+	// Parameters: 
+	//    const void* _data, the bytes to hash.
+	//    size_t _size, the number of bytes.
+	//    uint64_t _hash, the hash of the bytes before these, or 0 to start a new one.
+	// Returns: The hash of all bytes so far.
+	uint64_t Hash64(const void* _data, size_t _size, uint64_t _hash = 0);
+}
@@ -0,0 +1,190 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Lz.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+
+	The stream is a series of sequences. Each starts with a token byte whose high nibble is the literal
+	length and low nibble is the match length minus MIN_MATCH. A nibble of 15 is followed by extra bytes
+	that are added to it until one isn't 255. Then come the literals, then a 2-byte little-endian offset
+	back into the output. The last sequence only has literals.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <string.h>
+#include "Lz.h"
+
+namespace OC
+{
+	namespace Lz
+	{
+		constexpr size_t MIN_MATCH = 4; // The shortest match worth encoding.
+		constexpr size_t MAX_OFFSET = 0xFFFF; // The furthest back a match can be.
+		constexpr size_t END_LITERALS = 8; // The tail that's always stored as literals.
+		constexpr unsigned int HASH_BITS = 14; // Size of the match finder's table.
+
+		// Description: Reads 4 bytes without alignment requirements.
+		static inline uint32_t Read32(const uint8_t* _source)
+		{
+			uint32_t value;
+			memcpy(&value, _source, sizeof(value));
+			return value;
+		}
+
+		// Description: Hashes 4 bytes into a table index.
+		static inline uint32_t Hash(uint32_t _value)
+		{
+			return (_value * 2654435761U) >> (32 - HASH_BITS);
+		}
+
+		// Description: Appends a length that didn't fit in its nibble.
+		static inline void WriteLength(size_t _length, std::vector<uint8_t>& _out)
+		{
+			for (; _length >= 255; _length -= 255)
+				_out.push_back(255);
+
+			_out.push_back(static_cast<uint8_t>(_length));
+		}
+
+		// Description: Appends a sequence of literals followed by a match, if _matchLength isn't 0.
+		static void WriteSequence(const uint8_t* _literals, size_t _literalLength, size_t _offset, size_t _matchLength, std::vector<uint8_t>& _out)
+		{
+			const size_t matchCode = _matchLength ? _matchLength - MIN_MATCH : 0;
+
+			_out.push_back(static_cast<uint8_t>(
+				((_literalLength < 15 ? _literalLength : 15) << 4) | (matchCode < 15 ? matchCode : 15)
+			));
+
+			if (_literalLength >= 15)
+				WriteLength(_literalLength - 15, _out);
+
+			_out.insert(_out.end(), _literals, _literals + _literalLength);
+
+			if (_matchLength)
+			{
+				_out.push_back(static_cast<uint8_t>(_offset & 0xFF));
+				_out.push_back(static_cast<uint8_t>(_offset >> 8));
+
+				if (matchCode >= 15)
+					WriteLength(matchCode - 15, _out);
+			}
+		}
+
+		// Description: Reads a length that didn't fit in its nibble.
+		static inline bool ReadLength(const uint8_t*& _source, const uint8_t* _end, size_t& _length)
+		{
+			uint8_t byte;
+
+			do
+			{
+				if (_source >= _end)
+					return false;
+
+				byte = *_source++;
+				_length += byte;
+			} while (byte == 255);
+
+			return true;
+		}
+
+		void Compress(const uint8_t* _source, size_t _size, std::vector<uint8_t>& _outCompressed)
+		{
+			_outCompressed.clear();
+			_outCompressed.reserve(_size / 2 + 16);
+
+			// Positions (plus one, so zero means empty) of recently seen 4-byte sequences.
+			std::vector<uint32_t> table(size_t(1) << HASH_BITS, 0);
+
+			size_t anchor = 0; // Start of the literals not yet written.
+			size_t position = 0;
+			const size_t limit = _size > END_LITERALS + MIN_MATCH ? _size - END_LITERALS - MIN_MATCH : 0;
+
+			while (position < limit)
+			{
+				const uint32_t sequence = Read32(_source + position);
+				const uint32_t hash = Hash(sequence);
+				const size_t candidate = table[hash];
+				table[hash] = static_cast<uint32_t>(position + 1);
+
+				if (candidate == 0 || position - (candidate - 1) > MAX_OFFSET || Read32(_source + candidate - 1) != sequence)
+				{
+					++position;
+					continue;
+				}
+
+				// Extend the match as far as it goes, stopping short of the literal tail.
+				const size_t match = candidate - 1;
+				size_t length = MIN_MATCH;
+
+				while (position + length < _size - END_LITERALS && _source[match + length] == _source[position + length])
+					++length;
+
+				WriteSequence(_source + anchor, position - anchor, position - match, length, _outCompressed);
+
+				position += length;
+				anchor = position;
+			}
+
+			WriteSequence(_source + anchor, _size - anchor, 0, 0, _outCompressed);
+		}
+
+		bool Decompress(const uint8_t* _source, size_t _size, uint8_t* _destination, size_t _destinationSize)
+		{
+			const uint8_t* in = _source;
+			const uint8_t* inEnd = _source + _size;
+			uint8_t* out = _destination;
+			uint8_t* outEnd = _destination + _destinationSize;
+
+			while (in < inEnd)
+			{
+				const uint8_t token = *in++;
+
+				// Literals.
+				size_t literalLength = token >> 4;
+
+				if (literalLength == 15 && !ReadLength(in, inEnd, literalLength))
+					return false;
+
+				if (literalLength > static_cast<size_t>(inEnd - in) || literalLength > static_cast<size_t>(outEnd - out))
+					return false;
+
+				memcpy(out, in, literalLength);
+				in += literalLength;
+				out += literalLength;
+
+				// The last sequence has no match.
+				if (in == inEnd)
+					break;
+
+				// Match.
+				if (inEnd - in < 2)
+					return false;
+
+				const size_t offset = in[0] | (static_cast<size_t>(in[1]) << 8);
+				in += 2;
+
+				size_t matchLength = token & 0x0F;
+
+				if (matchLength == 15 && !ReadLength(in, inEnd, matchLength))
+					return false;
+
+				matchLength += MIN_MATCH;
+
+				if (offset == 0 || offset > static_cast<size_t>(out - _destination) || matchLength > static_cast<size_t>(outEnd - out))
+					return false;
+
+				// Byte by byte, since a match may overlap the bytes it produces.
+				const uint8_t* match = out - offset;
+
+				for (size_t i = 0; i < matchLength; ++i)
+					out[i] = match[i];
+
+				out += matchLength;
+			}
+
+			return out == outEnd;
+		}
+	}
+}
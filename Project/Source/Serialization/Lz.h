@@ -0,0 +1,39 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Lz.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: A fast LZ77 compressor in the style of LZ4. It trades compression ratio for speed,
+		which suits save games: SoA arrays are full of repeated values and compress well enough, and
+		decompression is little more than memcpy.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace OC
+{
+	namespace Lz
+	{
+		// Description: Compresses bytes.
+		// Parameters: 
+		//    const uint8_t* _source, the bytes to compress.
+		//    size_t _size, the number of bytes.
+		//    std::vector<uint8_t>& _outCompressed, cleared, then filled with the compressed bytes.
+		void Compress(const uint8_t* _source, size_t _size, std::vector<uint8_t>& _outCompressed);
+
+		// Description: Decompresses bytes produced by Compress. Safe to use on corrupted input.
+		// Parameters: 
+		//    const uint8_t* _source, the compressed bytes.
+		//    size_t _size, the number of compressed bytes.
+		//    uint8_t* _destination, receives the decompressed bytes.
+		//    size_t _destinationSize, the exact size of the decompressed bytes.
+		// Returns: true, if the input was valid and decompressed to exactly _destinationSize bytes.
+		bool Decompress(const uint8_t* _source, size_t _size, uint8_t* _destination, size_t _destinationSize);
+	}
+}
@@ -0,0 +1,220 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: SaveGame.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <fstream>
+#include <stdio.h>
+#include <string>
+#include "AtomicFile.h"
+#include "Crc32.h"
+#include "Lz.h"
+#include "SaveGame.h"
+
+namespace OC
+{
+	constexpr uint32_t SAVE_MAGIC = MakeChunkId('O', 'C', 'S', 'V');
+	constexpr uint32_t SAVE_FORMAT_VERSION = 1;
+	constexpr uint16_t CHUNK_COMPRESSED = 1; // Chunk flag: the stored bytes are Lz compressed.
+	constexpr uint32_t MAX_CHUNK_SIZE = 1U << 30; // Anything bigger is treated as corruption.
+
+	struct ChunkHeader
+	{
+		uint32_t id;
+		uint16_t version;
+		uint16_t flags;
+		uint32_t size;
+		uint32_t storedSize;
+		uint32_t crc;
+	};
+
+	// SaveWriter public
+
+	SaveWriter::SaveWriter() :
+		m_Chunks(),
+		m_InChunk(false)
+	{}
+
+	void SaveWriter::BeginChunk(uint32_t _id, uint16_t _version)
+	{
+		assert(!m_InChunk); // Error: The previous chunk hasn't ended.
+
+		m_Chunks.push_back(Chunk{ _id, _version, std::vector<uint8_t>() });
+		m_InChunk = true;
+	}
+
+	void SaveWriter::EndChunk()
+	{
+		assert(m_InChunk); // Error: No chunk has begun.
+
+		m_InChunk = false;
+	}
+
+	void SaveWriter::WriteBytes(const void* _data, size_t _size)
+	{
+		assert(m_InChunk); // Error: Writes must be inside a chunk.
+
+		const uint8_t* bytes = static_cast<const uint8_t*>(_data);
+		std::vector<uint8_t>& data = m_Chunks.back().data;
+		data.insert(data.end(), bytes, bytes + _size);
+	}
+
+	bool SaveWriter::WriteFile(const char* _path) const
+	{
+		assert(_path); // Error: _path is nullptr.
+		assert(!m_InChunk); // Error: The last chunk hasn't ended.
+
+		const std::string temporaryPath = AtomicFile::GetTemporaryPath(_path);
+		bool written;
+
+		{
+			std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+
+			if (!file)
+				return false;
+
+			const uint32_t header[3] = { SAVE_MAGIC, SAVE_FORMAT_VERSION, static_cast<uint32_t>(m_Chunks.size()) };
+			file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+			// One chunk at a time, so only one compressed chunk is ever held in memory.
+			std::vector<uint8_t> compressed;
+
+			for (const Chunk& chunk : m_Chunks)
+			{
+				assert(chunk.data.size() <= MAX_CHUNK_SIZE); // Error: Chunk too big. Split it up.
+
+				Lz::Compress(chunk.data.data(), chunk.data.size(), compressed);
+
+				// Keep the chunk uncompressed if compressing didn't help.
+				const bool useCompressed = compressed.size() < chunk.data.size();
+				const std::vector<uint8_t>& stored = useCompressed ? compressed : chunk.data;
+
+				ChunkHeader chunkHeader;
+				chunkHeader.id = chunk.id;
+				chunkHeader.version = chunk.version;
+				chunkHeader.flags = useCompressed ? CHUNK_COMPRESSED : 0;
+				chunkHeader.size = static_cast<uint32_t>(chunk.data.size());
+				chunkHeader.storedSize = static_cast<uint32_t>(stored.size());
+				chunkHeader.crc = Crc32(stored.data(), stored.size());
+
+				file.write(reinterpret_cast<const char*>(&chunkHeader), sizeof(chunkHeader));
+				file.write(reinterpret_cast<const char*>(stored.data()), stored.size());
+			}
+
+			written = static_cast<bool>(file.flush());
+		}
+
+		if (!written)
+		{
+			remove(temporaryPath.c_str());
+			return false;
+		}
+
+		// Replace the old save only once the new one is complete.
+		return AtomicFile::Commit(_path);
+	}
+
+	size_t SaveWriter::GetSize() const
+	{
+		size_t size = 0;
+
+		for (const Chunk& chunk : m_Chunks)
+			size += chunk.data.size();
+
+		return size;
+	}
+
+	// SaveReader public
+
+	SaveReader::SaveReader() :
+		m_Chunks(),
+		m_Current(nullptr),
+		m_Offset(0)
+	{}
+
+	bool SaveReader::ReadFile(const char* _path)
+	{
+		assert(_path); // Error: _path is nullptr.
+
+		m_Chunks.clear();
+		m_Current = nullptr;
+		m_Offset = 0;
+
+		std::ifstream file(_path, std::ios::binary);
+		uint32_t header[3];
+
+		if (!file.read(reinterpret_cast<char*>(header), sizeof(header)) ||
+			header[0] != SAVE_MAGIC || header[1] != SAVE_FORMAT_VERSION)
+			return false;
+
+		std::vector<uint8_t> stored;
+
+		for (uint32_t i = 0; i < header[2]; ++i)
+		{
+			ChunkHeader chunkHeader;
+
+			if (!file.read(reinterpret_cast<char*>(&chunkHeader), sizeof(chunkHeader)) ||
+				chunkHeader.size > MAX_CHUNK_SIZE || chunkHeader.storedSize > MAX_CHUNK_SIZE)
+				return false;
+
+			stored.resize(chunkHeader.storedSize);
+
+			if (!file.read(reinterpret_cast<char*>(stored.data()), stored.size()) ||
+				Crc32(stored.data(), stored.size()) != chunkHeader.crc)
+				return false;
+
+			m_Chunks.push_back(Chunk{ chunkHeader.id, chunkHeader.version, std::vector<uint8_t>() });
+			std::vector<uint8_t>& data = m_Chunks.back().data;
+
+			if (chunkHeader.flags & CHUNK_COMPRESSED)
+			{
+				data.resize(chunkHeader.size);
+
+				if (!Lz::Decompress(stored.data(), stored.size(), data.data(), data.size()))
+					return false;
+			}
+			else
+			{
+				if (chunkHeader.size != chunkHeader.storedSize)
+					return false;
+
+				data.swap(stored);
+			}
+		}
+
+		return true;
+	}
+
+	bool SaveReader::OpenChunk(uint32_t _id, uint16_t& _outVersion)
+	{
+		for (const Chunk& chunk : m_Chunks)
+		{
+			if (chunk.id == _id)
+			{
+				m_Current = &chunk;
+				m_Offset = 0;
+				_outVersion = chunk.version;
+				return true;
+			}
+		}
+
+		m_Current = nullptr;
+		return false;
+	}
+
+	bool SaveReader::ReadBytes(void* _data, size_t _size)
+	{
+		if (!m_Current || m_Current->data.size() - m_Offset < _size)
+			return false;
+
+		memcpy(_data, m_Current->data.data() + m_Offset, _size);
+		m_Offset += _size;
+		return true;
+	}
+}
@@ -0,0 +1,181 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: SaveGame.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: The save-game format. A save is a series of chunks, each tagged with an id and its own
+		version so systems can change their data independently and readers can skip chunks they don't
+		know. SaveWriter builds the chunks in memory. That is the snapshot: mostly bulk copies of SoA
+		arrays, cheap enough to take mid-frame. WriteFile then compresses each chunk, checksums it and
+		streams it to disk, which is the slow part and is safe to do on another thread.
+
+		File layout (native little-endian):
+			uint32 magic 'OCSV', uint32 format version, uint32 chunk count
+			per chunk: uint32 id, uint16 version, uint16 flags, uint32 size, uint32 stored size,
+			           uint32 CRC-32 of the stored bytes, then the stored bytes
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+#include <vector>
+
+namespace OC
+{
+	// Description: Builds a chunk id from four characters, e.g. MakeChunkId('U', 'N', 'I', 'T').
+	constexpr uint32_t MakeChunkId(char _a, char _b, char _c, char _d)
+	{
+		return static_cast<uint32_t>(static_cast<uint8_t>(_a)) |
+			   static_cast<uint32_t>(static_cast<uint8_t>(_b)) << 8 |
+			   static_cast<uint32_t>(static_cast<uint8_t>(_c)) << 16 |
+			   static_cast<uint32_t>(static_cast<uint8_t>(_d)) << 24;
+	}
+
+	class SaveWriter
+	{
+	private:
+		struct Chunk
+		{
+			uint32_t id; // What the chunk holds.
+			uint16_t version; // The version of the chunk's layout.
+			std::vector<uint8_t> data; // The uncompressed contents.
+		};
+
+		std::vector<Chunk> m_Chunks; // Every chunk written so far.
+		bool m_InChunk; // If a chunk has begun and not ended.
+
+	public:
+		// Description: Constructs an empty save.
+		SaveWriter();
+
+		// Description: Starts a new chunk. Everything written until EndChunk goes into it.
+		// Parameters: 
+		//    uint32_t _id, what the chunk holds. See MakeChunkId.
+		//    uint16_t _version, the version of the chunk's layout.
+		void BeginChunk(uint32_t _id, uint16_t _version);
+
+		// Description: Finishes the current chunk.
+		void EndChunk();
+
+		// Description: Appends raw bytes to the current chunk.
+		// Parameters: 
+		//    const void* _data, the bytes.
+		//    size_t _size, the number of bytes.
+		void WriteBytes(const void* _data, size_t _size);
+
+		// Description: Appends a plain value to the current chunk.
+		// Parameters: 
+		//    const T& _value, the value. Must be trivially copyable.
+		template<typename T>
+		void Write(const T& _value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Open Conquer Error: Only plain values can be saved");
+			WriteBytes(&_value, sizeof(T));
+		}
+
+		// Description: Appends an array of plain values to the current chunk, as a count and one bulk copy.
+		// Parameters: 
+		//    const std::vector<T>& _values, the values. Must be trivially copyable.
+		template<typename T>
+		void WriteArray(const std::vector<T>& _values)
+		{
+			WriteArray(_values.data(), static_cast<uint32_t>(_values.size()));
+		}
+
+		// Description: Appends an array of plain values to the current chunk, as a count and one bulk copy.
+		// Parameters: 
+		//    const T* _values, the values. Must be trivially copyable.
+		//    uint32_t _count, the number of values.
+		template<typename T>
+		void WriteArray(const T* _values, uint32_t _count)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Open Conquer Error: Only plain values can be saved");
+			Write(_count);
+			WriteBytes(_values, static_cast<size_t>(_count) * sizeof(T));
+		}
+
+		// Description: Compresses, checksums and writes every chunk to a file. The file is written
+		//    under a temporary name and moved over the old save in one step when complete, so a crash
+		//    leaves either the old save or the new one.
+		// Parameters: 
+		//    const char* _path, the file to write.
+		// Returns: true, if the file was written.
+		bool WriteFile(const char* _path) const;
+
+		// Description: Returns the uncompressed size of every chunk.
+		// Returns: The size in bytes.
+		size_t GetSize() const;
+	};
+
+	class SaveReader
+	{
+	private:
+		struct Chunk
+		{
+			uint32_t id; // What the chunk holds.
+			uint16_t version; // The version of the chunk's layout.
+			std::vector<uint8_t> data; // The uncompressed contents.
+		};
+
+		std::vector<Chunk> m_Chunks; // Every chunk in the save.
+		const Chunk* m_Current; // The chunk being read.
+		size_t m_Offset; // The read position in the current chunk.
+
+	public:
+		// Description: Constructs an empty reader.
+		SaveReader();
+
+		// Description: Reads a save, checking and decompressing every chunk.
+		// Parameters: 
+		//    const char* _path, the file to read.
+		// Returns: true, if the file exists and every chunk is intact.
+		bool ReadFile(const char* _path);
+
+		// Description: Starts reading a chunk.
+		// Parameters: 
+		//    uint32_t _id, the chunk to read.
+		//    uint16_t& _outVersion, the version of the chunk's layout.
+		// Returns: true, if the save has the chunk.
+		bool OpenChunk(uint32_t _id, uint16_t& _outVersion);
+
+		// Description: Reads raw bytes from the current chunk.
+		// Parameters: 
+		//    void* _data, receives the bytes.
+		//    size_t _size, the number of bytes.
+		// Returns: true, if the chunk had that many bytes left.
+		bool ReadBytes(void* _data, size_t _size);
+
+		// Description: Reads a plain value from the current chunk.
+		// Parameters: 
+		//    T& _outValue, receives the value.
+		// Returns: true, if the chunk had a value left.
+		template<typename T>
+		bool Read(T& _outValue)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Open Conquer Error: Only plain values can be loaded");
+			return ReadBytes(&_outValue, sizeof(T));
+		}
+
+		// Description: Reads an array written by SaveWriter::WriteArray from the current chunk.
+		// Parameters: 
+		//    std::vector<T>& _outValues, resized and filled with the values.
+		// Returns: true, if the chunk held the whole array.
+		template<typename T>
+		bool ReadArray(std::vector<T>& _outValues)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Open Conquer Error: Only plain values can be loaded");
+
+			uint32_t count;
+
+			if (!Read(count) || m_Current->data.size() - m_Offset < static_cast<size_t>(count) * sizeof(T))
+				return false;
+
+			_outValues.resize(count);
+			return ReadBytes(_outValues.data(), static_cast<size_t>(count) * sizeof(T));
+		}
+	};
+}
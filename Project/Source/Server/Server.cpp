@@ -0,0 +1,208 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Server.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <atomic>
+#include <chrono>
+#include "Server.h"
+
+namespace OC
+{
+	// private
+
+	void Server::UpdateGauges()
+	{
+		int64_t running = 0, alive = 0, projectiles = 0;
+
+		for (const auto& match : m_Matches)
+		{
+			running += IsFinished(*match) ? 0 : 1;
+			projectiles += match->GetProjectiles().Count();
+			alive += match->GetAliveCount();
+		}
+
+		m_RunningMatches->Set(running);
+		m_AliveUnits->Set(alive);
+		m_Projectiles->Set(projectiles);
+		m_AutosaveFailures->Set(m_Saver.GetFailureCount());
+	}
+
+	void Server::ApplyAISettings()
+	{
+		AISettings settings = m_AISettings;
+
+		if (m_Governor)
+		{
+			const uint32_t scale = m_Governor->GetQuality().thinkIntervalScale;
+			settings.thinkInterval *= scale;
+			settings.maxThinksPerTick = settings.maxThinksPerTick / scale > 0 ? settings.maxThinksPerTick / scale : 1;
+		}
+
+		for (auto& match : m_Matches)
+			match->GetAI().SetSettings(settings);
+	}
+
+	// public
+
+	Server::Server(unsigned int _matchCount, uint64_t _seed, uint64_t _tickLimit, unsigned int _workerCount, const DefinitionDatabase* _definitions) :
+		m_Jobs(_workerCount),
+		m_Matches(),
+		m_TickLimit(_tickLimit),
+		m_AutosaveInterval(0),
+		m_AutosavePath(),
+		m_Saver(),
+		m_TicksRun(nullptr),
+		m_TickTimes(nullptr),
+		m_RunningMatches(nullptr),
+		m_AliveUnits(nullptr),
+		m_Projectiles(nullptr),
+		m_AutosaveFailures(nullptr),
+		m_AISettings(),
+		m_Governor()
+	{
+		m_Matches.reserve(_matchCount);
+
+		for (unsigned int i = 0; i < _matchCount; ++i)
+			m_Matches.emplace_back(new World(_seed + i, &m_Jobs, _definitions));
+	}
+
+	void Server::Queue(const std::vector<Command>& _commands)
+	{
+		for (auto& match : m_Matches)
+			match->Queue(_commands);
+	}
+
+	bool Server::Load(const std::string& _path)
+	{
+		for (size_t i = 0; i < m_Matches.size(); ++i)
+		{
+			SaveReader save;
+
+			if (!save.ReadFile((_path + "." + std::to_string(i) + ".ocsave").c_str()) || !m_Matches[i]->Load(save))
+				return false;
+		}
+
+		return true;
+	}
+
+	void Server::SetAutosave(uint64_t _interval, const std::string& _path)
+	{
+		m_AutosaveInterval = _interval;
+		m_AutosavePath = _path;
+	}
+
+	unsigned int Server::FlushAutosaves()
+	{
+		m_Saver.Wait();
+		return m_Saver.GetFailureCount();
+	}
+
+	void Server::SetAISettings(const AISettings& _settings)
+	{
+		m_AISettings = _settings;
+		ApplyAISettings();
+	}
+
+	void Server::SetGovernor(const GovernorSettings& _settings)
+	{
+		m_Governor.reset(new FrameGovernor(_settings));
+		ApplyAISettings();
+	}
+
+	void Server::RegisterMetrics(MetricsRegistry& _registry)
+	{
+		m_TicksRun = &_registry.GetCounter("server_ticks_total", "Match ticks run.");
+		m_TickTimes = &_registry.GetHistogram("server_tick_microseconds", "Time taken by one match tick.");
+		m_RunningMatches = &_registry.GetGauge("server_matches_running", "Matches that haven't finished.");
+		m_AliveUnits = &_registry.GetGauge("server_units_alive", "Living units across every match.");
+		m_Projectiles = &_registry.GetGauge("server_projectiles", "Projectiles in flight across every match.");
+		m_AutosaveFailures = &_registry.GetGauge("server_autosave_failures", "Autosaves that couldn't be written.");
+
+		if (m_Governor)
+			m_Governor->RegisterMetrics(_registry);
+
+		UpdateGauges();
+	}
+
+	bool Server::Update()
+	{
+		std::atomic<bool> running(false);
+		auto updateStart = std::chrono::steady_clock::now();
+
+		// One match per chunk. Each match is only ever touched by the thread ticking it.
+		m_Jobs.ParallelFor(GetMatchCount(), 1, [this, &running](uint32_t _begin, uint32_t _end)
+		{
+			for (uint32_t i = _begin; i < _end; ++i)
+			{
+				World& match = *m_Matches[i];
+
+				if (IsFinished(match))
+					continue;
+
+				if (m_TickTimes)
+				{
+					auto start = std::chrono::steady_clock::now();
+					match.Tick();
+					auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+					m_TickTimes->Record(static_cast<uint64_t>(elapsed.count()));
+					m_TicksRun->Add();
+				}
+				else
+					match.Tick();
+
+				running = true;
+
+				// Snapshotting is quick. Compressing and writing happen on the saver's thread.
+				if (m_AutosaveInterval && match.GetTick() % m_AutosaveInterval == 0)
+				{
+					SaveWriter snapshot;
+					match.Save(snapshot);
+					m_Saver.Save(std::move(snapshot), m_AutosavePath + "." + std::to_string(i) + ".ocsave");
+				}
+			}
+		});
+
+		if (m_TicksRun)
+			UpdateGauges();
+
+		// Every match ticks in parallel, so the cost of an update is what the budget covers.
+		if (m_Governor && running)
+		{
+			float milliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - updateStart).count();
+			if (m_Governor->Record(milliseconds))
+				ApplyAISettings();
+		}
+
+		return running;
+	}
+
+	void Server::Run()
+	{
+		while (Update());
+	}
+
+	bool Server::IsFinished(const World& _match) const
+	{
+		return _match.HasEnded() || _match.GetTick() >= m_TickLimit;
+	}
+
+	unsigned int Server::GetMatchCount() const
+	{
+		return static_cast<unsigned int>(m_Matches.size());
+	}
+
+	const World& Server::GetMatch(unsigned int _index) const
+	{
+		assert(_index < m_Matches.size()); // Error: Invalid match index.
+
+		return *m_Matches[_index];
+	}
+}
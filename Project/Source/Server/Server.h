@@ -0,0 +1,130 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Server.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Hosts any number of matches in one process without a window or renderer. Every match
+		is driven by the same commands but seeded differently, which is what AI-vs-AI balance runs need.
+		Matches share no mutable state, so they are ticked in parallel on the server's job system.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "../Metrics/Metrics.h"
+#include "../Performance/FrameGovernor.h"
+#include "../Serialization/BackgroundSaver.h"
+#include "../Simulation/World.h"
+#include "../Threading/JobSystem.h"
+
+namespace OC
+{
+	class Server
+	{
+	private:
+		JobSystem m_Jobs; // Runs the matches, and the work inside them, in parallel.
+		std::vector<std::unique_ptr<World>> m_Matches; // Every match hosted by the server.
+		uint64_t m_TickLimit; // Matches end after this many ticks, even without an END command.
+		uint64_t m_AutosaveInterval; // Ticks between autosaves. 0 disables them.
+		std::string m_AutosavePath; // Autosaves go to <path>.<match>.ocsave.
+		BackgroundSaver m_Saver; // Writes autosaves without holding up the matches.
+		Counter* m_TicksRun; // Counts match ticks. nullptr until metrics are registered.
+		Histogram* m_TickTimes; // How long each match tick took, in microseconds.
+		Gauge* m_RunningMatches; // Matches that haven't finished.
+		Gauge* m_AliveUnits; // Living units across every match.
+		Gauge* m_Projectiles; // Projectiles in flight across every match.
+		Gauge* m_AutosaveFailures; // Autosaves that couldn't be written.
+		AISettings m_AISettings; // The AI settings of every match, before the governor scales them.
+		std::unique_ptr<FrameGovernor> m_Governor; // Thins out AI re-thinks when updates run over budget. nullptr when off.
+
+		// Description: Updates the gauges from the state of the matches.
+		void UpdateGauges();
+
+		// Description: Gives every match the AI settings, scaled by the governor's quality level.
+		void ApplyAISettings();
+
+	public:
+		// Description: Constructs the server and creates its matches.
+		// Parameters: 
+		//    unsigned int _matchCount, the number of matches to host.
+		//    uint64_t _seed, the seed of the first match. Match i is seeded with _seed + i.
+		//    uint64_t _tickLimit, the maximum number of ticks a match may run for.
+		//    unsigned int _workerCount, the number of worker threads. 0 uses every hardware thread.
+		//    const DefinitionDatabase* _definitions, the units and weapons of every match. Must outlive the
+		//        server. nullptr uses the built-in definitions.
+		Server(unsigned int _matchCount, uint64_t _seed, uint64_t _tickLimit, unsigned int _workerCount = 0, const DefinitionDatabase* _definitions = nullptr);
+
+		// Description: Server's cannot be created from other Server's.
+		Server(const Server& _server) = delete;
+
+		// Description: Server's cannot be assigned to other Server's.
+		void operator=(const Server& _server) = delete;
+
+		// Description: Queues commands in every match.
+		// Parameters: 
+		//    const std::vector<Command>& _commands, the commands to queue.
+		void Queue(const std::vector<Command>& _commands);
+
+		// Description: Replaces every match with its world from a save, named like autosaves, so a server
+		//    resumes from its own autosaves.
+		// Parameters: 
+		//    const std::string& _path, match i is loaded from <_path>.<i>.ocsave.
+		// Returns: true, if every match's save was loaded.
+		bool Load(const std::string& _path);
+
+		// Description: Periodically saves every match in the background.
+		// Parameters: 
+		//    uint64_t _interval, ticks between saves. 0 disables autosaving.
+		//    const std::string& _path, saves go to <_path>.<match>.ocsave.
+		void SetAutosave(uint64_t _interval, const std::string& _path);
+
+		// Description: Blocks until every autosave has been written.
+		// Returns: The number of autosaves that couldn't be written so far.
+		unsigned int FlushAutosaves();
+
+		// Description: Tunes the AI of every match.
+		// Parameters: 
+		//    const AISettings& _settings, the AI settings.
+		void SetAISettings(const AISettings& _settings);
+
+		// Description: Keeps every Update within a budget by making AI re-thinks less frequent when it
+		//    runs over, and more frequent again once there is room. Like the AI budget, this makes the
+		//    matches depend on the speed of the machine. Call before RegisterMetrics to export the
+		//    governor's metrics.
+		// Parameters: 
+		//    const GovernorSettings& _settings, the budget of one Update, and the quality levels.
+		void SetGovernor(const GovernorSettings& _settings);
+
+		// Description: Registers the server's metrics and starts updating them.
+		// Parameters: 
+		//    MetricsRegistry& _registry, the registry to add the metrics to. Must outlive the server.
+		void RegisterMetrics(MetricsRegistry& _registry);
+
+		// Description: Ticks every match that is still running once, in parallel.
+		// Returns: false, if every match has finished.
+		bool Update();
+
+		// Description: Runs every match until it finishes.
+		void Run();
+
+		// Description: Returns if a match has finished.
+		// Parameters: 
+		//    const World& _match, the match to check.
+		// Returns: true, if the match ended or reached the tick limit.
+		bool IsFinished(const World& _match) const;
+
+		// Description: Returns the number of matches.
+		// Returns: The number of matches.
+		unsigned int GetMatchCount() const;
+
+		// Description: Returns a match.
+		// Parameters: 
+		//    unsigned int _index, the index of the match.
+		// Returns: The match.
+		const World& GetMatch(unsigned int _index) const;
+	};
+}
@@ -0,0 +1,42 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Command.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Commands are the only way to change a world from the outside. Each one is stamped with
+		the tick it applies on, so the same list of commands always produces the same match.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include "../Data/Definitions.h"
+#include "Units.h"
+
+namespace OC
+{
+	enum class CommandType : uint8_t
+	{
+		SPAWN,	// Spawn count units of a type and team scattered within radius of (x, y).
+		MOVE,	// Move every unit of a team to (x, y).
+		END,	// End the match.
+		MOVE_UNIT,	// Move one unit of a team to (x, y). Group orders send one per unit.
+		_COUNT
+	};
+
+	struct Command
+	{
+		uint64_t tick; // The tick the command applies on.
+		CommandType type; // What the command does.
+		uint8_t team; // The team the command applies to.
+		UnitType unitType; // SPAWN: the definition of the units.
+		uint32_t count; // SPAWN: the number of units.
+		float x, y; // SPAWN, MOVE, MOVE_UNIT: the target position.
+		float radius; // SPAWN: how far units are scattered from (x, y).
+		UnitId unit; // MOVE_UNIT: the unit. Ignored if it doesn't exist or isn't on the team.
+	};
+
+	static_assert(sizeof(Command) == 32, "Open Conquer Error: Commands are saved as they are. Changing the size changes the save format.");
+}
@@ -0,0 +1,185 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: CommandScript.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string.h>
+#include <type_traits>
+#include "CommandScript.h"
+#include "World.h"
+
+namespace OC
+{
+	namespace CommandScript
+	{
+		constexpr uint64_t MAX_TICK = 365ull * 24 * 60 * 60 * TICKS_PER_SECOND; // The latest tick a command can apply on, a year into the match.
+		constexpr uint32_t MAX_SPAWN_COUNT = 1000000; // The most units a single spawn can add.
+
+		// Description: Reads the next field of a line as a number. The number must be the whole field.
+		// Parameters: 
+		//    std::istream& _fields, the rest of the line.
+		//    T& _outValue, receives the number.
+		// Returns: true, if the field was a number.
+		template<typename T>
+		static bool ReadNumber(std::istream& _fields, T& _outValue)
+		{
+			std::string field;
+			if (!(_fields >> field))
+				return false;
+
+			// Streams read "-1" into unsigned numbers as their largest value.
+			if (std::is_unsigned<T>::value && field[0] == '-')
+				return false;
+
+			std::istringstream number(field);
+			return number >> _outValue && (number >> std::ws).eof();
+		}
+
+		bool Parse(std::istream& _stream, std::vector<Command>& _outCommands, unsigned int& _outErrorLine, const DefinitionDatabase* _definitions)
+		{
+			const DefinitionDatabase& definitions = _definitions ? *_definitions : DefinitionDatabase::GetBuiltIn();
+			std::string line;
+			unsigned int lineNumber = 0;
+
+			while (std::getline(_stream, line))
+			{
+				++lineNumber;
+
+				// Skip blank lines and comments.
+				size_t first = line.find_first_not_of(" \t\r");
+				if (first == std::string::npos || line[first] == '#')
+					continue;
+
+				std::istringstream fields(line);
+				std::string name;
+				Command command = {};
+
+				// If anything but whitespace is left on the line.
+				auto hasMore = [&fields]() { return !(fields >> std::ws).eof(); };
+
+				if (!ReadNumber(fields, command.tick) || command.tick > MAX_TICK || !(fields >> name))
+				{
+					_outErrorLine = lineNumber;
+					return false;
+				}
+
+				unsigned int team = 0;
+				bool valid = true;
+
+				if (name == "spawn")
+				{
+					command.type = CommandType::SPAWN;
+					command.count = 1;
+					valid = ReadNumber(fields, team) && ReadNumber(fields, command.x) && ReadNumber(fields, command.y);
+
+					// Count, radius and unit are optional, but must be valid when given.
+					if (valid && hasMore())
+						valid = ReadNumber(fields, command.count) && command.count <= MAX_SPAWN_COUNT;
+
+					if (valid && hasMore())
+						valid = ReadNumber(fields, command.radius);
+
+					std::string unit;
+					if (valid && hasMore() && fields >> unit)
+					{
+						command.unitType = definitions.Find(DefinitionKind::UNIT, unit.c_str());
+						valid = command.unitType != NO_DEFINITION;
+					}
+				}
+				else if (name == "move")
+				{
+					command.type = CommandType::MOVE;
+					valid = ReadNumber(fields, team) && ReadNumber(fields, command.x) && ReadNumber(fields, command.y);
+				}
+				else if (name == "end")
+				{
+					command.type = CommandType::END;
+				}
+				else
+				{
+					valid = false;
+				}
+
+				if (!valid || hasMore() || team > 0xFF)
+				{
+					_outErrorLine = lineNumber;
+					return false;
+				}
+
+				command.team = static_cast<uint8_t>(team);
+				_outCommands.push_back(command);
+			}
+
+			return true;
+		}
+
+		bool Load(const char* _path, std::vector<Command>& _outCommands, unsigned int& _outErrorLine, const DefinitionDatabase* _definitions)
+		{
+			assert(_path); // Error: _path is nullptr.
+
+			if (strcmp(_path, "-") == 0)
+				return Parse(std::cin, _outCommands, _outErrorLine, _definitions);
+
+			std::ifstream file(_path);
+
+			if (!file)
+			{
+				_outErrorLine = 0;
+				return false;
+			}
+
+			return Parse(file, _outCommands, _outErrorLine, _definitions);
+		}
+
+		bool Write(std::ostream& _stream, const std::vector<Command>& _commands, const DefinitionDatabase* _definitions)
+		{
+			const DefinitionDatabase& definitions = _definitions ? *_definitions : DefinitionDatabase::GetBuiltIn();
+
+			// Enough digits that every float reads back exactly.
+			_stream.precision(9);
+
+			for (const Command& command : _commands)
+			{
+				_stream << command.tick;
+
+				switch (command.type)
+				{
+				case CommandType::SPAWN:
+					_stream << " spawn " << static_cast<unsigned int>(command.team) << ' ' << command.x << ' ' << command.y << ' ' <<
+						command.count << ' ' << command.radius << ' ' << definitions.GetName(DefinitionKind::UNIT, command.unitType) << '\n';
+					break;
+				case CommandType::MOVE:
+					_stream << " move " << static_cast<unsigned int>(command.team) << ' ' << command.x << ' ' << command.y << '\n';
+					break;
+				case CommandType::END:
+					_stream << " end\n";
+					break;
+				default:
+					return false;
+				}
+			}
+
+			return static_cast<bool>(_stream);
+		}
+
+		bool Save(const char* _path, const std::vector<Command>& _commands, const DefinitionDatabase* _definitions)
+		{
+			assert(_path); // Error: _path is nullptr.
+
+			if (strcmp(_path, "-") == 0)
+				return Write(std::cout, _commands, _definitions);
+
+			std::ofstream file(_path);
+			return file && Write(file, _commands, _definitions);
+		}
+	}
+}
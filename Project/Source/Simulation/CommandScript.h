@@ -0,0 +1,71 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: CommandScript.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Reads and writes lists of commands as text. Used to drive headless matches from a file
+		or from standard input. One command per line, blank lines and lines starting with '#' are skipped:
+
+			<tick> spawn <team> <x> <y> [count] [radius] [unit]
+			<tick> move <team> <x> <y>
+			<tick> end
+
+		Units are named as in the definitions. Spawns without a unit use the first one. A line is rejected
+		if a field given isn't valid or anything follows the last field. Ticks go up to a year into the
+		match and a spawn adds at most a million units.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <istream>
+#include <ostream>
+#include <vector>
+#include "Command.h"
+#include "../Data/DefinitionDatabase.h"
+
+namespace OC
+{
+	namespace CommandScript
+	{
+		// Description: Parses commands from a stream and appends them to a list.
+		// Parameters: 
+		//    std::istream& _stream, the stream to read until the end.
+		//    std::vector<Command>& _outCommands, the list to append the parsed commands to.
+		//    unsigned int& _outErrorLine, the first line that could not be parsed, if any.
+		//    const DefinitionDatabase* _definitions, the definitions unit names are looked up in. nullptr
+		//        uses the built-in definitions.
+		// Returns: true, if every line was parsed.
+		bool Parse(std::istream& _stream, std::vector<Command>& _outCommands, unsigned int& _outErrorLine, const DefinitionDatabase* _definitions = nullptr);
+
+		// Description: Parses commands from a file, or from standard input if the path is "-".
+		// Parameters: 
+		//    const char* _path, the file to read.
+		//    std::vector<Command>& _outCommands, the list to append the parsed commands to.
+		//    unsigned int& _outErrorLine, the first line that could not be parsed, or 0 if the file
+		//        could not be opened.
+		//    const DefinitionDatabase* _definitions, the definitions unit names are looked up in. nullptr
+		//        uses the built-in definitions.
+		// Returns: true, if the file was opened and every line was parsed.
+		bool Load(const char* _path, std::vector<Command>& _outCommands, unsigned int& _outErrorLine, const DefinitionDatabase* _definitions = nullptr);
+
+		// Description: Writes commands as a script that parses back to the same commands.
+		// Parameters: 
+		//    std::ostream& _stream, the stream to write to.
+		//    const std::vector<Command>& _commands, the commands.
+		//    const DefinitionDatabase* _definitions, the definitions unit names are taken from. nullptr
+		//        uses the built-in definitions.
+		// Returns: true, if every command was written. Scripts have no form for MOVE_UNIT.
+		bool Write(std::ostream& _stream, const std::vector<Command>& _commands, const DefinitionDatabase* _definitions = nullptr);
+
+		// Description: Writes commands to a script file, or to standard output if the path is "-".
+		// Parameters: 
+		//    const char* _path, the file to write.
+		//    const std::vector<Command>& _commands, the commands.
+		//    const DefinitionDatabase* _definitions, the definitions unit names are taken from. nullptr
+		//        uses the built-in definitions.
+		// Returns: true, if the file was written and every command could be.
+		bool Save(const char* _path, const std::vector<Command>& _commands, const DefinitionDatabase* _definitions = nullptr);
+	}
+}
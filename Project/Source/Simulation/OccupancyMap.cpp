@@ -0,0 +1,291 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: OccupancyMap.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <math.h>
+#include "../Math/Simd.h"
+#include "OccupancyMap.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace OC
+{
+	constexpr uint32_t WORD_BITS = 64; // Tiles per word.
+
+	// Description: Returns the mask of the bits from _first to _last of a word.
+	// Parameters: 
+	//    uint32_t _first, the first bit.
+	//    uint32_t _last, the last bit. At least _first.
+	// Returns: The mask.
+	static uint64_t SpanMask(uint32_t _first, uint32_t _last)
+	{
+		return (~0ULL << _first) & (~0ULL >> (WORD_BITS - 1 - _last));
+	}
+
+	// Description: Returns the index of the lowest set bit of a word.
+	// Parameters: 
+	//    uint64_t _word, the word. Not 0.
+	// Returns: The index.
+	static uint32_t LowestBit(uint64_t _word)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward64(&index, _word);
+		return static_cast<uint32_t>(index);
+#else
+		return static_cast<uint32_t>(__builtin_ctzll(_word));
+#endif
+	}
+
+	// private
+
+	uint64_t* OccupancyMap::Row(OccupancyLayer _layer, uint32_t _row)
+	{
+		return &m_Bits[(static_cast<size_t>(_layer) * m_Settings.height + _row) * m_WordsPerRow];
+	}
+
+	const uint64_t* OccupancyMap::Row(OccupancyLayer _layer, uint32_t _row) const
+	{
+		return &m_Bits[(static_cast<size_t>(_layer) * m_Settings.height + _row) * m_WordsPerRow];
+	}
+
+	void OccupancyMap::CountUnit(uint32_t _tile, bool _add)
+	{
+		uint16_t& count = m_UnitCounts[_tile];
+		uint64_t& word = Row(OccupancyLayer::UNITS, _tile / m_Settings.width)[(_tile % m_Settings.width) / WORD_BITS];
+		const uint64_t bit = 1ULL << (_tile % m_Settings.width % WORD_BITS);
+
+		if (_add)
+		{
+			assert(count < UINT16_MAX); // Error: Too many units on one tile.
+
+			if (count++ == 0)
+				word |= bit;
+		}
+		else
+		{
+			assert(count > 0); // Error: Removing a unit that wasn't counted.
+
+			if (--count == 0)
+				word &= ~bit;
+		}
+	}
+
+	// public
+
+	OccupancyMap::OccupancyMap(const OccupancySettings& _settings) :
+		m_Settings(_settings),
+		m_WordsPerRow(((_settings.width + WORD_BITS - 1) / WORD_BITS + Simd::WORD_WIDTH - 1) & ~(Simd::WORD_WIDTH - 1)),
+		m_Bits(static_cast<size_t>(OccupancyLayer::_COUNT) * _settings.height * m_WordsPerRow, 0),
+		m_UnitCounts(static_cast<size_t>(_settings.width) * _settings.height, 0),
+		m_UnitTiles(),
+		m_Blocked(m_WordsPerRow, 0)
+	{
+		assert(_settings.width > 0 && _settings.height > 0 && _settings.tileSize > 0.0f); // Error: Invalid map size.
+	}
+
+	void OccupancyMap::Fill(OccupancyLayer _layer, int32_t _x, int32_t _y, uint32_t _width, uint32_t _height, bool _taken)
+	{
+		assert(_layer < OccupancyLayer::_COUNT && _layer != OccupancyLayer::UNITS); // Error: Invalid layer.
+
+		// Clip to the map.
+		int64_t minX = _x > 0 ? _x : 0, minY = _y > 0 ? _y : 0;
+		int64_t maxX = static_cast<int64_t>(_x) + _width, maxY = static_cast<int64_t>(_y) + _height;
+		maxX = maxX < m_Settings.width ? maxX : m_Settings.width;
+		maxY = maxY < m_Settings.height ? maxY : m_Settings.height;
+
+		if (minX >= maxX || minY >= maxY)
+			return;
+
+		const uint32_t first = static_cast<uint32_t>(minX), last = static_cast<uint32_t>(maxX - 1);
+
+		for (uint32_t y = static_cast<uint32_t>(minY); y < maxY; ++y)
+		{
+			uint64_t* row = Row(_layer, y);
+
+			for (uint32_t word = first / WORD_BITS; word <= last / WORD_BITS; ++word)
+			{
+				uint64_t mask = SpanMask(word == first / WORD_BITS ? first % WORD_BITS : 0, word == last / WORD_BITS ? last % WORD_BITS : WORD_BITS - 1);
+				row[word] = _taken ? row[word] | mask : row[word] & ~mask;
+			}
+		}
+	}
+
+	uint32_t OccupancyMap::UpdateUnits(const UnitData& _units)
+	{
+		uint32_t changed = 0;
+
+		// Units removed since the last update, like when a save replaced them, leave their tiles.
+		for (UnitId unit = _units.Count(); unit < m_UnitTiles.size(); ++unit)
+		{
+			if (m_UnitTiles[unit] != INVALID_TILE)
+			{
+				CountUnit(m_UnitTiles[unit], false);
+				++changed;
+			}
+		}
+
+		m_UnitTiles.resize(_units.Count(), INVALID_TILE);
+
+		for (UnitId unit = 0; unit < _units.Count(); ++unit)
+		{
+			uint32_t tile = INVALID_TILE;
+
+			if (_units.IsAlive(unit))
+			{
+				int32_t x, y;
+				WorldToTile(_units.positionX[unit], _units.positionY[unit], x, y);
+
+				if (x >= 0 && y >= 0 && static_cast<uint32_t>(x) < m_Settings.width && static_cast<uint32_t>(y) < m_Settings.height)
+					tile = static_cast<uint32_t>(y) * m_Settings.width + static_cast<uint32_t>(x);
+			}
+
+			if (tile == m_UnitTiles[unit])
+				continue;
+
+			if (m_UnitTiles[unit] != INVALID_TILE)
+				CountUnit(m_UnitTiles[unit], false);
+
+			if (tile != INVALID_TILE)
+				CountUnit(tile, true);
+
+			m_UnitTiles[unit] = tile;
+			++changed;
+		}
+
+		return changed;
+	}
+
+	bool OccupancyMap::CanPlace(int32_t _x, int32_t _y, uint32_t _width, uint32_t _height, uint32_t _layers) const
+	{
+		if (_x < 0 || _y < 0 || _width == 0 || _height == 0 ||
+			static_cast<uint64_t>(_x) + _width > m_Settings.width || static_cast<uint64_t>(_y) + _height > m_Settings.height)
+			return false;
+
+		const uint32_t first = static_cast<uint32_t>(_x), last = first + _width - 1;
+		const uint32_t firstWord = first / WORD_BITS, lastWord = last / WORD_BITS;
+
+		for (uint32_t layer = 0; layer < static_cast<uint32_t>(OccupancyLayer::_COUNT); ++layer)
+		{
+			if (!(_layers & (1u << layer)))
+				continue;
+
+			for (uint32_t y = static_cast<uint32_t>(_y); y < static_cast<uint32_t>(_y) + _height; ++y)
+			{
+				const uint64_t* row = Row(static_cast<OccupancyLayer>(layer), y);
+
+				for (uint32_t word = firstWord; word <= lastWord; ++word)
+				{
+					uint64_t mask = SpanMask(word == firstWord ? first % WORD_BITS : 0, word == lastWord ? last % WORD_BITS : WORD_BITS - 1);
+					if (row[word] & mask)
+						return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	uint32_t OccupancyMap::FindPlacements(int32_t _minX, int32_t _minY, int32_t _maxX, int32_t _maxY, uint32_t _width, uint32_t _height,
+		uint32_t _layers, std::vector<uint32_t>& _outTiles)
+	{
+		_outTiles.clear();
+
+		if (_width == 0 || _height == 0 || _width > m_Settings.width || _height > m_Settings.height)
+			return 0;
+
+		// Clip the start positions to those that keep the footprint inside the map.
+		const int64_t lastX = static_cast<int64_t>(m_Settings.width) - _width, lastY = static_cast<int64_t>(m_Settings.height) - _height;
+		const uint32_t minX = static_cast<uint32_t>(_minX > 0 ? _minX : 0), minY = static_cast<uint32_t>(_minY > 0 ? _minY : 0);
+		const int64_t maxX = _maxX < lastX ? _maxX : lastX, maxY = _maxY < lastY ? _maxY : lastY;
+
+		if (static_cast<int64_t>(minX) > maxX || static_cast<int64_t>(minY) > maxY)
+			return 0;
+
+		// Only the words under footprints starting in the area are combined, in whole SIMD registers.
+		const uint32_t firstWord = (minX / WORD_BITS) & ~(Simd::WORD_WIDTH - 1);
+		const uint32_t endWord = static_cast<uint32_t>((maxX + _width - 1) / WORD_BITS + 1);
+		const uint32_t endPair = (endWord + Simd::WORD_WIDTH - 1) & ~(Simd::WORD_WIDTH - 1);
+		uint64_t* blocked = m_Blocked.data();
+
+		for (uint32_t y = minY; y <= maxY; ++y)
+		{
+			// Bit x is set if any tile in column x of the footprint's rows is taken on a blocking layer.
+			for (uint32_t word = firstWord; word < endPair; ++word)
+				blocked[word] = 0;
+
+			for (uint32_t layer = 0; layer < static_cast<uint32_t>(OccupancyLayer::_COUNT); ++layer)
+			{
+				if (!(_layers & (1u << layer)))
+					continue;
+
+				for (uint32_t row = y; row < y + _height; ++row)
+				{
+					const uint64_t* source = Row(static_cast<OccupancyLayer>(layer), row);
+
+					for (uint32_t word = firstWord; word < endPair; word += Simd::WORD_WIDTH)
+						Simd::StoreBits(blocked + word, Simd::Or(Simd::LoadBits(blocked + word), Simd::LoadBits(source + word)));
+				}
+			}
+
+			// Spread each taken column left over the starts whose footprint would cover it. Shifting by the
+			// width covered so far doubles it each time, so a footprint w wide takes about log2(w) passes.
+			for (uint32_t covered = 1; covered < _width;)
+			{
+				const uint32_t step = covered < _width - covered ? covered : _width - covered;
+				const uint32_t wordStep = step / WORD_BITS, bitStep = step % WORD_BITS;
+
+				// Ascending, so every word reads words above it before they change.
+				for (uint32_t word = firstWord; word < endWord; ++word)
+				{
+					uint64_t low = word + wordStep < endWord ? blocked[word + wordStep] : 0;
+					uint64_t high = word + wordStep + 1 < endWord ? blocked[word + wordStep + 1] : 0;
+					blocked[word] |= bitStep ? (low >> bitStep) | (high << (WORD_BITS - bitStep)) : low;
+				}
+
+				covered += step;
+			}
+
+			// Every clear bit in the area is a fit.
+			const uint32_t last = static_cast<uint32_t>(maxX);
+
+			for (uint32_t word = minX / WORD_BITS; word <= last / WORD_BITS; ++word)
+			{
+				uint64_t fits = ~blocked[word] & SpanMask(word == minX / WORD_BITS ? minX % WORD_BITS : 0, word == last / WORD_BITS ? last % WORD_BITS : WORD_BITS - 1);
+
+				for (; fits; fits &= fits - 1)
+					_outTiles.push_back(y * m_Settings.width + word * WORD_BITS + LowestBit(fits));
+			}
+		}
+
+		return static_cast<uint32_t>(_outTiles.size());
+	}
+
+	bool OccupancyMap::IsTaken(OccupancyLayer _layer, uint32_t _x, uint32_t _y) const
+	{
+		assert(_layer < OccupancyLayer::_COUNT); // Error: Invalid layer.
+		assert(_x < m_Settings.width && _y < m_Settings.height); // Error: Tile outside the map.
+
+		return (Row(_layer, _y)[_x / WORD_BITS] >> (_x % WORD_BITS)) & 1;
+	}
+
+	void OccupancyMap::WorldToTile(float _x, float _y, int32_t& _outX, int32_t& _outY) const
+	{
+		_outX = static_cast<int32_t>(floorf((_x - m_Settings.originX) / m_Settings.tileSize));
+		_outY = static_cast<int32_t>(floorf((_y - m_Settings.originY) / m_Settings.tileSize));
+	}
+
+	const OccupancySettings& OccupancyMap::GetSettings() const
+	{
+		return m_Settings;
+	}
+}
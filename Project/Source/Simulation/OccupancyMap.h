@@ -0,0 +1,165 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: OccupancyMap.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Which tiles of the map are taken, for checking where buildings can go. Each layer
+		(impassable terrain, buildings, units, resources) is a bitmap with one bit per tile, packed 64
+		tiles to a word, row by row. A footprint check masks the words its rows cover, so checking a
+		building costs one or two words per row rather than a test per tile. Callers choose which layers
+		block with a mask, so a preview can ignore units that will walk out of the way.
+
+		Searching an area for every place a footprint fits, as base planning does, goes a row of the map
+		at a time. The rows a footprint would cover are ORed together, two words per SIMD operation, and
+		the result is shifted onto itself until each bit covers a footprint's width. Every clear bit left
+		is a position that fits, so 64 positions are tested per word.
+
+		Buildings and resources are set and cleared as they're placed and destroyed. Units are counted per
+		tile, so their layer is updated incrementally from only the units that changed tiles.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include "Units.h"
+
+namespace OC
+{
+	enum class OccupancyLayer : uint8_t
+	{
+		TERRAIN,	// Tiles that can't be built on, like water and cliffs.
+		BUILDINGS,	// Tiles under buildings.
+		UNITS,		// Tiles with at least one living unit on them.
+		RESOURCES,	// Tiles with resources to gather.
+		_COUNT
+	};
+
+	// Description: Returns the mask of a layer, for combining into the layers a check is blocked by.
+	// Parameters: 
+	//    OccupancyLayer _layer, the layer.
+	// Returns: The mask.
+	constexpr uint32_t LayerMask(OccupancyLayer _layer)
+	{
+		return 1u << static_cast<uint32_t>(_layer);
+	}
+
+	constexpr uint32_t ALL_LAYERS = (1u << static_cast<uint32_t>(OccupancyLayer::_COUNT)) - 1; // Every layer blocks.
+
+	struct OccupancySettings
+	{
+		float originX = -2048.0f, originY = -2048.0f; // The world position of the map's top-left corner.
+		float tileSize = 16.0f; // The width and height of a tile, in world units.
+		uint32_t width = 256, height = 256; // The size of the map, in tiles.
+	};
+
+	class OccupancyMap
+	{
+	private:
+		OccupancySettings m_Settings; // The size and position of the map.
+		uint32_t m_WordsPerRow; // Words per row of a layer. Even, so rows can be read two words at a time.
+		std::vector<uint64_t> m_Bits; // Every layer, layer by layer, row by row. Bits past the width are 0.
+		std::vector<uint16_t> m_UnitCounts; // The living units on each tile.
+		std::vector<uint32_t> m_UnitTiles; // The tile each unit is counted on, or INVALID_TILE.
+		std::vector<uint64_t> m_Blocked; // Scratch: the blocked start positions of a row being searched.
+
+		// Description: Returns a row of a layer.
+		// Parameters: 
+		//    OccupancyLayer _layer, the layer.
+		//    uint32_t _row, the row.
+		// Returns: The first word of the row.
+		uint64_t* Row(OccupancyLayer _layer, uint32_t _row);
+
+		// Description: Returns a row of a layer.
+		// Parameters: 
+		//    OccupancyLayer _layer, the layer.
+		//    uint32_t _row, the row.
+		// Returns: The first word of the row.
+		const uint64_t* Row(OccupancyLayer _layer, uint32_t _row) const;
+
+		// Description: Adds or removes a unit from a tile's count, setting or clearing its bit when the
+		//    tile becomes taken or empty.
+		// Parameters: 
+		//    uint32_t _tile, the tile.
+		//    bool _add, if the unit is added rather than removed.
+		void CountUnit(uint32_t _tile, bool _add);
+
+	public:
+		static constexpr uint32_t INVALID_TILE = 0xFFFFFFFFU; // A position outside the map.
+
+		// Description: Constructs a map with nothing on it.
+		// Parameters: 
+		//    const OccupancySettings& _settings, the size and position of the map.
+		explicit OccupancyMap(const OccupancySettings& _settings = OccupancySettings());
+
+		// Description: OccupancyMap's cannot be created from other OccupancyMap's.
+		OccupancyMap(const OccupancyMap& _map) = delete;
+
+		// Description: OccupancyMap's cannot be assigned to other OccupancyMap's.
+		void operator=(const OccupancyMap& _map) = delete;
+
+		// Description: Sets or clears a rectangle of tiles of a layer. Parts outside the map are ignored.
+		//    Used to place and destroy buildings and resources, and to load terrain.
+		// Parameters: 
+		//    OccupancyLayer _layer, the layer. Not UNITS, which UpdateUnits keeps.
+		//    int32_t _x, the leftmost tile.
+		//    int32_t _y, the topmost tile.
+		//    uint32_t _width, the width, in tiles.
+		//    uint32_t _height, the height, in tiles.
+		//    bool _taken, if the tiles are set rather than cleared.
+		void Fill(OccupancyLayer _layer, int32_t _x, int32_t _y, uint32_t _width, uint32_t _height, bool _taken);
+
+		// Description: Brings the units layer up to date, touching only tiles that units left or entered.
+		// Parameters: 
+		//    const UnitData& _units, every unit in the world.
+		// Returns: The number of units that changed tiles, appeared or died.
+		uint32_t UpdateUnits(const UnitData& _units);
+
+		// Description: Returns if a footprint fits, inside the map and clear of every blocking layer.
+		// Parameters: 
+		//    int32_t _x, the leftmost tile.
+		//    int32_t _y, the topmost tile.
+		//    uint32_t _width, the width, in tiles.
+		//    uint32_t _height, the height, in tiles.
+		//    uint32_t _layers, the layers that block, as LayerMask's ORed together.
+		// Returns: true, if the footprint fits.
+		bool CanPlace(int32_t _x, int32_t _y, uint32_t _width, uint32_t _height, uint32_t _layers = ALL_LAYERS) const;
+
+		// Description: Finds every position in an area where a footprint fits.
+		// Parameters: 
+		//    int32_t _minX, the leftmost tile a footprint may start on.
+		//    int32_t _minY, the topmost tile a footprint may start on.
+		//    int32_t _maxX, the rightmost tile a footprint may start on.
+		//    int32_t _maxY, the bottommost tile a footprint may start on.
+		//    uint32_t _width, the width of the footprint, in tiles.
+		//    uint32_t _height, the height of the footprint, in tiles.
+		//    uint32_t _layers, the layers that block, as LayerMask's ORed together.
+		//    std::vector<uint32_t>& _outTiles, receives the top-left tile of every fit, row by row, as
+		//        y * width + x. Cleared first.
+		// Returns: The number of fits.
+		uint32_t FindPlacements(int32_t _minX, int32_t _minY, int32_t _maxX, int32_t _maxY, uint32_t _width, uint32_t _height,
+			uint32_t _layers, std::vector<uint32_t>& _outTiles);
+
+		// Description: Returns if a tile of a layer is taken.
+		// Parameters: 
+		//    OccupancyLayer _layer, the layer.
+		//    uint32_t _x, the tile's column.
+		//    uint32_t _y, the tile's row.
+		// Returns: true, if the tile is taken.
+		bool IsTaken(OccupancyLayer _layer, uint32_t _x, uint32_t _y) const;
+
+		// Description: Returns the tile under a world position.
+		// Parameters: 
+		//    float _x, the x position.
+		//    float _y, the y position.
+		//    int32_t& _outX, receives the tile's column. May be outside the map.
+		//    int32_t& _outY, receives the tile's row. May be outside the map.
+		void WorldToTile(float _x, float _y, int32_t& _outX, int32_t& _outY) const;
+
+		// Description: Returns the size and position of the map.
+		// Returns: The settings.
+		const OccupancySettings& GetSettings() const;
+	};
+}
@@ -0,0 +1,97 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Random.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: A small deterministic random number generator (xorshift64*). Unlike the standard
+		library distributions, it produces the same sequence on every platform and compiler, which the
+		simulation relies on to replay matches from a seed.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+namespace OC
+{
+	class Random
+	{
+	private:
+		uint64_t m_State; // The generator state. Never zero.
+
+	public:
+		// Description: Constructs the generator from a seed.
+		// Parameters: 
+		//    uint64_t _seed, the seed. Any value is allowed, including zero.
+		explicit Random(uint64_t _seed = 0)
+		{
+			Seed(_seed);
+		}
+
+		// Description: Restarts the sequence from a seed.
+		// Parameters: 
+		//    uint64_t _seed, the seed. Any value is allowed, including zero.
+		void Seed(uint64_t _seed)
+		{
+			// Mix the seed (splitmix64 finalizer) so nearby seeds produce unrelated sequences.
+			uint64_t z = _seed + 0x9E3779B97F4A7C15ULL;
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+			z = z ^ (z >> 31);
+			m_State = z ? z : 0x9E3779B97F4A7C15ULL;
+		}
+
+		// Description: Returns the generator state, to save it.
+		// Returns: The state.
+		uint64_t GetState() const
+		{
+			return m_State;
+		}
+
+		// Description: Restores a state returned by GetState.
+		// Parameters: 
+		//    uint64_t _state, the state. Must not be zero.
+		void SetState(uint64_t _state)
+		{
+			m_State = _state ? _state : 0x9E3779B97F4A7C15ULL;
+		}
+
+		// Description: Returns the next 32 random bits.
+		// Returns: A uniformly distributed 32-bit value.
+		uint32_t Next()
+		{
+			m_State ^= m_State >> 12;
+			m_State ^= m_State << 25;
+			m_State ^= m_State >> 27;
+			return static_cast<uint32_t>((m_State * 0x2545F4914F6CDD1DULL) >> 32);
+		}
+
+		// Description: Returns a value in [0, _bound).
+		// Parameters: 
+		//    uint32_t _bound, the exclusive upper bound. Must be greater than zero.
+		// Returns: A value in [0, _bound).
+		uint32_t NextBelow(uint32_t _bound)
+		{
+			return static_cast<uint32_t>((static_cast<uint64_t>(Next()) * _bound) >> 32);
+		}
+
+		// Description: Returns a float in [0, 1).
+		// Returns: A value in [0, 1) with 24 bits of precision.
+		float NextFloat()
+		{
+			return static_cast<float>(Next() >> 8) * (1.0f / 16777216.0f);
+		}
+
+		// Description: Returns a float in [_min, _max).
+		// Parameters: 
+		//    float _min, the inclusive lower bound.
+		//    float _max, the exclusive upper bound.
+		// Returns: A value in [_min, _max).
+		float NextFloat(float _min, float _max)
+		{
+			return _min + (_max - _min) * NextFloat();
+		}
+	};
+}
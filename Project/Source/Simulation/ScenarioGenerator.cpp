@@ -0,0 +1,99 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: ScenarioGenerator.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <math.h>
+#include "Random.h"
+#include "ScenarioGenerator.h"
+
+namespace OC
+{
+	namespace ScenarioGenerator
+	{
+		constexpr float TWO_PI = 6.2831853f;
+		constexpr float ARMY_DISTANCE = 0.25f; // How far armies start from the centre, as a share of the map size.
+		constexpr float ARMY_RADIUS = 0.12f; // How far squads are scattered around their army, as a share of the map size.
+		constexpr float SQUAD_SPACING = 8.0f; // Room per unit in a squad, in world units. A squad's radius grows with its square root.
+
+		uint32_t Generate(const ScenarioSettings& _settings, std::vector<Command>& _outCommands, const DefinitionDatabase* _definitions)
+		{
+			assert(_settings.teamCount > 0 && _settings.teamCount <= 256); // Error: Teams are numbered with 8 bits.
+			assert(_settings.squadSize > 0 && _settings.mapSize > 0.0f); // Error: Invalid scenario settings.
+
+			const DefinitionDatabase& definitions = _definitions ? *_definitions : DefinitionDatabase::GetBuiltIn();
+
+			// Without a mix, every unit is as likely as any other.
+			std::vector<ScenarioUnit> composition = _settings.composition;
+			if (composition.empty())
+			{
+				for (UnitType type = 0; type < definitions.GetCount(DefinitionKind::UNIT); ++type)
+					composition.push_back(ScenarioUnit{ type, 1 });
+			}
+
+			uint32_t totalWeight = 0;
+			for (const ScenarioUnit& unit : composition)
+			{
+				assert(unit.type < definitions.GetCount(DefinitionKind::UNIT)); // Error: Unknown unit type.
+				totalWeight += unit.weight;
+			}
+
+			assert(totalWeight > 0); // Error: Every unit in the mix has no weight.
+
+			Random random(_settings.seed);
+			const float squadRadius = SQUAD_SPACING * sqrtf(static_cast<float>(_settings.squadSize));
+			uint32_t squads = 0;
+
+			for (uint32_t team = 0; team < _settings.teamCount; ++team)
+			{
+				// Share the units out, the first teams taking one more each when they don't divide evenly.
+				uint32_t remaining = _settings.unitCount / _settings.teamCount + (team < _settings.unitCount % _settings.teamCount ? 1 : 0);
+				float angle = TWO_PI * team / _settings.teamCount;
+				float armyX = cosf(angle) * ARMY_DISTANCE * _settings.mapSize;
+				float armyY = sinf(angle) * ARMY_DISTANCE * _settings.mapSize;
+
+				for (; remaining > 0; ++squads)
+				{
+					// Squads are spread evenly over a disc around the army.
+					float squadAngle = random.NextFloat(0.0f, TWO_PI);
+					float distance = ARMY_RADIUS * _settings.mapSize * sqrtf(random.NextFloat());
+
+					// Pick the squad's unit by weight.
+					uint32_t pick = random.NextBelow(totalWeight);
+					size_t unit = 0;
+					while (pick >= composition[unit].weight)
+						pick -= composition[unit++].weight;
+
+					Command spawn = {};
+					spawn.type = CommandType::SPAWN;
+					spawn.team = static_cast<uint8_t>(team);
+					spawn.unitType = composition[unit].type;
+					spawn.count = remaining < _settings.squadSize ? remaining : _settings.squadSize;
+					spawn.x = armyX + cosf(squadAngle) * distance;
+					spawn.y = armyY + sinf(squadAngle) * distance;
+					spawn.radius = squadRadius;
+					_outCommands.push_back(spawn);
+
+					remaining -= spawn.count;
+				}
+			}
+
+			// Every army marches on the centre.
+			for (uint32_t team = 0; team < _settings.teamCount; ++team)
+			{
+				Command move = {};
+				move.type = CommandType::MOVE;
+				move.team = static_cast<uint8_t>(team);
+				_outCommands.push_back(move);
+			}
+
+			return squads;
+		}
+	}
+}
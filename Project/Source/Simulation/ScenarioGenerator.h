@@ -0,0 +1,53 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: ScenarioGenerator.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Builds large battles from a seed, to stress the simulation without hand-made content.
+		Each team's army is split into squads scattered around its corner of a square map. The armies
+		are evenly spaced around the centre, and each squad's unit is drawn from a weighted mix. On the
+		first tick every team is ordered to the centre, so the armies meet there.
+
+		The result is a list of ordinary commands, so a scenario can be run by a World, written as a
+		script for the server, or saved. The same settings and seed always give the same commands.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include "Command.h"
+#include "../Data/DefinitionDatabase.h"
+
+namespace OC
+{
+	struct ScenarioUnit
+	{
+		UnitType type; // The unit.
+		uint32_t weight; // How often squads are made of it, relative to the others.
+	};
+
+	struct ScenarioSettings
+	{
+		uint64_t seed = 1; // Where squads go and what they're made of.
+		uint32_t unitCount = 10000; // Units across every team.
+		uint32_t teamCount = 2; // The number of armies.
+		uint32_t squadSize = 50; // Units per squad. Squads spawn as one command each.
+		float mapSize = 4096.0f; // The width and height of the map, centred on the origin.
+		std::vector<ScenarioUnit> composition; // The mix of units. Empty uses every unit equally.
+	};
+
+	namespace ScenarioGenerator
+	{
+		// Description: Generates the commands that set up and start a battle.
+		// Parameters: 
+		//    const ScenarioSettings& _settings, the size and make-up of the battle.
+		//    std::vector<Command>& _outCommands, receives the commands, in tick order. Appended.
+		//    const DefinitionDatabase* _definitions, the definitions units are drawn from. nullptr uses
+		//        the built-in definitions.
+		// Returns: The number of squads.
+		uint32_t Generate(const ScenarioSettings& _settings, std::vector<Command>& _outCommands, const DefinitionDatabase* _definitions = nullptr);
+	}
+}
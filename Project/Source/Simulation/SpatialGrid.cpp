@@ -0,0 +1,117 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: SpatialGrid.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <assert.h>
+#include "SpatialGrid.h"
+
+namespace OC
+{
+	// public
+
+	SpatialGrid::SpatialGrid(float _cellSize) :
+		m_CellSize(_cellSize),
+		m_InverseCellSize(1.0f / _cellSize),
+		m_MinX(0.0f), m_MinY(0.0f),
+		m_Columns(1), m_Rows(1),
+		m_CellStart(2, 0),
+		m_Units(), m_X(), m_Y(),
+		m_Scratch(),
+		m_Cursor()
+	{
+		assert(_cellSize > 0.0f); // Error: Cells must have a size.
+	}
+
+	void SpatialGrid::Build(const UnitData& _units)
+	{
+		const uint32_t count = _units.Count();
+		const float* positionX = _units.positionX.data();
+		const float* positionY = _units.positionY.data();
+		const float* health = _units.health.data();
+
+		// Find the bounds of the living units.
+		float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+		uint32_t alive = 0;
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			if (health[i] <= 0.0f)
+				continue;
+
+			if (alive++ == 0)
+			{
+				minX = maxX = positionX[i];
+				minY = maxY = positionY[i];
+			}
+			else
+			{
+				minX = std::min(minX, positionX[i]);
+				maxX = std::max(maxX, positionX[i]);
+				minY = std::min(minY, positionY[i]);
+				maxY = std::max(maxY, positionY[i]);
+			}
+		}
+
+		// Size the grid to the bounds. Units spread over a huge area get bigger cells so the cell
+		// array stays proportional to the number of units.
+		const double maxCells = std::max(1024.0, 4.0 * alive);
+		float cellSize = m_CellSize;
+
+		while (static_cast<double>(floorf((maxX - minX) / cellSize) + 1.0f) * (floorf((maxY - minY) / cellSize) + 1.0f) > maxCells)
+			cellSize *= 2.0f;
+
+		m_InverseCellSize = 1.0f / cellSize;
+		m_MinX = minX;
+		m_MinY = minY;
+		m_Columns = static_cast<int>((maxX - minX) * m_InverseCellSize) + 1;
+		m_Rows = static_cast<int>((maxY - minY) * m_InverseCellSize) + 1;
+
+		const uint32_t cellCount = static_cast<uint32_t>(m_Columns * m_Rows);
+
+		// Count the units in each cell.
+		m_CellStart.assign(cellCount + 1, 0);
+		m_Scratch.resize(count);
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			if (health[i] <= 0.0f)
+				continue;
+
+			int column = Clamp(static_cast<int>((positionX[i] - minX) * m_InverseCellSize), m_Columns);
+			int row = Clamp(static_cast<int>((positionY[i] - minY) * m_InverseCellSize), m_Rows);
+			uint32_t cell = static_cast<uint32_t>(row * m_Columns + column);
+
+			m_Scratch[i] = cell;
+			++m_CellStart[cell + 1];
+		}
+
+		// Turn the counts into start offsets.
+		for (uint32_t cell = 0; cell < cellCount; ++cell)
+			m_CellStart[cell + 1] += m_CellStart[cell];
+
+		// Scatter the units into cell order. Walking units in id order keeps each cell sorted by id.
+		m_Units.resize(alive);
+		m_X.resize(alive);
+		m_Y.resize(alive);
+
+		m_Cursor.assign(m_CellStart.begin(), m_CellStart.end() - 1);
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			if (health[i] <= 0.0f)
+				continue;
+
+			uint32_t slot = m_Cursor[m_Scratch[i]]++;
+			m_Units[slot] = i;
+			m_X[slot] = positionX[i];
+			m_Y[slot] = positionY[i];
+		}
+	}
+}
@@ -0,0 +1,113 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: SpatialGrid.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: A uniform grid over the living units of a world, rebuilt from scratch every tick with a
+		counting sort. Unit positions are copied into cell order so neighbour queries read contiguous
+		memory. Queries visit units in a fixed order, which keeps everything built on them deterministic.
+		Cells are small; querying a radius several cells wide is fine.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <math.h>
+#include <vector>
+#include "Units.h"
+
+namespace OC
+{
+	class SpatialGrid
+	{
+	private:
+		float m_CellSize; // The width and height of a cell, in world units.
+		float m_InverseCellSize; // 1 / m_CellSize.
+		float m_MinX, m_MinY; // The world position of the grid's top-left corner.
+		int m_Columns, m_Rows; // The number of cells on each axis.
+		std::vector<uint32_t> m_CellStart; // Index of the first entry of each cell. One extra at the end.
+		std::vector<UnitId> m_Units; // Unit ids sorted by cell.
+		std::vector<float> m_X, m_Y; // Unit positions sorted by cell.
+		std::vector<uint32_t> m_Scratch; // Cell of each unit while building.
+		std::vector<uint32_t> m_Cursor; // Next free entry of each cell while building.
+
+		// Description: Clamps a cell coordinate to [0, _count).
+		// Parameters: 
+		//    int _value, the coordinate.
+		//    int _count, the number of cells on the axis.
+		// Returns: The clamped coordinate.
+		static int Clamp(int _value, int _count)
+		{
+			return _value < 0 ? 0 : (_value >= _count ? _count - 1 : _value);
+		}
+
+	public:
+		// Description: Constructs an empty grid.
+		// Parameters: 
+		//    float _cellSize, the preferred width and height of a cell. Works best near the most common
+		//        query radius. Grows if the units are spread too thin for it.
+		explicit SpatialGrid(float _cellSize = 16.0f);
+
+		// Description: Rebuilds the grid from the living units.
+		// Parameters: 
+		//    const UnitData& _units, the units to insert. Dead units are left out.
+		void Build(const UnitData& _units);
+
+		// Description: Returns the number of units in the grid.
+		// Returns: The number of units.
+		uint32_t Count() const
+		{
+			return static_cast<uint32_t>(m_Units.size());
+		}
+
+		// Description: Calls a function for every unit within a radius of a point. Rows of cells are
+		//    visited from the row of the centre outward, alternating above and below, so searches that
+		//    stop early still find the closest units first. Within a row, units are visited by cell and
+		//    then by id.
+		// Parameters: 
+		//    float _x, the x position of the centre.
+		//    float _y, the y position of the centre.
+		//    float _radius, the search radius.
+		//    Function&& _function, called as _function(UnitId unit, float dx, float dy, float distanceSq),
+		//        where (dx, dy) points from the centre to the unit. Return false to stop the search.
+		template<typename Function>
+		void Query(float _x, float _y, float _radius, Function&& _function) const
+		{
+			if (m_Units.empty())
+				return;
+
+			const int firstColumn = Clamp(static_cast<int>(floorf((_x - _radius - m_MinX) * m_InverseCellSize)), m_Columns);
+			const int lastColumn = Clamp(static_cast<int>(floorf((_x + _radius - m_MinX) * m_InverseCellSize)), m_Columns);
+			const int firstRow = Clamp(static_cast<int>(floorf((_y - _radius - m_MinY) * m_InverseCellSize)), m_Rows);
+			const int lastRow = Clamp(static_cast<int>(floorf((_y + _radius - m_MinY) * m_InverseCellSize)), m_Rows);
+			const int centreRow = Clamp(static_cast<int>(floorf((_y - m_MinY) * m_InverseCellSize)), m_Rows);
+			const float radiusSq = _radius * _radius;
+
+			for (int offset = 0; centreRow - offset >= firstRow || centreRow + offset <= lastRow; ++offset)
+			{
+				for (int side = 0; side < (offset ? 2 : 1); ++side)
+				{
+					const int row = side ? centreRow + offset : centreRow - offset;
+
+					if (row < firstRow || row > lastRow)
+						continue;
+
+					// Cells of a row are contiguous, so the whole span is one run of entries.
+					const uint32_t begin = m_CellStart[row * m_Columns + firstColumn];
+					const uint32_t end = m_CellStart[row * m_Columns + lastColumn + 1];
+
+					for (uint32_t i = begin; i < end; ++i)
+					{
+						float dx = m_X[i] - _x;
+						float dy = m_Y[i] - _y;
+						float distanceSq = dx * dx + dy * dy;
+
+						if (distanceSq <= radiusSq && !_function(m_Units[i], dx, dy, distanceSq))
+							return;
+					}
+				}
+			}
+		}
+	};
+}
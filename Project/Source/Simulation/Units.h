@@ -0,0 +1,112 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: Units.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Structure-of-arrays storage for the units of a world. Each attribute lives in its own
+		tightly packed array so systems only touch the data they need. A unit's id is its index.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <vector>
+#include "../Data/Definitions.h"
+
+namespace OC
+{
+	typedef uint32_t UnitId; // Dense index into the unit arrays.
+
+	constexpr UnitId INVALID_UNIT = 0xFFFFFFFFU;
+
+	struct UnitData
+	{
+		std::vector<float> positionX, positionY; // World position.
+		std::vector<float> velocityX, velocityY; // Current velocity in world units per second.
+		std::vector<float> goalX, goalY; // Where the unit is trying to move to.
+		std::vector<float> speed; // Movement speed in world units per second.
+		std::vector<float> health; // Remaining health. Units with no health are dead.
+		std::vector<uint8_t> team; // The team (player) the unit belongs to.
+		std::vector<UnitType> type; // The unit's definition.
+
+		// Description: Returns the number of units, dead or alive.
+		// Returns: The number of units.
+		uint32_t Count() const
+		{
+			return static_cast<uint32_t>(positionX.size());
+		}
+
+		// Description: Returns if a unit is alive.
+		// Parameters: 
+		//    UnitId _unit, the unit to check.
+		// Returns: true, if the unit has health remaining.
+		bool IsAlive(UnitId _unit) const
+		{
+			assert(_unit < Count()); // Error: Invalid unit.
+
+			return health[_unit] > 0.0f;
+		}
+
+		// Description: Adds a unit standing still at a position.
+		// Parameters: 
+		//    uint8_t _team, the team the unit belongs to.
+		//    float _x, the x position of the unit.
+		//    float _y, the y position of the unit.
+		//    float _speed, movement speed in world units per second.
+		//    float _health, the starting health.
+		//    UnitType _type, the unit's definition.
+		// Returns: The id of the new unit.
+		UnitId Add(uint8_t _team, float _x, float _y, float _speed, float _health, UnitType _type = 0)
+		{
+			UnitId id = Count();
+
+			positionX.push_back(_x);
+			positionY.push_back(_y);
+			velocityX.push_back(0.0f);
+			velocityY.push_back(0.0f);
+			goalX.push_back(_x);
+			goalY.push_back(_y);
+			speed.push_back(_speed);
+			health.push_back(_health);
+			team.push_back(_team);
+			type.push_back(_type);
+
+			return id;
+		}
+
+		// Description: Reserves space for a number of units.
+		// Parameters: 
+		//    uint32_t _count, the total number of units to make room for.
+		void Reserve(uint32_t _count)
+		{
+			positionX.reserve(_count);
+			positionY.reserve(_count);
+			velocityX.reserve(_count);
+			velocityY.reserve(_count);
+			goalX.reserve(_count);
+			goalY.reserve(_count);
+			speed.reserve(_count);
+			health.reserve(_count);
+			team.reserve(_count);
+			type.reserve(_count);
+		}
+
+		// Description: Removes all units.
+		void Clear()
+		{
+			positionX.clear();
+			positionY.clear();
+			velocityX.clear();
+			velocityY.clear();
+			goalX.clear();
+			goalY.clear();
+			speed.clear();
+			health.clear();
+			team.clear();
+			type.clear();
+		}
+	};
+}
@@ -0,0 +1,312 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: World.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <assert.h>
+#include <math.h>
+#include "World.h"
+
+namespace OC
+{
+	// private
+
+	void World::Apply(const Command& _command)
+	{
+		switch (_command.type)
+		{
+		case CommandType::SPAWN:
+		{
+			const UnitDef& definition = m_Definitions.GetUnit(_command.unitType);
+
+			// Reserving exactly would move every unit on every spawn, so grow at least geometrically.
+			const uint32_t needed = m_Units.Count() + _command.count;
+			if (needed > m_Units.positionX.capacity())
+				m_Units.Reserve(std::max(needed, m_Units.Count() * 2));
+
+			for (uint32_t i = 0; i < _command.count; ++i)
+			{
+				// Scatter units uniformly over a disc around the spawn point.
+				float angle = m_Random.NextFloat(0.0f, 6.2831853f);
+				float distance = _command.radius * sqrtf(m_Random.NextFloat());
+
+				m_Units.Add(
+					_command.team,
+					_command.x + cosf(angle) * distance,
+					_command.y + sinf(angle) * distance,
+					definition.speed,
+					definition.health,
+					_command.unitType
+				);
+			}
+
+			m_AliveCount += definition.health > 0.0f ? _command.count : 0;
+			break;
+		}
+		case CommandType::MOVE:
+		{
+			const uint32_t count = m_Units.Count();
+
+			for (UnitId unit = 0; unit < count; ++unit)
+			{
+				if (m_Units.team[unit] == _command.team)
+				{
+					m_Units.goalX[unit] = _command.x;
+					m_Units.goalY[unit] = _command.y;
+				}
+			}
+			break;
+		}
+		case CommandType::END:
+			m_Ended = true;
+			break;
+		case CommandType::MOVE_UNIT:
+		{
+			// Orders may come from other machines, so orders for units that aren't the team's are dropped.
+			if (_command.unit < m_Units.Count() && m_Units.team[_command.unit] == _command.team)
+			{
+				m_Units.goalX[_command.unit] = _command.x;
+				m_Units.goalY[_command.unit] = _command.y;
+			}
+			break;
+		}
+		default:
+			assert(false); // Error: Unknown command type.
+			break;
+		}
+	}
+
+	// public
+
+	World::World(uint64_t _seed, JobSystem* _jobs, const DefinitionDatabase* _definitions) :
+		m_Jobs(_jobs),
+		m_Definitions(_definitions ? *_definitions : DefinitionDatabase::GetBuiltIn()),
+		m_Seed(_seed),
+		m_Tick(0),
+		m_Ended(false),
+		m_Random(_seed),
+		m_Units(),
+		m_AliveCount(0),
+		m_Grid(),
+		m_AI(m_Definitions),
+		m_Weapons(m_Definitions),
+		m_Projectiles(),
+		m_Steering(),
+		m_Commands()
+	{}
+
+	void World::Queue(const Command& _command)
+	{
+		assert(_command.type < CommandType::_COUNT); // Error: Unknown command type.
+		assert(_command.type != CommandType::SPAWN || _command.unitType < m_Definitions.GetCount(DefinitionKind::UNIT)); // Error: Unknown unit type.
+
+		// Insert after every command on the same tick so commands apply in the order they were queued.
+		auto position = std::upper_bound(
+			m_Commands.begin(), m_Commands.end(), _command.tick,
+			[](uint64_t _tick, const Command& _other) { return _tick < _other.tick; }
+		);
+
+		m_Commands.insert(position, _command);
+	}
+
+	void World::Queue(const std::vector<Command>& _commands)
+	{
+		if (_commands.empty())
+			return;
+
+		const size_t existing = m_Commands.size();
+		m_Commands.insert(m_Commands.end(), _commands.begin(), _commands.end());
+
+		auto byTick = [](const Command& _a, const Command& _b) { return _a.tick < _b.tick; };
+		auto middle = m_Commands.begin() + existing;
+
+		for (auto command = middle; command != m_Commands.end(); ++command)
+		{
+			assert(command->type < CommandType::_COUNT); // Error: Unknown command type.
+			assert(command->type != CommandType::SPAWN || command->unitType < m_Definitions.GetCount(DefinitionKind::UNIT)); // Error: Unknown unit type.
+		}
+
+		// Both halves are stable, so commands already queued stay ahead of new ones on the same tick.
+		if (!std::is_sorted(middle, m_Commands.end(), byTick))
+			std::stable_sort(middle, m_Commands.end(), byTick);
+
+		std::inplace_merge(m_Commands.begin(), middle, m_Commands.end(), byTick);
+	}
+
+	void World::Tick()
+	{
+		assert(!m_Ended); // Error: The match has already ended.
+
+		// Apply every command that is due.
+		size_t applied = 0;
+
+		while (applied < m_Commands.size() && m_Commands[applied].tick <= m_Tick)
+			Apply(m_Commands[applied++]);
+
+		if (applied)
+			m_Commands.erase(m_Commands.begin(), m_Commands.begin() + applied);
+
+		// Units spawned on the tick a match ends are never thought about, but their AI state must exist.
+		m_AI.Track(m_Units.Count());
+
+		// An ended match no longer advances.
+		if (m_Ended)
+			return;
+
+		m_Grid.Build(m_Units);
+		m_AI.Update(m_Units, m_Grid);
+		m_Weapons.Update(m_Units, m_AI.GetTargets(), m_Projectiles, TICK_SECONDS);
+		m_Projectiles.Update(m_Units, m_Grid, TICK_SECONDS, m_Jobs);
+		m_AliveCount -= m_Projectiles.GetLastKillCount();
+		m_Steering.Update(m_Units, m_Grid, TICK_SECONDS, m_Jobs);
+
+		++m_Tick;
+	}
+
+	void World::Save(SaveWriter& _save) const
+	{
+		_save.BeginChunk(MakeChunkId('W', 'R', 'L', 'D'), 1);
+		_save.Write(m_Seed);
+		_save.Write(m_Tick);
+		_save.Write(static_cast<uint8_t>(m_Ended));
+		_save.Write(m_Random.GetState());
+		_save.EndChunk();
+
+		_save.BeginChunk(MakeChunkId('U', 'N', 'I', 'T'), 2);
+		_save.WriteArray(m_Units.positionX);
+		_save.WriteArray(m_Units.positionY);
+		_save.WriteArray(m_Units.velocityX);
+		_save.WriteArray(m_Units.velocityY);
+		_save.WriteArray(m_Units.goalX);
+		_save.WriteArray(m_Units.goalY);
+		_save.WriteArray(m_Units.speed);
+		_save.WriteArray(m_Units.health);
+		_save.WriteArray(m_Units.team);
+		_save.WriteArray(m_Units.type);
+		_save.EndChunk();
+
+		_save.BeginChunk(MakeChunkId('C', 'M', 'D', 'S'), 3);
+		_save.WriteArray(m_Commands);
+		_save.EndChunk();
+
+		m_AI.Save(_save);
+		m_Weapons.Save(_save);
+		m_Projectiles.Save(_save);
+	}
+
+	bool World::Load(SaveReader& _save)
+	{
+		uint16_t version;
+		uint8_t ended;
+		uint64_t randomState;
+
+		if (!_save.OpenChunk(MakeChunkId('W', 'R', 'L', 'D'), version) || version != 1 ||
+			!_save.Read(m_Seed) || !_save.Read(m_Tick) || !_save.Read(ended) || !_save.Read(randomState))
+			return false;
+
+		m_Ended = ended != 0;
+		m_Random.SetState(randomState);
+
+		if (!_save.OpenChunk(MakeChunkId('U', 'N', 'I', 'T'), version) || version < 1 || version > 2 ||
+			!_save.ReadArray(m_Units.positionX) || !_save.ReadArray(m_Units.positionY) ||
+			!_save.ReadArray(m_Units.velocityX) || !_save.ReadArray(m_Units.velocityY) ||
+			!_save.ReadArray(m_Units.goalX) || !_save.ReadArray(m_Units.goalY) ||
+			!_save.ReadArray(m_Units.speed) || !_save.ReadArray(m_Units.health) || !_save.ReadArray(m_Units.team))
+			return false;
+
+		const uint32_t count = m_Units.Count();
+		const uint32_t unitTypes = m_Definitions.GetCount(DefinitionKind::UNIT);
+
+		// Saves from before definitions only had the first unit.
+		if (version == 1)
+			m_Units.type.assign(count, 0);
+		else if (!_save.ReadArray(m_Units.type))
+			return false;
+
+		if (m_Units.positionY.size() != count || m_Units.velocityX.size() != count || m_Units.velocityY.size() != count ||
+			m_Units.goalX.size() != count || m_Units.goalY.size() != count || m_Units.speed.size() != count ||
+			m_Units.health.size() != count || m_Units.team.size() != count || m_Units.type.size() != count)
+			return false;
+
+		m_AliveCount = 0;
+
+		for (UnitId unit = 0; unit < count; ++unit)
+		{
+			if (m_Units.type[unit] >= unitTypes)
+				return false;
+
+			m_AliveCount += m_Units.IsAlive(unit) ? 1 : 0;
+		}
+
+		// Older commands are the same size, with padding where the unit type (version 1) and the unit of
+		// MOVE_UNIT (version 2) are now.
+		if (!_save.OpenChunk(MakeChunkId('C', 'M', 'D', 'S'), version) || version < 1 || version > 3 || !_save.ReadArray(m_Commands))
+			return false;
+
+		for (Command& command : m_Commands)
+		{
+			if (version == 1)
+				command.unitType = 0;
+
+			if (version < 3)
+				command.unit = INVALID_UNIT;
+
+			if (command.type >= CommandType::_COUNT || (command.type == CommandType::SPAWN && command.unitType >= unitTypes) ||
+				(command.type == CommandType::MOVE_UNIT && version < 3))
+				return false;
+		}
+
+		return m_AI.Load(_save, count) && m_Weapons.Load(_save, count) && m_Projectiles.Load(_save);
+	}
+
+	bool World::HasEnded() const
+	{
+		return m_Ended;
+	}
+
+	uint64_t World::GetSeed() const
+	{
+		return m_Seed;
+	}
+
+	uint64_t World::GetTick() const
+	{
+		return m_Tick;
+	}
+
+	const UnitData& World::GetUnits() const
+	{
+		return m_Units;
+	}
+
+	uint32_t World::GetAliveCount() const
+	{
+		return m_AliveCount;
+	}
+
+	const DefinitionDatabase& World::GetDefinitions() const
+	{
+		return m_Definitions;
+	}
+
+	const ProjectileSystem& World::GetProjectiles() const
+	{
+		return m_Projectiles;
+	}
+
+	AISystem& World::GetAI()
+	{
+		return m_AI;
+	}
+
+	const AISystem& World::GetAI() const
+	{
+		return m_AI;
+	}
+}
@@ -0,0 +1,135 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: World.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: A single match. Owns the units and advances them one fixed-length tick at a time. A
+		world has no knowledge of windows, input or rendering, so it can run headless.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <vector>
+#include "../AI/AISystem.h"
+#include "../Combat/ProjectileSystem.h"
+#include "../Combat/WeaponSystem.h"
+#include "../Data/DefinitionDatabase.h"
+#include "../Serialization/SaveGame.h"
+#include "../Steering/SteeringSystem.h"
+#include "../Threading/JobSystem.h"
+#include "Command.h"
+#include "Random.h"
+#include "SpatialGrid.h"
+#include "Units.h"
+
+namespace OC
+{
+	constexpr unsigned int TICKS_PER_SECOND = 20; // How many times per second a world is ticked.
+	constexpr float TICK_SECONDS = 1.0f / TICKS_PER_SECOND; // The simulated time of a single tick.
+
+	class World
+	{
+	private:
+		JobSystem* m_Jobs; // Splits the work of a tick across threads, if not nullptr.
+		const DefinitionDatabase& m_Definitions; // What every unit and weapon is.
+		uint64_t m_Seed; // The seed the world was created with.
+		uint64_t m_Tick; // The number of ticks simulated so far.
+		bool m_Ended; // If an END command has been applied.
+		Random m_Random; // Source of randomness for the simulation.
+		UnitData m_Units; // Every unit in the world.
+		uint32_t m_AliveCount; // Living units, kept up to date by spawns and kills.
+		SpatialGrid m_Grid; // The living units, rebuilt every tick.
+		AISystem m_AI; // Decides what units do on their own.
+		WeaponSystem m_Weapons; // Fires at the targets the AI picked.
+		ProjectileSystem m_Projectiles; // Every projectile in flight.
+		SteeringSystem m_Steering; // Moves units toward their goals without piling into each other.
+		std::vector<Command> m_Commands; // Commands waiting to be applied, sorted by tick.
+
+		// Description: Applies a command to the world.
+		// Parameters: 
+		//    const Command& _command, the command to apply.
+		void Apply(const Command& _command);
+
+	public:
+		// Description: Constructs an empty world.
+		// Parameters: 
+		//    uint64_t _seed, the seed for every random decision made in the world.
+		//    JobSystem* _jobs, splits the work of a tick across threads if not nullptr. The result of a
+		//        tick is the same either way.
+		//    const DefinitionDatabase* _definitions, the units and weapons of the match. Must outlive the
+		//        world. nullptr uses the built-in definitions.
+		explicit World(uint64_t _seed, JobSystem* _jobs = nullptr, const DefinitionDatabase* _definitions = nullptr);
+
+		// Description: World's cannot be created from other World's.
+		World(const World& _world) = delete;
+
+		// Description: World's cannot be assigned to other World's.
+		void operator=(const World& _world) = delete;
+
+		// Description: Queues a command. Commands for past ticks are applied on the next tick. Spawns must
+		//    name a unit in the world's definitions.
+		// Parameters: 
+		//    const Command& _command, the command to queue.
+		void Queue(const Command& _command);
+
+		// Description: Queues a batch of commands, like the orders for every unit of a selection, in one
+		//    pass over the queue. Commands on the same tick apply in the order they were queued.
+		// Parameters: 
+		//    const std::vector<Command>& _commands, the commands to queue, in any order of ticks.
+		void Queue(const std::vector<Command>& _commands);
+
+		// Description: Applies the commands due this tick, lets the AI think and units fire, then advances
+		//    the world by TICK_SECONDS.
+		void Tick();
+
+		// Description: Snapshots the whole world into a save. Mostly bulk copies, so it's cheap enough
+		//    to call between ticks. Writing the save to disk is left to the caller.
+		// Parameters: 
+		//    SaveWriter& _save, the save to add the world's chunks to.
+		void Save(SaveWriter& _save) const;
+
+		// Description: Replaces the world with one from a save. The seed is restored too.
+		// Parameters: 
+		//    SaveReader& _save, the save to read from.
+		// Returns: true, if the save held a valid world. If not, the world must be discarded.
+		bool Load(SaveReader& _save);
+
+		// Description: Returns if the match has ended.
+		// Returns: true, if an END command has been applied.
+		bool HasEnded() const;
+
+		// Description: Returns the seed the world was created with.
+		// Returns: The seed.
+		uint64_t GetSeed() const;
+
+		// Description: Returns the number of ticks simulated so far.
+		// Returns: The current tick.
+		uint64_t GetTick() const;
+
+		// Description: Returns the units in the world.
+		// Returns: The unit data.
+		const UnitData& GetUnits() const;
+
+		// Description: Returns the number of living units, without walking them.
+		// Returns: The number of units with health remaining.
+		uint32_t GetAliveCount() const;
+
+		// Description: Returns the definitions of the units and weapons in the match.
+		// Returns: The definitions.
+		const DefinitionDatabase& GetDefinitions() const;
+
+		// Description: Returns the projectiles in flight.
+		// Returns: The projectile system.
+		const ProjectileSystem& GetProjectiles() const;
+
+		// Description: Returns the AI system, to inspect or tune it.
+		// Returns: The AI system.
+		AISystem& GetAI();
+
+		// Description: Returns the AI system.
+		// Returns: The AI system.
+		const AISystem& GetAI() const;
+	};
+}
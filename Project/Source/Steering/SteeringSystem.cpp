@@ -0,0 +1,200 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: SteeringSystem.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <math.h>
+#include "../Math/Simd.h"
+#include "SteeringSystem.h"
+
+namespace OC
+{
+	// private
+
+	void SteeringSystem::Steer(const UnitData& _units, const SpatialGrid& _grid, float _seconds, uint32_t _begin, uint32_t _end)
+	{
+		const float separationDistance = m_Settings.unitRadius * 2.0f;
+		const float maxDeltaV = m_Settings.acceleration * _seconds;
+
+		for (UnitId unit = _begin; unit < _end; ++unit)
+		{
+			const float velocityX = _units.velocityX[unit];
+			const float velocityY = _units.velocityY[unit];
+
+			if (!_units.IsAlive(unit))
+			{
+				m_NextVelocityX[unit] = 0.0f;
+				m_NextVelocityY[unit] = 0.0f;
+				continue;
+			}
+
+			const float x = _units.positionX[unit];
+			const float y = _units.positionY[unit];
+			const float speed = _units.speed[unit];
+
+			// Head for the goal, slowing down on arrival.
+			float toGoalX = _units.goalX[unit] - x;
+			float toGoalY = _units.goalY[unit] - y;
+			float goalDistance = sqrtf(toGoalX * toGoalX + toGoalY * toGoalY);
+			float desiredX = 0.0f, desiredY = 0.0f;
+
+			if (goalDistance > 0.5f)
+			{
+				float arrival = goalDistance < m_Settings.arrivalRadius ? goalDistance / m_Settings.arrivalRadius : 1.0f;
+				desiredX = toGoalX / goalDistance * speed * arrival;
+				desiredY = toGoalY / goalDistance * speed * arrival;
+			}
+
+			// Look at the neighbours that are overlapping or about to be in the way.
+			const float desiredSpeed = sqrtf(desiredX * desiredX + desiredY * desiredY);
+			const float searchRadius = separationDistance + desiredSpeed * m_Settings.lookAhead;
+			float separationX = 0.0f, separationY = 0.0f;
+			float avoidanceX = 0.0f, avoidanceY = 0.0f;
+			uint32_t neighbours = 0;
+
+			_grid.Query(x, y, searchRadius, [&](UnitId _other, float _dx, float _dy, float _distanceSq)
+			{
+				if (_other == unit)
+					return true;
+
+				// Units on the exact same spot are split apart along an axis picked from their ids.
+				if (_distanceSq == 0.0f)
+				{
+					_dx = _other > unit ? 1.0f : -1.0f;
+					_dy = (_other ^ unit) & 1 ? 0.5f : -0.5f;
+					_distanceSq = _dx * _dx + _dy * _dy;
+				}
+
+				float distance = sqrtf(_distanceSq);
+
+				// Separation: push apart, harder the more the units overlap.
+				if (distance < separationDistance)
+				{
+					float push = (1.0f - distance / separationDistance) / distance;
+					separationX -= _dx * push;
+					separationY -= _dy * push;
+				}
+
+				// Avoidance: neighbours ahead, within our path, make us sidestep to the side they aren't on.
+				if (desiredSpeed > 0.0f)
+				{
+					float ahead = (_dx * desiredX + _dy * desiredY) / desiredSpeed;
+					float side = (_dx * -desiredY + _dy * desiredX) / desiredSpeed;
+
+					if (ahead > 0.0f && fabsf(side) < separationDistance)
+					{
+						float strength = (1.0f - ahead / searchRadius) * (1.0f - fabsf(side) / separationDistance);
+						float direction = side > 0.0f ? -1.0f : 1.0f; // Dead ahead sidesteps the same way for everyone.
+						avoidanceX += -desiredY / desiredSpeed * direction * strength;
+						avoidanceY += desiredX / desiredSpeed * direction * strength;
+					}
+				}
+
+				return ++neighbours < m_Settings.maxNeighbours;
+			});
+
+			// Blend the forces into the desired velocity, capped at the unit's speed.
+			float targetX = desiredX + (separationX * m_Settings.separationWeight + avoidanceX * m_Settings.avoidanceWeight) * speed;
+			float targetY = desiredY + (separationY * m_Settings.separationWeight + avoidanceY * m_Settings.avoidanceWeight) * speed;
+			float targetSpeedSq = targetX * targetX + targetY * targetY;
+
+			if (targetSpeedSq > speed * speed)
+			{
+				float scale = speed / sqrtf(targetSpeedSq);
+				targetX *= scale;
+				targetY *= scale;
+			}
+
+			// Limit how quickly the velocity can change so groups don't jitter.
+			float changeX = targetX - velocityX;
+			float changeY = targetY - velocityY;
+			float changeSq = changeX * changeX + changeY * changeY;
+
+			if (changeSq > maxDeltaV * maxDeltaV)
+			{
+				float scale = maxDeltaV / sqrtf(changeSq);
+				changeX *= scale;
+				changeY *= scale;
+			}
+
+			m_NextVelocityX[unit] = velocityX + changeX;
+			m_NextVelocityY[unit] = velocityY + changeY;
+		}
+	}
+
+	// public
+
+	SteeringSystem::SteeringSystem(const SteeringSettings& _settings) :
+		m_Settings(),
+		m_NextVelocityX(), m_NextVelocityY()
+	{
+		SetSettings(_settings);
+	}
+
+	void SteeringSystem::Update(UnitData& _units, const SpatialGrid& _grid, float _seconds, JobSystem* _jobs)
+	{
+		using namespace Simd;
+
+		constexpr uint32_t CHUNK_SIZE = 1024; // Units per steering job.
+
+		const uint32_t count = _units.Count();
+
+		m_NextVelocityX.resize(count);
+		m_NextVelocityY.resize(count);
+
+		auto steer = [this, &_units, &_grid, _seconds](uint32_t _begin, uint32_t _end)
+		{
+			Steer(_units, _grid, _seconds, _begin, _end);
+		};
+
+		if (_jobs)
+			_jobs->ParallelFor(count, CHUNK_SIZE, steer);
+		else if (count)
+			steer(0, count);
+
+		// Every unit has been steered, so the new velocities can be published and applied.
+		_units.velocityX.swap(m_NextVelocityX);
+		_units.velocityY.swap(m_NextVelocityY);
+
+		float* x = _units.positionX.data();
+		float* y = _units.positionY.data();
+		const float* velocityX = _units.velocityX.data();
+		const float* velocityY = _units.velocityY.data();
+		const uint32_t wideCount = count - count % WIDTH;
+		const Float4 seconds = Set(_seconds);
+
+		uint32_t i = 0;
+
+		for (; i < wideCount; i += WIDTH)
+		{
+			Store(x + i, Add(Load(x + i), Mul(Load(velocityX + i), seconds)));
+			Store(y + i, Add(Load(y + i), Mul(Load(velocityY + i), seconds)));
+		}
+
+		for (; i < count; ++i)
+		{
+			x[i] += velocityX[i] * _seconds;
+			y[i] += velocityY[i] * _seconds;
+		}
+	}
+
+	const SteeringSettings& SteeringSystem::GetSettings() const
+	{
+		return m_Settings;
+	}
+
+	void SteeringSystem::SetSettings(const SteeringSettings& _settings)
+	{
+		assert(_settings.unitRadius > 0.0f); // Error: Units must take up room.
+		assert(_settings.arrivalRadius > 0.0f); // Error: Units must be able to arrive.
+		assert(_settings.maxNeighbours > 0); // Error: Units must be able to see at least one neighbour.
+
+		m_Settings = _settings;
+	}
+}
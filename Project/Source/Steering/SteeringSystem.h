@@ -0,0 +1,73 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: SteeringSystem.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Local avoidance for large groups of units. Each unit steers toward its goal while being
+		pushed apart from nearby units (separation) and sidestepping the ones blocking its way (avoidance).
+		Neighbours come from the spatial grid, so there are no per-pair checks. Every unit only reads the
+		state from the start of the tick and only writes its own velocity, which lets chunks of units
+		steer in parallel with the same result as steering them one by one.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <vector>
+#include "../Simulation/SpatialGrid.h"
+#include "../Simulation/Units.h"
+#include "../Threading/JobSystem.h"
+
+namespace OC
+{
+	struct SteeringSettings
+	{
+		float unitRadius = 6.0f; // How much room a unit takes up.
+		float separationWeight = 1.5f; // How hard units push away from overlapping neighbours.
+		float avoidanceWeight = 0.75f; // How hard units sidestep neighbours in their way.
+		float lookAhead = 0.75f; // Seconds ahead that units look for neighbours in their way.
+		float arrivalRadius = 20.0f; // Units slow down within this distance of their goal.
+		float acceleration = 400.0f; // The most a unit's velocity can change per second.
+		uint32_t maxNeighbours = 16; // The most neighbours considered per unit.
+	};
+
+	class SteeringSystem
+	{
+	private:
+		SteeringSettings m_Settings; // Tuning values.
+		std::vector<float> m_NextVelocityX, m_NextVelocityY; // Velocities being computed this update.
+
+		// Description: Computes the new velocity of a range of units.
+		// Parameters: 
+		//    const UnitData& _units, every unit in the world.
+		//    const SpatialGrid& _grid, the grid of living units.
+		//    float _seconds, the time to advance by.
+		//    uint32_t _begin, the first unit to steer.
+		//    uint32_t _end, one past the last unit to steer.
+		void Steer(const UnitData& _units, const SpatialGrid& _grid, float _seconds, uint32_t _begin, uint32_t _end);
+
+	public:
+		// Description: Constructs the steering system.
+		// Parameters: 
+		//    const SteeringSettings& _settings, tuning values.
+		explicit SteeringSystem(const SteeringSettings& _settings = SteeringSettings());
+
+		// Description: Steers every living unit, then moves it by its new velocity.
+		// Parameters: 
+		//    UnitData& _units, every unit in the world.
+		//    const SpatialGrid& _grid, the grid of living units. Must be built from _units.
+		//    float _seconds, the time to advance by.
+		//    JobSystem* _jobs, steers chunks of units in parallel if not nullptr.
+		void Update(UnitData& _units, const SpatialGrid& _grid, float _seconds, JobSystem* _jobs = nullptr);
+
+		// Description: Returns the tuning values.
+		// Returns: The settings.
+		const SteeringSettings& GetSettings() const;
+
+		// Description: Replaces the tuning values.
+		// Parameters: 
+		//    const SteeringSettings& _settings, the new settings.
+		void SetSettings(const SteeringSettings& _settings);
+	};
+}
@@ -0,0 +1,146 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: GradientNoise.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <string.h>
+#include "../Math/Simd.h"
+#include "GradientNoise.h"
+
+namespace OC
+{
+	namespace GradientNoise
+	{
+		constexpr uint32_t MIN_PERIOD = Simd::WIDTH; // The smallest cell, so a group of lanes never straddles two.
+		constexpr float DIAGONAL = 0.70710678f; // The parts of a unit diagonal.
+
+		// The gradients corners pick from. Eight directions are enough to hide the lattice.
+		static const float GRADIENT_X[8] = { 1.0f, -1.0f, 0.0f, 0.0f, DIAGONAL, -DIAGONAL, DIAGONAL, -DIAGONAL };
+		static const float GRADIENT_Y[8] = { 0.0f, 0.0f, 1.0f, -1.0f, DIAGONAL, DIAGONAL, -DIAGONAL, -DIAGONAL };
+		static const float LANE_OFFSETS[Simd::WIDTH] = { 0.0f, 1.0f, 2.0f, 3.0f }; // Each lane's tile after the first.
+
+		// Description: Picks the gradient of a lattice corner.
+		// Parameters: 
+		//    uint64_t _seed, the octave's seed.
+		//    int32_t _x, the corner's column.
+		//    int32_t _y, the corner's row.
+		// Returns: The index of the gradient.
+		static uint32_t Corner(uint64_t _seed, int32_t _x, int32_t _y)
+		{
+			uint64_t hash = _seed ^ (static_cast<uint64_t>(static_cast<uint32_t>(_x)) * 0x9E3779B97F4A7C15ULL) ^
+				(static_cast<uint64_t>(static_cast<uint32_t>(_y)) * 0xC2B2AE3D27D4EB4FULL);
+
+			// The finalizer of SplitMix64, so every bit of the corner reaches the low bits.
+			hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+			return static_cast<uint32_t>(hash ^ (hash >> 31)) & 7;
+		}
+
+		// Description: Divides, rounding toward negative infinity, to find the cell of a tile left of or
+		//    above the origin.
+		// Parameters: 
+		//    int32_t _value, the tile.
+		//    int32_t _divisor, the cell size. Greater than 0.
+		// Returns: The cell.
+		static int32_t FloorDivide(int32_t _value, int32_t _divisor)
+		{
+			return _value >= 0 ? _value / _divisor : -((-(_value + 1)) / _divisor) - 1;
+		}
+
+		// Description: Returns the smooth fade between corners, 6t^5 - 15t^4 + 10t^3, which has no kink
+		//    at cell edges.
+		// Parameters: 
+		//    Simd::Float4 _t, the positions within the cell, from 0 to 1.
+		// Returns: The weights of the far corners.
+		static Simd::Float4 Fade(Simd::Float4 _t)
+		{
+			using namespace Simd;
+			Float4 inner = Add(Mul(_t, Sub(Mul(_t, Set(6.0f)), Set(15.0f))), Set(10.0f));
+			return Mul(Mul(Mul(_t, _t), _t), inner);
+		}
+
+		void Fill(uint64_t _seed, const NoiseSettings& _settings, int32_t _x, int32_t _y, uint32_t _width, uint32_t _height, float* _out)
+		{
+			using namespace Simd;
+
+			assert(_x % static_cast<int32_t>(WIDTH) == 0 && _width % WIDTH == 0); // Error: Blocks must be whole groups of lanes.
+			assert(_settings.period >= MIN_PERIOD && (_settings.period & (_settings.period - 1)) == 0); // Error: The period must be a power of two, at least 4.
+
+			memset(_out, 0, sizeof(float) * _width * _height);
+
+			const Float4 laneOffsets = Load(LANE_OFFSETS);
+			float amplitude = 1.0f, totalAmplitude = 0.0f;
+			uint32_t period = _settings.period;
+
+			for (uint32_t octave = 0; octave < _settings.octaves && period >= MIN_PERIOD; ++octave, period /= 2, amplitude *= _settings.persistence)
+			{
+				const uint64_t seed = _seed + octave * 0xD1B54A32D192ED03ULL;
+				const int32_t size = static_cast<int32_t>(period);
+				const float scale = 1.0f / period; // Exact, as the period is a power of two.
+				const Float4 weight = Set(amplitude);
+				totalAmplitude += amplitude;
+
+				for (uint32_t row = 0; row < _height; ++row)
+				{
+					const int32_t y = _y + static_cast<int32_t>(row);
+					const int32_t cellY = FloorDivide(y, size);
+					const float fy = (y - cellY * size) * scale;
+					const Float4 fy0 = Set(fy), fy1 = Set(fy - 1.0f);
+
+					// The weight of the lower corners, the same for the whole row.
+					const Float4 v = Fade(fy0);
+					float* out = _out + static_cast<size_t>(row) * _width;
+					int32_t cellX = INT32_MIN;
+					Float4 gx00 = Set(0.0f), gy00 = gx00, gx10 = gx00, gy10 = gx00, gx01 = gx00, gy01 = gx00, gx11 = gx00, gy11 = gx00;
+
+					for (uint32_t column = 0; column < _width; column += WIDTH)
+					{
+						const int32_t x = _x + static_cast<int32_t>(column);
+
+						// Corners only change when the lanes move into the next cell.
+						if (FloorDivide(x, size) != cellX)
+						{
+							cellX = FloorDivide(x, size);
+							uint32_t g00 = Corner(seed, cellX, cellY), g10 = Corner(seed, cellX + 1, cellY);
+							uint32_t g01 = Corner(seed, cellX, cellY + 1), g11 = Corner(seed, cellX + 1, cellY + 1);
+							gx00 = Set(GRADIENT_X[g00]); gy00 = Set(GRADIENT_Y[g00]);
+							gx10 = Set(GRADIENT_X[g10]); gy10 = Set(GRADIENT_Y[g10]);
+							gx01 = Set(GRADIENT_X[g01]); gy01 = Set(GRADIENT_Y[g01]);
+							gx11 = Set(GRADIENT_X[g11]); gy11 = Set(GRADIENT_Y[g11]);
+						}
+
+						const Float4 fx0 = Mul(Add(Set(static_cast<float>(x - cellX * size)), laneOffsets), Set(scale));
+						const Float4 fx1 = Sub(fx0, Set(1.0f));
+
+						// Each corner's gradient dotted with the offset from that corner.
+						const Float4 n00 = Add(Mul(gx00, fx0), Mul(gy00, fy0));
+						const Float4 n10 = Add(Mul(gx10, fx1), Mul(gy10, fy0));
+						const Float4 n01 = Add(Mul(gx01, fx0), Mul(gy01, fy1));
+						const Float4 n11 = Add(Mul(gx11, fx1), Mul(gy11, fy1));
+
+						const Float4 u = Fade(fx0);
+						const Float4 top = Add(n00, Mul(u, Sub(n10, n00)));
+						const Float4 bottom = Add(n01, Mul(u, Sub(n11, n01)));
+						const Float4 value = Add(top, Mul(v, Sub(bottom, top)));
+
+						Store(out + column, Add(Load(out + column), Mul(value, weight)));
+					}
+				}
+			}
+
+			// Keep the range the same however many octaves there are.
+			if (totalAmplitude > 0.0f)
+			{
+				const float normalize = 1.0f / totalAmplitude;
+				for (size_t i = 0; i < static_cast<size_t>(_width) * _height; ++i)
+					_out[i] *= normalize;
+			}
+		}
+	}
+}
@@ -0,0 +1,47 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: GradientNoise.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Fractal gradient noise over the tile grid, for terrain. Each octave puts a lattice over
+		the map with a random unit gradient at every corner. A tile blends the gradients of the cell
+		around it with a smooth fade. Each octave halves the cell size and the weight of the one before.
+
+		The noise is only taken at whole tiles, and every cell size is a power of two. So a tile's cell
+		is found with integer division and its place in the cell is exact, with no floor on floating
+		point positions. Gradients come from an integer hash of the seed and corner. Every machine
+		computes the same values, whatever the number of threads or the order of chunks.
+
+		Four neighbouring tiles in a row always share a cell, so they're computed together in SIMD
+		lanes, with the corners' gradients broadcast across them.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+namespace OC
+{
+	struct NoiseSettings
+	{
+		uint32_t period = 256; // The cell size of the first octave, in tiles. A power of two, at least 4.
+		uint32_t octaves = 5; // How many octaves are summed. Those with cells below 4 tiles are skipped.
+		float persistence = 0.5f; // The weight of each octave relative to the one before.
+	};
+
+	namespace GradientNoise
+	{
+		// Description: Fills a block of tiles with noise. Values are roughly within [-0.7, 0.7].
+		// Parameters: 
+		//    uint64_t _seed, picks the gradients.
+		//    const NoiseSettings& _settings, the octaves.
+		//    int32_t _x, the leftmost tile. A multiple of 4.
+		//    int32_t _y, the topmost tile.
+		//    uint32_t _width, the width of the block, in tiles. A multiple of 4.
+		//    uint32_t _height, the height of the block, in tiles.
+		//    float* _out, receives _width * _height values, row by row.
+		void Fill(uint64_t _seed, const NoiseSettings& _settings, int32_t _x, int32_t _y, uint32_t _width, uint32_t _height, float* _out);
+	}
+}
@@ -0,0 +1,91 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: TerrainGenerator.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include "TerrainGenerator.h"
+#include "../Serialization/Hash64.h"
+
+namespace OC
+{
+	namespace TerrainGenerator
+	{
+		constexpr uint32_t TILE_COUNT = CHUNK_SIZE * CHUNK_SIZE; // Tiles per chunk.
+		constexpr uint32_t GENERATOR_VERSION = 1; // Bumped whenever the same settings would make a different world.
+
+		// Description: Continues a hash with noise settings, field by field so padding is never read.
+		// Parameters: 
+		//    const NoiseSettings& _settings, the noise.
+		//    uint64_t _hash, the hash so far.
+		// Returns: The new hash.
+		static uint64_t HashNoise(const NoiseSettings& _settings, uint64_t _hash)
+		{
+			_hash = Hash64(&_settings.period, sizeof(_settings.period), _hash);
+			_hash = Hash64(&_settings.octaves, sizeof(_settings.octaves), _hash);
+			return Hash64(&_settings.persistence, sizeof(_settings.persistence), _hash);
+		}
+
+		void Generate(const TerrainSettings& _settings, int32_t _x, int32_t _y, TerrainChunk& _outChunk)
+		{
+			const int32_t tileX = _x * static_cast<int32_t>(CHUNK_SIZE), tileY = _y * static_cast<int32_t>(CHUNK_SIZE);
+
+			_outChunk.x = _x;
+			_outChunk.y = _y;
+			_outChunk.height.resize(TILE_COUNT);
+			_outChunk.biome.resize(TILE_COUNT);
+			_outChunk.resources.resize(TILE_COUNT);
+
+			// Each field has a seed of its own, so they don't line up with each other.
+			float moisture[TILE_COUNT], resources[TILE_COUNT];
+			GradientNoise::Fill(_settings.seed, _settings.height, tileX, tileY, CHUNK_SIZE, CHUNK_SIZE, _outChunk.height.data());
+			GradientNoise::Fill(_settings.seed ^ 0x6D6F6973ULL, _settings.moisture, tileX, tileY, CHUNK_SIZE, CHUNK_SIZE, moisture);
+			GradientNoise::Fill(_settings.seed ^ 0x7265736FULL, _settings.resources, tileX, tileY, CHUNK_SIZE, CHUNK_SIZE, resources);
+
+			for (uint32_t i = 0; i < TILE_COUNT; ++i)
+			{
+				const float height = _outChunk.height[i];
+				Biome biome;
+
+				if (height < _settings.seaLevel)
+					biome = Biome::WATER;
+				else if (height < _settings.beachLevel)
+					biome = Biome::SAND;
+				else if (height > _settings.snowLevel)
+					biome = Biome::SNOW;
+				else if (height > _settings.rockLevel)
+					biome = Biome::ROCK;
+				else
+					biome = moisture[i] > _settings.forestMoisture ? Biome::FOREST : Biome::GRASS;
+
+				_outChunk.biome[i] = biome;
+
+				// Resources lie on open ground, richest at the middle of a field.
+				uint8_t amount = 0;
+				if ((biome == Biome::GRASS || biome == Biome::SAND) && resources[i] > _settings.resourceLevel)
+				{
+					float richness = (resources[i] - _settings.resourceLevel) * 1024.0f;
+					amount = static_cast<uint8_t>(richness < 1.0f ? 1.0f : richness > 255.0f ? 255.0f : richness);
+				}
+
+				_outChunk.resources[i] = amount;
+			}
+		}
+
+		uint64_t Hash(const TerrainSettings& _settings)
+		{
+			uint64_t hash = Hash64(&GENERATOR_VERSION, sizeof(GENERATOR_VERSION));
+			hash = Hash64(&_settings.seed, sizeof(_settings.seed), hash);
+			hash = HashNoise(_settings.height, hash);
+			hash = HashNoise(_settings.moisture, hash);
+			hash = HashNoise(_settings.resources, hash);
+
+			const float levels[] = { _settings.seaLevel, _settings.beachLevel, _settings.rockLevel, _settings.snowLevel, _settings.forestMoisture, _settings.resourceLevel };
+			return Hash64(levels, sizeof(levels), hash);
+		}
+	}
+}
@@ -0,0 +1,76 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: TerrainGenerator.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Generates the open world a chunk at a time from a seed. Three noise fields are laid
+		over the tiles. Height decides water, beaches, rock and snow. Moisture splits the lowlands into
+		grass and forest. A finer field gathers resources into fields on open ground.
+
+		Chunks depend only on the settings and their position, never on their neighbours or the order
+		they're made in. So they can be made on any thread, thrown away and made again, or cached.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include "GradientNoise.h"
+
+namespace OC
+{
+	enum class Biome : uint8_t
+	{
+		WATER,	// Below sea level. Can't be walked or built on.
+		SAND,	// Beaches just above the water.
+		GRASS,	// Dry lowland.
+		FOREST,	// Wet lowland.
+		ROCK,	// Mountains. Can't be built on.
+		SNOW,	// Mountain peaks. Can't be built on.
+		_COUNT
+	};
+
+	constexpr uint32_t CHUNK_SIZE = 64; // The width and height of a chunk, in tiles. A multiple of 4.
+
+	struct TerrainSettings
+	{
+		uint64_t seed = 1; // Picks the world.
+		NoiseSettings height = NoiseSettings{ 256, 5, 0.5f }; // The shape of the land.
+		NoiseSettings moisture = NoiseSettings{ 128, 3, 0.5f }; // Where forests grow.
+		NoiseSettings resources = NoiseSettings{ 32, 2, 0.5f }; // Where resources gather.
+		float seaLevel = -0.1f; // Height below which tiles are water.
+		float beachLevel = -0.06f; // Height below which land is sand.
+		float rockLevel = 0.2f; // Height above which land is rock.
+		float snowLevel = 0.28f; // Height above which land is snow.
+		float forestMoisture = 0.05f; // Moisture above which lowland is forest.
+		float resourceLevel = 0.25f; // Resource noise above which open ground holds resources.
+	};
+
+	struct TerrainChunk
+	{
+		int32_t x, y; // The position of the chunk, in chunks. Tile (x, y) * CHUNK_SIZE is its top-left.
+		std::vector<float> height; // The height of every tile, row by row, roughly within [-0.5, 0.5].
+		std::vector<Biome> biome; // The biome of every tile, row by row.
+		std::vector<uint8_t> resources; // The resources on every tile, row by row. 0 is none.
+	};
+
+	namespace TerrainGenerator
+	{
+		// Description: Generates a chunk.
+		// Parameters: 
+		//    const TerrainSettings& _settings, the world.
+		//    int32_t _x, the chunk's column.
+		//    int32_t _y, the chunk's row.
+		//    TerrainChunk& _outChunk, replaced with the chunk.
+		void Generate(const TerrainSettings& _settings, int32_t _x, int32_t _y, TerrainChunk& _outChunk);
+
+		// Description: Returns a hash of everything that shapes the world, to tell cached chunks of one
+		//    world from another's.
+		// Parameters: 
+		//    const TerrainSettings& _settings, the world.
+		// Returns: The hash.
+		uint64_t Hash(const TerrainSettings& _settings);
+	}
+}
@@ -0,0 +1,293 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: TerrainStreamer.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <filesystem>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "../Serialization/AtomicFile.h"
+#include "../Serialization/Crc32.h"
+#include "TerrainStreamer.h"
+
+namespace OC
+{
+	namespace fs = std::filesystem;
+
+	constexpr uint32_t CACHE_MAGIC = 0x4B43434F; // "OCCK" in little endian.
+	constexpr uint32_t CACHE_VERSION = 1; // Bumped whenever the layout of cached chunks changes.
+	constexpr uint32_t TILE_COUNT = CHUNK_SIZE * CHUNK_SIZE; // Tiles per chunk.
+
+	// The start of every cached chunk. The tiles follow: heights, then biomes, then resources.
+	struct CacheHeader
+	{
+		uint32_t magic; // CACHE_MAGIC.
+		uint32_t version; // CACHE_VERSION.
+		uint32_t chunkSize; // CHUNK_SIZE.
+		uint32_t crc; // The CRC-32 of the tiles.
+		uint64_t settingsHash; // TerrainGenerator::Hash of the world.
+		int32_t x, y; // The position of the chunk, in chunks.
+	};
+
+	static_assert(sizeof(CacheHeader) == 32, "Open Conquer Error: CacheHeader must not have padding.");
+
+	constexpr size_t CACHE_TILE_BYTES = TILE_COUNT * (sizeof(float) + sizeof(Biome) + sizeof(uint8_t)); // The size of the tiles in a cached chunk.
+
+	// Description: Returns the Chebyshev distance between two chunks, the number of rings apart they are.
+	// Parameters: 
+	//    int32_t _x, the first chunk's column.
+	//    int32_t _y, the first chunk's row.
+	//    int32_t _otherX, the second chunk's column.
+	//    int32_t _otherY, the second chunk's row.
+	// Returns: The distance, in chunks.
+	static uint32_t ChunkDistance(int32_t _x, int32_t _y, int32_t _otherX, int32_t _otherY)
+	{
+		int64_t distanceX = static_cast<int64_t>(_x) - _otherX, distanceY = static_cast<int64_t>(_y) - _otherY;
+		distanceX = distanceX < 0 ? -distanceX : distanceX;
+		distanceY = distanceY < 0 ? -distanceY : distanceY;
+
+		return static_cast<uint32_t>(distanceX > distanceY ? distanceX : distanceY);
+	}
+
+	// private
+
+	uint64_t TerrainStreamer::Key(int32_t _x, int32_t _y)
+	{
+		return (static_cast<uint64_t>(static_cast<uint32_t>(_x)) << 32) | static_cast<uint32_t>(_y);
+	}
+
+	std::string TerrainStreamer::CachePath(int32_t _x, int32_t _y) const
+	{
+		return m_CacheFolder + "/" + std::to_string(_x) + "_" + std::to_string(_y) + ".occhunk";
+	}
+
+	bool TerrainStreamer::ReadCache(int32_t _x, int32_t _y, TerrainChunk& _outChunk) const
+	{
+		FILE* file = fopen(CachePath(_x, _y).c_str(), "rb");
+		if (!file)
+			return false;
+
+		CacheHeader header;
+		std::vector<uint8_t> tiles(CACHE_TILE_BYTES);
+		bool read = fread(&header, sizeof(header), 1, file) == 1 && fread(tiles.data(), 1, tiles.size(), file) == tiles.size() && fgetc(file) == EOF;
+		fclose(file);
+
+		if (!read || header.magic != CACHE_MAGIC || header.version != CACHE_VERSION || header.chunkSize != CHUNK_SIZE ||
+			header.settingsHash != TerrainGenerator::Hash(m_Terrain) || header.x != _x || header.y != _y ||
+			header.crc != Crc32(tiles.data(), tiles.size()))
+			return false;
+
+		_outChunk.x = _x;
+		_outChunk.y = _y;
+		_outChunk.height.resize(TILE_COUNT);
+		_outChunk.biome.resize(TILE_COUNT);
+		_outChunk.resources.resize(TILE_COUNT);
+
+		const uint8_t* source = tiles.data();
+		memcpy(_outChunk.height.data(), source, TILE_COUNT * sizeof(float));
+		memcpy(_outChunk.biome.data(), source + TILE_COUNT * sizeof(float), TILE_COUNT * sizeof(Biome));
+		memcpy(_outChunk.resources.data(), source + TILE_COUNT * (sizeof(float) + sizeof(Biome)), TILE_COUNT);
+
+		for (Biome biome : _outChunk.biome)
+		{
+			if (biome >= Biome::_COUNT)
+				return false;
+		}
+
+		return true;
+	}
+
+	bool TerrainStreamer::WriteCache(const TerrainChunk& _chunk) const
+	{
+		std::vector<uint8_t> bytes(sizeof(CacheHeader) + CACHE_TILE_BYTES);
+		uint8_t* tiles = bytes.data() + sizeof(CacheHeader);
+		memcpy(tiles, _chunk.height.data(), TILE_COUNT * sizeof(float));
+		memcpy(tiles + TILE_COUNT * sizeof(float), _chunk.biome.data(), TILE_COUNT * sizeof(Biome));
+		memcpy(tiles + TILE_COUNT * (sizeof(float) + sizeof(Biome)), _chunk.resources.data(), TILE_COUNT);
+
+		CacheHeader header;
+		header.magic = CACHE_MAGIC;
+		header.version = CACHE_VERSION;
+		header.chunkSize = CHUNK_SIZE;
+		header.crc = Crc32(tiles, CACHE_TILE_BYTES);
+		header.settingsHash = TerrainGenerator::Hash(m_Terrain);
+		header.x = _chunk.x;
+		header.y = _chunk.y;
+		memcpy(bytes.data(), &header, sizeof(header));
+
+		return AtomicFile::Write(CachePath(_chunk.x, _chunk.y), bytes.data(), bytes.size());
+	}
+
+	void TerrainStreamer::MakeChunk(int32_t _x, int32_t _y)
+	{
+		std::unique_ptr<TerrainChunk> chunk(new TerrainChunk());
+		bool cached = !m_CacheFolder.empty() && ReadCache(_x, _y, *chunk);
+		bool cacheFailed = false;
+
+		if (!cached)
+		{
+			TerrainGenerator::Generate(m_Terrain, _x, _y, *chunk);
+			cacheFailed = !m_CacheFolder.empty() && !WriteCache(*chunk);
+		}
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Finished.push_back(std::move(chunk));
+		m_CacheHits += cached ? 1 : 0;
+		m_Generated += cached ? 0 : 1;
+		m_CacheFailures += cacheFailed ? 1 : 0;
+		--m_InFlight;
+		m_Done.notify_all();
+	}
+
+	// public
+
+	TerrainStreamer::TerrainStreamer(const TerrainSettings& _terrain, const StreamerSettings& _settings, JobSystem* _jobs) :
+		m_Terrain(_terrain),
+		m_Settings(_settings),
+		m_Jobs(_jobs),
+		m_CacheFolder(),
+		m_Chunks(),
+		m_Requested(),
+		m_Finished(),
+		m_Ready(),
+		m_Mutex(),
+		m_Done(),
+		m_InFlight(0),
+		m_Generated(0),
+		m_CacheHits(0),
+		m_CacheFailures(0)
+	{
+		assert(_settings.tileSize > 0.0f); // Error: Invalid tile size.
+		assert(_settings.keepRadius >= _settings.loadRadius); // Error: Chunks would be dropped as soon as they're ready.
+
+		// Each world gets its own folder, so changing the settings never reads another world's chunks.
+		if (!_settings.cachePath.empty())
+		{
+			char hash[17];
+			snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(TerrainGenerator::Hash(_terrain)));
+			m_CacheFolder = _settings.cachePath + "/" + hash;
+
+			std::error_code error;
+			fs::create_directories(m_CacheFolder, error);
+		}
+	}
+
+	TerrainStreamer::~TerrainStreamer()
+	{
+		Wait();
+	}
+
+	uint32_t TerrainStreamer::Update(float _x, float _y)
+	{
+		const float chunkWidth = m_Settings.tileSize * CHUNK_SIZE;
+		const int32_t centerX = static_cast<int32_t>(floorf(_x / chunkWidth)), centerY = static_cast<int32_t>(floorf(_y / chunkWidth));
+		m_Ready.clear();
+
+		// Drop the chunks left behind before anything new is picked up, so pointers to new chunks stay valid.
+		for (auto chunk = m_Chunks.begin(); chunk != m_Chunks.end();)
+		{
+			if (ChunkDistance(chunk->second->x, chunk->second->y, centerX, centerY) > m_Settings.keepRadius)
+				chunk = m_Chunks.erase(chunk);
+			else
+				++chunk;
+		}
+
+		// Queue the missing chunks ring by ring, so the ones under the camera are made first.
+		const int32_t radius = static_cast<int32_t>(m_Settings.loadRadius);
+
+		for (int32_t ring = 0; ring <= radius; ++ring)
+		{
+			for (int32_t y = centerY - ring; y <= centerY + ring; ++y)
+			{
+				// Only the edge of the ring is new. Rows in between have just their two ends.
+				const int32_t step = y == centerY - ring || y == centerY + ring || ring == 0 ? 1 : 2 * ring;
+
+				for (int32_t x = centerX - ring; x <= centerX + ring; x += step)
+				{
+					const uint64_t key = Key(x, y);
+					if (m_Chunks.count(key) || !m_Requested.insert(key).second)
+						continue;
+
+					{
+						std::lock_guard<std::mutex> lock(m_Mutex);
+						++m_InFlight;
+					}
+
+					if (m_Jobs)
+						m_Jobs->Submit([this, x, y]() { MakeChunk(x, y); });
+					else
+						MakeChunk(x, y);
+				}
+			}
+		}
+
+		// Pick up what the workers finished. Chunks the camera has since left are dropped.
+		std::vector<std::unique_ptr<TerrainChunk>> finished;
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			finished.swap(m_Finished);
+		}
+
+		for (std::unique_ptr<TerrainChunk>& chunk : finished)
+		{
+			const uint64_t key = Key(chunk->x, chunk->y);
+			m_Requested.erase(key);
+
+			if (ChunkDistance(chunk->x, chunk->y, centerX, centerY) > m_Settings.keepRadius)
+				continue;
+
+			m_Ready.push_back(chunk.get());
+			m_Chunks[key] = std::move(chunk);
+		}
+
+		return static_cast<uint32_t>(m_Ready.size());
+	}
+
+	void TerrainStreamer::Wait()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_Done.wait(lock, [this]() { return m_InFlight == 0; });
+	}
+
+	const TerrainChunk* TerrainStreamer::GetChunk(int32_t _x, int32_t _y) const
+	{
+		auto chunk = m_Chunks.find(Key(_x, _y));
+		return chunk != m_Chunks.end() ? chunk->second.get() : nullptr;
+	}
+
+	const std::vector<const TerrainChunk*>& TerrainStreamer::GetReadyChunks() const
+	{
+		return m_Ready;
+	}
+
+	void TerrainStreamer::WorldToTile(float _x, float _y, int32_t& _outX, int32_t& _outY) const
+	{
+		_outX = static_cast<int32_t>(floorf(_x / m_Settings.tileSize));
+		_outY = static_cast<int32_t>(floorf(_y / m_Settings.tileSize));
+	}
+
+	uint32_t TerrainStreamer::GetChunkCount() const
+	{
+		return static_cast<uint32_t>(m_Chunks.size());
+	}
+
+	void TerrainStreamer::GetCounts(uint32_t& _outGenerated, uint32_t& _outCacheHits, uint32_t& _outCacheFailures)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		_outGenerated = m_Generated;
+		_outCacheHits = m_CacheHits;
+		_outCacheFailures = m_CacheFailures;
+	}
+
+	const StreamerSettings& TerrainStreamer::GetSettings() const
+	{
+		return m_Settings;
+	}
+}
@@ -0,0 +1,154 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: TerrainStreamer.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Keeps the chunks of terrain around the camera ready. As the camera moves, missing chunks
+		within reach are queued on the job system, nearest first, and chunks left far behind are dropped.
+		Chunks finished by the workers are picked up on the next update, so the frame never waits on
+		generation.
+
+		With a cache folder, every generated chunk is also written to disk, and chunks are read back
+		from there when they're needed again. Files are kept per world, checked with a CRC, and written
+		to a temporary file first, so a damaged or stale file is generated again rather than used.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "../Threading/JobSystem.h"
+#include "TerrainGenerator.h"
+
+namespace OC
+{
+	struct StreamerSettings
+	{
+		std::string cachePath; // The folder chunks are cached in. Empty doesn't cache.
+		float tileSize = 16.0f; // The width and height of a tile, in world units. Tile (0, 0) starts at the origin.
+		uint32_t loadRadius = 2; // How far around the camera chunks are made ready, in chunks.
+		uint32_t keepRadius = 4; // How far around the camera chunks are kept, in chunks. At least loadRadius.
+	};
+
+	class TerrainStreamer
+	{
+	private:
+		TerrainSettings m_Terrain; // The world.
+		StreamerSettings m_Settings; // Where chunks are made ready and cached.
+		JobSystem* m_Jobs; // Makes chunks, or nullptr to make them during Update.
+		std::string m_CacheFolder; // The cache folder of this world, or empty.
+		std::unordered_map<uint64_t, std::unique_ptr<TerrainChunk>> m_Chunks; // The ready chunks, by Key.
+		std::unordered_set<uint64_t> m_Requested; // Chunks queued or being made, by Key.
+		std::vector<std::unique_ptr<TerrainChunk>> m_Finished; // Chunks made since the last update.
+		std::vector<const TerrainChunk*> m_Ready; // The chunks that became ready during the last update.
+		std::mutex m_Mutex; // Guards m_Finished, m_InFlight and the counts.
+		std::condition_variable m_Done; // Signalled when a chunk is finished.
+		uint32_t m_InFlight; // Chunks queued on the job system and not yet finished.
+		uint32_t m_Generated; // Chunks generated.
+		uint32_t m_CacheHits; // Chunks read from the cache.
+		uint32_t m_CacheFailures; // Chunks that couldn't be written to the cache.
+
+		// Description: Returns the key of a chunk in the maps.
+		// Parameters: 
+		//    int32_t _x, the chunk's column.
+		//    int32_t _y, the chunk's row.
+		// Returns: The key.
+		static uint64_t Key(int32_t _x, int32_t _y);
+
+		// Description: Returns the cache file of a chunk.
+		// Parameters: 
+		//    int32_t _x, the chunk's column.
+		//    int32_t _y, the chunk's row.
+		// Returns: The path.
+		std::string CachePath(int32_t _x, int32_t _y) const;
+
+		// Description: Reads a chunk from the cache.
+		// Parameters: 
+		//    int32_t _x, the chunk's column.
+		//    int32_t _y, the chunk's row.
+		//    TerrainChunk& _outChunk, receives the chunk.
+		// Returns: true, if the file was there and intact.
+		bool ReadCache(int32_t _x, int32_t _y, TerrainChunk& _outChunk) const;
+
+		// Description: Writes a chunk to the cache.
+		// Parameters: 
+		//    const TerrainChunk& _chunk, the chunk.
+		// Returns: true, if the file was written.
+		bool WriteCache(const TerrainChunk& _chunk) const;
+
+		// Description: Reads a chunk from the cache or generates it, then hands it to the next update.
+		//    Runs on a worker.
+		// Parameters: 
+		//    int32_t _x, the chunk's column.
+		//    int32_t _y, the chunk's row.
+		void MakeChunk(int32_t _x, int32_t _y);
+
+	public:
+		// Description: Constructs a streamer with no chunks ready.
+		// Parameters: 
+		//    const TerrainSettings& _terrain, the world.
+		//    const StreamerSettings& _settings, where chunks are made ready and cached.
+		//    JobSystem* _jobs, makes chunks in the background, or nullptr to make them during Update.
+		TerrainStreamer(const TerrainSettings& _terrain, const StreamerSettings& _settings, JobSystem* _jobs = nullptr);
+
+		// Description: TerrainStreamer's cannot be created from other TerrainStreamer's.
+		TerrainStreamer(const TerrainStreamer& _streamer) = delete;
+
+		// Description: Waits for the chunks being made.
+		~TerrainStreamer();
+
+		// Description: TerrainStreamer's cannot be assigned to other TerrainStreamer's.
+		void operator=(const TerrainStreamer& _streamer) = delete;
+
+		// Description: Picks up finished chunks, drops those out of reach and queues those coming into it.
+		// Parameters: 
+		//    float _x, the x position of the camera, in world units.
+		//    float _y, the y position of the camera, in world units.
+		// Returns: The number of chunks that became ready.
+		uint32_t Update(float _x, float _y);
+
+		// Description: Waits until every queued chunk is finished. They're picked up by the next Update.
+		void Wait();
+
+		// Description: Returns a chunk, if it's ready.
+		// Parameters: 
+		//    int32_t _x, the chunk's column.
+		//    int32_t _y, the chunk's row.
+		// Returns: The chunk, or nullptr. Valid until the next Update.
+		const TerrainChunk* GetChunk(int32_t _x, int32_t _y) const;
+
+		// Description: Returns the chunks that became ready during the last update.
+		// Returns: The chunks. Valid until the next Update.
+		const std::vector<const TerrainChunk*>& GetReadyChunks() const;
+
+		// Description: Returns the tile under a world position.
+		// Parameters: 
+		//    float _x, the x position.
+		//    float _y, the y position.
+		//    int32_t& _outX, receives the tile's column.
+		//    int32_t& _outY, receives the tile's row.
+		void WorldToTile(float _x, float _y, int32_t& _outX, int32_t& _outY) const;
+
+		// Description: Returns the number of ready chunks.
+		// Returns: The number of chunks.
+		uint32_t GetChunkCount() const;
+
+		// Description: Returns how many chunks were generated, read from the cache and couldn't be cached.
+		// Parameters: 
+		//    uint32_t& _outGenerated, receives the chunks generated.
+		//    uint32_t& _outCacheHits, receives the chunks read from the cache.
+		//    uint32_t& _outCacheFailures, receives the chunks that couldn't be written to the cache.
+		void GetCounts(uint32_t& _outGenerated, uint32_t& _outCacheHits, uint32_t& _outCacheFailures);
+
+		// Description: Returns where chunks are made ready and cached.
+		// Returns: The settings.
+		const StreamerSettings& GetSettings() const;
+	};
+}
@@ -0,0 +1,155 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: JobSystem.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <assert.h>
+#include <atomic>
+#include <memory>
+#include "JobSystem.h"
+
+namespace OC
+{
+	// private
+
+	void JobSystem::WorkerLoop()
+	{
+		while (true)
+		{
+			std::function<void()> job;
+
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_JobAvailable.wait(lock, [this] { return m_Stopping || !m_Jobs.empty(); });
+
+				if (m_Jobs.empty())
+					return; // Stopping, and nothing left to do.
+
+				job = std::move(m_Jobs.front());
+				m_Jobs.pop_front();
+			}
+
+			job();
+		}
+	}
+
+	// public
+
+	JobSystem::JobSystem(unsigned int _workerCount) :
+		m_Workers(),
+		m_Jobs(),
+		m_Mutex(),
+		m_JobAvailable(),
+		m_Stopping(false)
+	{
+		if (_workerCount == 0)
+		{
+			unsigned int hardwareThreads = std::thread::hardware_concurrency();
+			_workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+		}
+
+		m_Workers.reserve(_workerCount);
+
+		for (unsigned int i = 0; i < _workerCount; ++i)
+			m_Workers.emplace_back(&JobSystem::WorkerLoop, this);
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Stopping = true;
+		}
+
+		m_JobAvailable.notify_all();
+
+		for (std::thread& worker : m_Workers)
+			worker.join();
+	}
+
+	void JobSystem::Submit(std::function<void()> _job)
+	{
+		if (m_Workers.empty())
+		{
+			_job();
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			assert(!m_Stopping); // Error: Jobs can't be submitted while the job system is shutting down.
+			m_Jobs.push_back(std::move(_job));
+		}
+
+		m_JobAvailable.notify_one();
+	}
+
+	void JobSystem::ParallelFor(uint32_t _count, uint32_t _chunkSize, const std::function<void(uint32_t, uint32_t)>& _function)
+	{
+		assert(_chunkSize > 0); // Error: Chunks must contain at least one element.
+
+		const uint32_t chunkCount = (_count + _chunkSize - 1) / _chunkSize;
+
+		// Not worth waking anyone up for a single chunk.
+		if (chunkCount <= 1 || m_Workers.empty())
+		{
+			if (_count)
+				_function(0, _count);
+			return;
+		}
+
+		// Shared with the helpers, which may still be starting up after the last chunk has finished.
+		struct State
+		{
+			std::atomic<uint32_t> nextChunk;
+			std::atomic<uint32_t> finishedChunks;
+			std::mutex mutex;
+			std::condition_variable done;
+		};
+
+		std::shared_ptr<State> state = std::make_shared<State>();
+		state->nextChunk = 0;
+		state->finishedChunks = 0;
+
+		// Claims and runs chunks until none remain.
+		const std::function<void(uint32_t, uint32_t)>* function = &_function;
+		auto work = [state, function, chunkCount, _count, _chunkSize]()
+		{
+			uint32_t chunk;
+
+			while ((chunk = state->nextChunk.fetch_add(1)) < chunkCount)
+			{
+				uint32_t begin = chunk * _chunkSize;
+				(*function)(begin, std::min(begin + _chunkSize, _count));
+
+				if (state->finishedChunks.fetch_add(1) + 1 == chunkCount)
+				{
+					std::lock_guard<std::mutex> lock(state->mutex);
+					state->done.notify_all();
+				}
+			}
+		};
+
+		// The calling thread takes a share of the chunks too.
+		const uint32_t helperCount = std::min(static_cast<uint32_t>(m_Workers.size()), chunkCount - 1);
+
+		for (uint32_t i = 0; i < helperCount; ++i)
+			Submit(work);
+
+		work();
+
+		std::unique_lock<std::mutex> lock(state->mutex);
+		state->done.wait(lock, [&state, chunkCount] { return state->finishedChunks.load() == chunkCount; });
+	}
+
+	unsigned int JobSystem::GetWorkerCount() const
+	{
+		return static_cast<unsigned int>(m_Workers.size());
+	}
+}
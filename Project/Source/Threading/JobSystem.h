@@ -0,0 +1,70 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: JobSystem.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: A pool of worker threads that runs jobs. ParallelFor splits a range into chunks that
+		the workers and the calling thread claim until none remain. Because the caller helps, it is safe
+		to call ParallelFor from inside a job.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+namespace OC
+{
+	class JobSystem
+	{
+	private:
+		std::vector<std::thread> m_Workers; // The worker threads.
+		std::deque<std::function<void()>> m_Jobs; // Jobs waiting for a worker.
+		std::mutex m_Mutex; // Guards m_Jobs and m_Stopping.
+		std::condition_variable m_JobAvailable; // Wakes workers when a job is submitted.
+		bool m_Stopping; // Tells workers to exit once the queue is empty.
+
+		// Description: Runs jobs until the job system is destroyed.
+		void WorkerLoop();
+
+	public:
+		// Description: Constructs the job system and starts its workers.
+		// Parameters: 
+		//    unsigned int _workerCount, the number of worker threads. 0 uses one less than the number
+		//        of hardware threads, leaving room for the calling thread.
+		explicit JobSystem(unsigned int _workerCount = 0);
+
+		// Description: JobSystem's cannot be created from other JobSystem's.
+		JobSystem(const JobSystem& _jobSystem) = delete;
+
+		// Description: Finishes the queued jobs and stops the workers.
+		~JobSystem();
+
+		// Description: JobSystem's cannot be assigned to other JobSystem's.
+		void operator=(const JobSystem& _jobSystem) = delete;
+
+		// Description: Queues a job to run on a worker. Runs it immediately if there are no workers.
+		// Parameters: 
+		//    std::function<void()> _job, the job to run.
+		void Submit(std::function<void()> _job);
+
+		// Description: Calls a function over [0, _count) in chunks, in parallel, and waits for every
+		//    chunk to finish. Chunks may run in any order, on any thread.
+		// Parameters: 
+		//    uint32_t _count, the size of the range.
+		//    uint32_t _chunkSize, the number of elements per chunk. Must be greater than zero.
+		//    const std::function<void(uint32_t, uint32_t)>& _function, called with [begin, end) of a chunk.
+		void ParallelFor(uint32_t _count, uint32_t _chunkSize, const std::function<void(uint32_t, uint32_t)>& _function);
+
+		// Description: Returns the number of worker threads.
+		// Returns: The number of workers. The calling thread is not included.
+		unsigned int GetWorkerCount() const;
+	};
+}
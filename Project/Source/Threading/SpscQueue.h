@@ -0,0 +1,98 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: SpscQueue.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: A fixed-size, lock-free queue between exactly one producer thread and one consumer
+		thread. Neither side ever blocks or allocates: a push to a full queue fails and the caller
+		decides what to drop.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <assert.h>
+#include <atomic>
+#include <stdint.h>
+#include <vector>
+
+namespace OC
+{
+	template<typename T>
+	class SpscQueue
+	{
+	private:
+		static constexpr size_t CACHE_LINE = 64; // Keeps the two indices from sharing a cache line.
+
+		std::vector<T> m_Items; // The ring. Its size is a power of two.
+		uint32_t m_Mask; // The ring size minus one.
+		alignas(CACHE_LINE) std::atomic<uint32_t> m_Head; // The next item to pop. Written by the consumer.
+		alignas(CACHE_LINE) std::atomic<uint32_t> m_Tail; // The next slot to push to. Written by the producer.
+
+	public:
+		// Description: Constructs an empty queue.
+		// Parameters: 
+		//    uint32_t _capacity, the most items the queue holds. Rounded up to a power of two.
+		explicit SpscQueue(uint32_t _capacity) :
+			m_Items(),
+			m_Mask(0),
+			m_Head(0),
+			m_Tail(0)
+		{
+			assert(_capacity > 0 && _capacity <= (1u << 31)); // Error: Invalid capacity.
+
+			uint32_t size = 1;
+			while (size < _capacity)
+				size <<= 1;
+
+			m_Items.resize(size);
+			m_Mask = size - 1;
+		}
+
+		// Description: SpscQueue's cannot be created from other SpscQueue's.
+		SpscQueue(const SpscQueue& _queue) = delete;
+
+		// Description: SpscQueue's cannot be assigned to other SpscQueue's.
+		void operator=(const SpscQueue& _queue) = delete;
+
+		// Description: Adds an item. Producer thread only.
+		// Parameters: 
+		//    const T& _item, the item to add.
+		// Returns: false, if the queue is full.
+		bool Push(const T& _item)
+		{
+			uint32_t tail = m_Tail.load(std::memory_order_relaxed);
+
+			if (tail - m_Head.load(std::memory_order_acquire) > m_Mask)
+				return false;
+
+			m_Items[tail & m_Mask] = _item;
+			m_Tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		// Description: Removes the oldest item. Consumer thread only.
+		// Parameters: 
+		//    T& _outItem, receives the item.
+		// Returns: false, if the queue is empty.
+		bool Pop(T& _outItem)
+		{
+			uint32_t head = m_Head.load(std::memory_order_relaxed);
+
+			if (head == m_Tail.load(std::memory_order_acquire))
+				return false;
+
+			_outItem = m_Items[head & m_Mask];
+			m_Head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		// Description: Returns if the queue is empty. Only a hint while the other thread is running.
+		// Returns: true, if empty.
+		bool IsEmpty() const
+		{
+			return m_Head.load(std::memory_order_acquire) == m_Tail.load(std::memory_order_acquire);
+		}
+	};
+}
@@ -0,0 +1,38 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: BitmapFont.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: The built-in font: printable ASCII drawn on an 8x8 grid (public domain font8x8). Glyphs
+		are rasterized at any pixel size by averaging the grid over each output pixel, which keeps small
+		and odd sizes readable. The font is monospaced; characters it lacks are drawn as '?'.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+namespace OC
+{
+	// Description: Rasterizes a glyph of the built-in font into a square of coverage values.
+	// Parameters: 
+	//    uint32_t _codepoint, the character.
+	//    uint32_t _pixelSize, the width and height of the glyph, in pixels.
+	//    std::vector<uint8_t>& _outCoverage, replaced with _pixelSize rows of _pixelSize values from 0 to 255.
+	void RasterizeGlyph(uint32_t _codepoint, uint32_t _pixelSize, std::vector<uint8_t>& _outCoverage);
+
+	// Description: Returns how far the pen moves after a glyph of the built-in font.
+	// Parameters: 
+	//    uint32_t _pixelSize, the size of the font, in pixels.
+	// Returns: The advance, in pixels. The same for every character.
+	float GetGlyphAdvance(uint32_t _pixelSize);
+
+	// Description: Returns the distance between lines of the built-in font.
+	// Parameters: 
+	//    uint32_t _pixelSize, the size of the font, in pixels.
+	// Returns: The line height, in pixels.
+	float GetLineHeight(uint32_t _pixelSize);
+}
@@ -0,0 +1,321 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: GlyphAtlas.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include <string.h>
+#include "GlyphAtlas.h"
+#include "BitmapFont.h"
+
+namespace OC
+{
+	constexpr uint32_t SOLID_CELL = UINT32_MAX; // The cell of the solid block, which is never evicted.
+	constexpr uint32_t NO_CELL = UINT32_MAX; // Returned when no cell could be allocated.
+
+	// private
+
+	uint32_t GlyphAtlas::AllocateCell(uint32_t _cellSize)
+	{
+		uint32_t shelfCount = static_cast<uint32_t>(m_Shelves.size());
+
+		// A shelf of the right size with room.
+		for (uint32_t shelf = 0; shelf < shelfCount; ++shelf)
+		{
+			Shelf& candidate = m_Shelves[shelf];
+
+			if (candidate.cellSize == _cellSize && !candidate.freeCells.empty())
+			{
+				uint32_t index = candidate.freeCells.back();
+				candidate.freeCells.pop_back();
+				return shelf * m_CellsPerShelf + index;
+			}
+		}
+
+		// A shelf nothing uses yet.
+		for (uint32_t shelf = 0; shelf < shelfCount; ++shelf)
+		{
+			if (m_Shelves[shelf].cellSize == 0)
+			{
+				AssignShelf(shelf, _cellSize);
+				uint32_t index = m_Shelves[shelf].freeCells.back();
+				m_Shelves[shelf].freeCells.pop_back();
+				return shelf * m_CellsPerShelf + index;
+			}
+		}
+
+		// The atlas is full. Evict whatever was used longest ago: a glyph of the right size, or a whole
+		// shelf of another size, judged by its most recently used glyph. Anything used this frame is
+		// never older than m_Frame, so it is never picked.
+		uint64_t oldest = m_Frame;
+		uint32_t victimCell = NO_CELL;
+		uint32_t victimShelf = NO_CELL;
+
+		for (uint32_t shelf = 0; shelf < shelfCount; ++shelf)
+		{
+			const Shelf& candidate = m_Shelves[shelf];
+			uint32_t cellCount = candidate.columns * (m_ShelfHeight / candidate.cellSize);
+			const Cell* cells = &m_Cells[shelf * m_CellsPerShelf];
+
+			if (candidate.cellSize == _cellSize)
+			{
+				for (uint32_t index = 0; index < cellCount; ++index)
+				{
+					if (cells[index].lastUsed < oldest)
+					{
+						oldest = cells[index].lastUsed;
+						victimCell = shelf * m_CellsPerShelf + index;
+						victimShelf = NO_CELL;
+					}
+				}
+			}
+			else
+			{
+				uint64_t newest = 0;
+				for (uint32_t index = 0; index < cellCount; ++index)
+					if (cells[index].occupied && cells[index].lastUsed > newest)
+						newest = cells[index].lastUsed;
+
+				if (newest < oldest)
+				{
+					oldest = newest;
+					victimShelf = shelf;
+					victimCell = NO_CELL;
+				}
+			}
+		}
+
+		if (victimCell != NO_CELL)
+		{
+			Evict(victimCell);
+			return victimCell;
+		}
+
+		if (victimShelf != NO_CELL)
+		{
+			AssignShelf(victimShelf, _cellSize);
+			uint32_t index = m_Shelves[victimShelf].freeCells.back();
+			m_Shelves[victimShelf].freeCells.pop_back();
+			return victimShelf * m_CellsPerShelf + index;
+		}
+
+		return NO_CELL;
+	}
+
+	void GlyphAtlas::Evict(uint32_t _cell)
+	{
+		Cell& cell = m_Cells[_cell];
+
+		if (!cell.occupied)
+			return;
+
+		m_Lookup.erase(cell.key);
+		cell.occupied = false;
+		cell.lastUsed = 0;
+		++cell.generation;
+		++m_Evictions;
+	}
+
+	void GlyphAtlas::AssignShelf(uint32_t _shelf, uint32_t _cellSize)
+	{
+		for (uint32_t index = 0; index < m_CellsPerShelf; ++index)
+			Evict(_shelf * m_CellsPerShelf + index);
+
+		Shelf& shelf = m_Shelves[_shelf];
+		shelf.cellSize = _cellSize;
+		shelf.columns = m_Width / _cellSize;
+
+		// Filled in reverse so cells are handed out from the top-left.
+		uint32_t cellCount = shelf.columns * (m_ShelfHeight / _cellSize);
+		shelf.freeCells.clear();
+		for (uint32_t index = cellCount; index > 0; --index)
+			shelf.freeCells.push_back(index - 1);
+	}
+
+	void GlyphAtlas::CellPosition(uint32_t _cell, uint32_t& _outX, uint32_t& _outY) const
+	{
+		const Shelf& shelf = m_Shelves[_cell / m_CellsPerShelf];
+		uint32_t index = _cell % m_CellsPerShelf;
+		_outX = (index % shelf.columns) * shelf.cellSize;
+		_outY = shelf.y + (index / shelf.columns) * shelf.cellSize;
+	}
+
+	void GlyphAtlas::MarkDirty(uint32_t _x, uint32_t _y, uint32_t _width, uint32_t _height)
+	{
+		if (_x < m_DirtyMinX)
+			m_DirtyMinX = _x;
+		if (_y < m_DirtyMinY)
+			m_DirtyMinY = _y;
+		if (_x + _width > m_DirtyMaxX)
+			m_DirtyMaxX = _x + _width;
+		if (_y + _height > m_DirtyMaxY)
+			m_DirtyMaxY = _y + _height;
+	}
+
+	// public
+
+	GlyphAtlas::GlyphAtlas(uint32_t _width, uint32_t _height, uint32_t _maxGlyphSize) :
+		m_Width(_width),
+		m_Height(_height),
+		m_ShelfHeight(MIN_CELL_SIZE),
+		m_CellsPerShelf(0),
+		m_Pixels(static_cast<size_t>(_width) * _height, 0),
+		m_Shelves(),
+		m_Cells(),
+		m_Lookup(),
+		m_Coverage(),
+		m_Frame(1),
+		m_DirtyMinX(0),
+		m_DirtyMinY(0),
+		m_DirtyMaxX(_width),
+		m_DirtyMaxY(_height),
+		m_Hits(0),
+		m_Misses(0),
+		m_Evictions(0)
+	{
+		// Glyphs get a pixel of empty space to their right and bottom, so filtering never bleeds
+		// neighbours into each other.
+		while (m_ShelfHeight < _maxGlyphSize + 1)
+			m_ShelfHeight <<= 1;
+
+		assert(_width >= m_ShelfHeight && _height >= SOLID_SIZE + m_ShelfHeight); // Error: The atlas is too small for its largest glyph.
+
+		// The solid block takes a strip along the top. The shelves fill the rest.
+		for (uint32_t y = 0; y < SOLID_SIZE; ++y)
+			memset(&m_Pixels[y * m_Width], 0xFF, SOLID_SIZE);
+
+		uint32_t shelfCount = (_height - SOLID_SIZE) / m_ShelfHeight;
+		m_CellsPerShelf = (_width / MIN_CELL_SIZE) * (m_ShelfHeight / MIN_CELL_SIZE);
+		m_Shelves.resize(shelfCount);
+		m_Cells.resize(static_cast<size_t>(shelfCount) * m_CellsPerShelf, Cell{ 0, 0, 0, false });
+
+		for (uint32_t shelf = 0; shelf < shelfCount; ++shelf)
+		{
+			m_Shelves[shelf].y = SOLID_SIZE + shelf * m_ShelfHeight;
+			m_Shelves[shelf].cellSize = 0;
+			m_Shelves[shelf].columns = 0;
+		}
+	}
+
+	void GlyphAtlas::BeginFrame()
+	{
+		++m_Frame;
+	}
+
+	bool GlyphAtlas::Find(uint32_t _codepoint, uint32_t _pixelSize, AtlasGlyph& _outGlyph)
+	{
+		assert(_pixelSize > 0); // Error: Glyphs must be at least one pixel.
+
+		uint64_t key = MakeKey(_codepoint, _pixelSize);
+		uint32_t cell;
+
+		auto found = m_Lookup.find(key);
+		if (found != m_Lookup.end())
+		{
+			cell = found->second;
+			++m_Hits;
+		}
+		else
+		{
+			uint32_t cellSize = MIN_CELL_SIZE;
+			while (cellSize < _pixelSize + 1)
+				cellSize <<= 1;
+
+			if (cellSize > m_ShelfHeight)
+				return false;
+
+			cell = AllocateCell(cellSize);
+			if (cell == NO_CELL)
+				return false;
+
+			// Clear the whole cell, since a smaller glyph leaves part of it uncovered.
+			uint32_t x, y;
+			CellPosition(cell, x, y);
+			RasterizeGlyph(_codepoint, _pixelSize, m_Coverage);
+
+			for (uint32_t row = 0; row < cellSize; ++row)
+			{
+				uint8_t* destination = &m_Pixels[(y + row) * m_Width + x];
+				memset(destination, 0, cellSize);
+				if (row < _pixelSize)
+					memcpy(destination, &m_Coverage[row * _pixelSize], _pixelSize);
+			}
+
+			MarkDirty(x, y, cellSize, cellSize);
+
+			m_Cells[cell].key = key;
+			m_Cells[cell].occupied = true;
+			m_Lookup.emplace(key, cell);
+			++m_Misses;
+		}
+
+		m_Cells[cell].lastUsed = m_Frame;
+
+		uint32_t x, y;
+		CellPosition(cell, x, y);
+		_outGlyph.u0 = static_cast<uint16_t>(x);
+		_outGlyph.v0 = static_cast<uint16_t>(y);
+		_outGlyph.u1 = static_cast<uint16_t>(x + _pixelSize);
+		_outGlyph.v1 = static_cast<uint16_t>(y + _pixelSize);
+		_outGlyph.cell = cell;
+		_outGlyph.generation = m_Cells[cell].generation;
+		return true;
+	}
+
+	bool GlyphAtlas::Touch(const AtlasGlyph& _glyph)
+	{
+		if (_glyph.cell == SOLID_CELL)
+			return true;
+
+		Cell& cell = m_Cells[_glyph.cell];
+
+		if (cell.generation != _glyph.generation)
+			return false;
+
+		cell.lastUsed = m_Frame;
+		return true;
+	}
+
+	AtlasGlyph GlyphAtlas::GetSolid() const
+	{
+		return AtlasGlyph{ 1, 1, SOLID_SIZE - 1, SOLID_SIZE - 1, SOLID_CELL, 0 };
+	}
+
+	UiAtlasImage GlyphAtlas::TakeImage()
+	{
+		UiAtlasImage image;
+		image.pixels = m_Pixels.data();
+		image.width = m_Width;
+		image.height = m_Height;
+		image.dirtyMinX = m_DirtyMinX;
+		image.dirtyMinY = m_DirtyMinY;
+		image.dirtyMaxX = m_DirtyMaxX;
+		image.dirtyMaxY = m_DirtyMaxY;
+
+		m_DirtyMinX = m_Width;
+		m_DirtyMinY = m_Height;
+		m_DirtyMaxX = 0;
+		m_DirtyMaxY = 0;
+		return image;
+	}
+
+	uint64_t GlyphAtlas::GetHitCount() const
+	{
+		return m_Hits;
+	}
+
+	uint64_t GlyphAtlas::GetMissCount() const
+	{
+		return m_Misses;
+	}
+
+	uint64_t GlyphAtlas::GetEvictionCount() const
+	{
+		return m_Evictions;
+	}
+}
@@ -0,0 +1,164 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: GlyphAtlas.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: A cache of rasterized glyphs packed into one single-channel texture. The atlas is cut
+		into shelves, strips as tall as the largest glyph, and each shelf into square cells of one size,
+		so glyphs of any size can share the atlas without fragmenting it. When it is full, the glyph or
+		shelf used longest ago is evicted. Glyphs used in the current frame are never evicted, so quads
+		already built this frame stay valid. A 4x4 block of solid coverage in the corner draws plain
+		rectangles with the same quads as text.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+#include "../Renderer/UiQuad.h"
+
+namespace OC
+{
+	// Where a glyph is in the atlas. Only valid while Touch returns true for it.
+	struct AtlasGlyph
+	{
+		uint16_t u0, v0; // The top-left of the glyph, in atlas pixels.
+		uint16_t u1, v1; // One past the bottom-right of the glyph, in atlas pixels.
+		uint32_t cell; // The cell the glyph is in.
+		uint32_t generation; // The cell's generation when the glyph was looked up.
+	};
+
+	class GlyphAtlas
+	{
+	private:
+		static constexpr uint32_t MIN_CELL_SIZE = 8; // The smallest cell. Cell sizes are powers of two.
+		static constexpr uint32_t SOLID_SIZE = 4; // The width and height of the solid block.
+
+		struct Cell
+		{
+			uint64_t key; // The glyph in the cell, if occupied.
+			uint64_t lastUsed; // The frame the glyph was last used in.
+			uint32_t generation; // Bumped whenever the cell's glyph is evicted.
+			bool occupied; // If the cell holds a glyph.
+		};
+
+		struct Shelf
+		{
+			uint32_t y; // The top of the shelf, in atlas pixels.
+			uint32_t cellSize; // The width and height of the shelf's cells. 0 while the shelf is unused.
+			uint32_t columns; // Cells per row of the shelf.
+			std::vector<uint32_t> freeCells; // Cells of the shelf ready for a glyph, by index within the shelf.
+		};
+
+		uint32_t m_Width, m_Height; // The size of the atlas, in pixels.
+		uint32_t m_ShelfHeight; // The height of every shelf, and the largest cell.
+		uint32_t m_CellsPerShelf; // The most cells a shelf holds, when cut into the smallest cells.
+		std::vector<uint8_t> m_Pixels; // Coverage from 0 to 255, row by row.
+		std::vector<Shelf> m_Shelves; // Every shelf, top to bottom.
+		std::vector<Cell> m_Cells; // m_CellsPerShelf cells for every shelf, shelf by shelf.
+		std::unordered_map<uint64_t, uint32_t> m_Lookup; // The cell each cached glyph is in.
+		std::vector<uint8_t> m_Coverage; // Scratch for rasterizing.
+		uint64_t m_Frame; // The current frame. Glyphs used in it are never evicted.
+		uint32_t m_DirtyMinX, m_DirtyMinY, m_DirtyMaxX, m_DirtyMaxY; // The region changed since the last TakeImage.
+		uint64_t m_Hits; // Lookups that found their glyph cached.
+		uint64_t m_Misses; // Lookups that rasterized their glyph.
+		uint64_t m_Evictions; // Glyphs evicted to make room.
+
+		// Description: Makes a lookup key for a glyph.
+		// Parameters: 
+		//    uint32_t _codepoint, the character.
+		//    uint32_t _pixelSize, the size of the glyph, in pixels.
+		// Returns: The key.
+		static uint64_t MakeKey(uint32_t _codepoint, uint32_t _pixelSize)
+		{
+			return (static_cast<uint64_t>(_pixelSize) << 32) | _codepoint;
+		}
+
+		// Description: Finds a cell of a given size for a new glyph, evicting if the atlas is full.
+		// Parameters: 
+		//    uint32_t _cellSize, the size of cell needed.
+		// Returns: The cell, or UINT32_MAX if every cell that could be evicted was used this frame.
+		uint32_t AllocateCell(uint32_t _cellSize);
+
+		// Description: Evicts a cell's glyph, if it has one.
+		// Parameters: 
+		//    uint32_t _cell, the cell.
+		void Evict(uint32_t _cell);
+
+		// Description: Cuts a shelf into cells of a new size, evicting everything in it.
+		// Parameters: 
+		//    uint32_t _shelf, the shelf.
+		//    uint32_t _cellSize, the new cell size.
+		void AssignShelf(uint32_t _shelf, uint32_t _cellSize);
+
+		// Description: Returns the top-left corner of a cell.
+		// Parameters: 
+		//    uint32_t _cell, the cell.
+		//    uint32_t& _outX, receives the x position, in atlas pixels.
+		//    uint32_t& _outY, receives the y position, in atlas pixels.
+		void CellPosition(uint32_t _cell, uint32_t& _outX, uint32_t& _outY) const;
+
+		// Description: Grows the dirty region to include a rectangle.
+		// Parameters: 
+		//    uint32_t _x, the left of the rectangle.
+		//    uint32_t _y, the top of the rectangle.
+		//    uint32_t _width, the width of the rectangle.
+		//    uint32_t _height, the height of the rectangle.
+		void MarkDirty(uint32_t _x, uint32_t _y, uint32_t _width, uint32_t _height);
+
+	public:
+		// Description: Constructs an empty atlas.
+		// Parameters: 
+		//    uint32_t _width, the width of the atlas, in pixels.
+		//    uint32_t _height, the height of the atlas, in pixels.
+		//    uint32_t _maxGlyphSize, the largest glyph the atlas holds, in pixels. Sets the shelf height.
+		GlyphAtlas(uint32_t _width = 1024, uint32_t _height = 1024, uint32_t _maxGlyphSize = 63);
+
+		// Description: GlyphAtlas's cannot be created from other GlyphAtlas's.
+		GlyphAtlas(const GlyphAtlas& _atlas) = delete;
+
+		// Description: GlyphAtlas's cannot be assigned to other GlyphAtlas's.
+		void operator=(const GlyphAtlas& _atlas) = delete;
+
+		// Description: Starts a new frame. Glyphs not used since the last frame may now be evicted.
+		void BeginFrame();
+
+		// Description: Finds a glyph, rasterizing it into the atlas if it isn't cached, and marks it used.
+		// Parameters: 
+		//    uint32_t _codepoint, the character.
+		//    uint32_t _pixelSize, the size of the glyph, in pixels.
+		//    AtlasGlyph& _outGlyph, receives where the glyph is.
+		// Returns: false, if the glyph is too large or the atlas is full of glyphs used this frame.
+		bool Find(uint32_t _codepoint, uint32_t _pixelSize, AtlasGlyph& _outGlyph);
+
+		// Description: Marks a glyph found earlier as used this frame, if it is still cached.
+		// Parameters: 
+		//    const AtlasGlyph& _glyph, the glyph.
+		// Returns: false, if the glyph was evicted and must be found again.
+		bool Touch(const AtlasGlyph& _glyph);
+
+		// Description: Returns the rectangle of solid coverage for drawing plain rectangles.
+		// Returns: The solid block, inset so sampling never reaches its edges.
+		AtlasGlyph GetSolid() const;
+
+		// Description: Returns the atlas along with the region that changed since the last call, then
+		//    forgets the changes. The pixels stay valid until the next Find.
+		// Returns: The atlas image.
+		UiAtlasImage TakeImage();
+
+		// Description: Returns the number of lookups that found their glyph cached.
+		// Returns: The number of hits.
+		uint64_t GetHitCount() const;
+
+		// Description: Returns the number of lookups that rasterized their glyph.
+		// Returns: The number of misses.
+		uint64_t GetMissCount() const;
+
+		// Description: Returns the number of glyphs evicted to make room.
+		// Returns: The number of evictions.
+		uint64_t GetEvictionCount() const;
+	};
+}
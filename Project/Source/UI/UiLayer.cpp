@@ -0,0 +1,347 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: UiLayer.cpp
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Note: See header for more documentation.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#include <assert.h>
+#include "UiLayer.h"
+#include "BitmapFont.h"
+
+namespace OC
+{
+	constexpr uint32_t REPLACEMENT_CHARACTER = 0xFFFD; // Stands in for characters outside ASCII.
+
+	// private
+
+	WidgetId UiLayer::Allocate()
+	{
+		WidgetId id;
+
+		if (!m_FreeWidgets.empty())
+		{
+			id = m_FreeWidgets.back();
+			m_FreeWidgets.pop_back();
+		}
+		else
+		{
+			id = static_cast<WidgetId>(m_Widgets.size());
+			m_Widgets.emplace_back();
+		}
+
+		Widget& widget = m_Widgets[id];
+		widget.alive = true;
+		widget.visible = true;
+		widget.text = false;
+		widget.layoutDirty = false;
+		widget.quadsDirty = true;
+		widget.x = widget.y = 0.0f;
+		widget.width = widget.height = 0.0f;
+		widget.wrapWidth = 0.0f;
+		widget.pixelSize = 0;
+		widget.color = 0;
+		widget.string.clear();
+		widget.layout.clear();
+		widget.quads.clear();
+		widget.glyphs.clear();
+		return id;
+	}
+
+	void UiLayer::Layout(Widget& _widget)
+	{
+		const float advance = GetGlyphAdvance(_widget.pixelSize);
+		const float lineHeight = GetLineHeight(_widget.pixelSize);
+		const std::string& text = _widget.string;
+		const size_t length = text.size();
+
+		_widget.layout.clear();
+		float penX = 0.0f, penY = 0.0f;
+		float widest = 0.0f;
+		size_t i = 0;
+
+		while (i < length)
+		{
+			char character = text[i];
+
+			if (character == '\n')
+			{
+				penX = 0.0f;
+				penY += lineHeight;
+				++i;
+				continue;
+			}
+
+			if (character == ' ')
+			{
+				penX += advance;
+				++i;
+				continue;
+			}
+
+			// Measure the word, counting each UTF-8 sequence as one character.
+			size_t end = i;
+			uint32_t characters = 0;
+			while (end < length && text[end] != ' ' && text[end] != '\n')
+			{
+				if ((static_cast<uint8_t>(text[end]) & 0xC0) != 0x80)
+					++characters;
+				++end;
+			}
+
+			// Words that don't fit move to the next line, unless they start it.
+			if (_widget.wrapWidth > 0.0f && penX > 0.0f && penX + characters * advance > _widget.wrapWidth)
+			{
+				penX = 0.0f;
+				penY += lineHeight;
+			}
+
+			for (; i < end; ++i)
+			{
+				uint8_t byte = static_cast<uint8_t>(text[i]);
+
+				if ((byte & 0xC0) == 0x80)
+					continue;
+
+				_widget.layout.push_back(PlacedGlyph{ byte < 0x80 ? byte : REPLACEMENT_CHARACTER, penX, penY });
+				penX += advance;
+			}
+
+			if (penX > widest)
+				widest = penX;
+		}
+
+		_widget.width = widest;
+		_widget.height = length > 0 ? penY + lineHeight : 0.0f;
+		_widget.layoutDirty = false;
+	}
+
+	void UiLayer::BuildQuads(Widget& _widget)
+	{
+		_widget.quads.clear();
+		_widget.glyphs.clear();
+		bool missing = false;
+
+		if (!_widget.text)
+		{
+			AtlasGlyph solid = m_Atlas.GetSolid();
+			_widget.quads.push_back(UiQuad{ 0.0f, 0.0f, _widget.width, _widget.height, solid.u0, solid.v0, solid.u1, solid.v1, _widget.color });
+			_widget.glyphs.push_back(solid);
+		}
+		else
+		{
+			const float size = static_cast<float>(_widget.pixelSize);
+
+			for (const PlacedGlyph& placed : _widget.layout)
+			{
+				AtlasGlyph glyph;
+				if (!m_Atlas.Find(placed.codepoint, _widget.pixelSize, glyph))
+				{
+					++m_MissingGlyphs;
+					missing = true;
+					continue;
+				}
+
+				_widget.quads.push_back(UiQuad{ placed.x, placed.y, size, size, glyph.u0, glyph.v0, glyph.u1, glyph.v1, _widget.color });
+				_widget.glyphs.push_back(glyph);
+			}
+		}
+
+		// A widget missing glyphs tries again next frame, once older glyphs can be evicted.
+		_widget.quadsDirty = missing;
+		++m_Rebuilds;
+	}
+
+	// public
+
+	UiLayer::UiLayer(uint32_t _atlasSize) :
+		m_Atlas(_atlasSize, _atlasSize),
+		m_Widgets(),
+		m_FreeWidgets(),
+		m_Rebuilds(0),
+		m_MissingGlyphs(0)
+	{
+	}
+
+	WidgetId UiLayer::AddPanel(float _x, float _y, float _width, float _height, uint32_t _color)
+	{
+		WidgetId id = Allocate();
+		Widget& widget = m_Widgets[id];
+		widget.x = _x;
+		widget.y = _y;
+		widget.width = _width;
+		widget.height = _height;
+		widget.color = _color;
+		return id;
+	}
+
+	WidgetId UiLayer::AddLabel(float _x, float _y, const std::string& _text, uint32_t _pixelSize, uint32_t _color, float _wrapWidth)
+	{
+		assert(_pixelSize > 0); // Error: Text must be at least one pixel tall.
+
+		WidgetId id = Allocate();
+		Widget& widget = m_Widgets[id];
+		widget.text = true;
+		widget.layoutDirty = true;
+		widget.x = _x;
+		widget.y = _y;
+		widget.wrapWidth = _wrapWidth;
+		widget.pixelSize = _pixelSize;
+		widget.color = _color;
+		widget.string = _text;
+		return id;
+	}
+
+	void UiLayer::Remove(WidgetId _widget)
+	{
+		assert(_widget < m_Widgets.size() && m_Widgets[_widget].alive); // Error: Invalid widget.
+
+		m_Widgets[_widget].alive = false;
+		m_FreeWidgets.push_back(_widget);
+	}
+
+	void UiLayer::SetText(WidgetId _widget, const std::string& _text)
+	{
+		assert(_widget < m_Widgets.size() && m_Widgets[_widget].alive && m_Widgets[_widget].text); // Error: Invalid label.
+
+		Widget& widget = m_Widgets[_widget];
+		if (widget.string == _text)
+			return;
+
+		widget.string = _text;
+		widget.layoutDirty = true;
+		widget.quadsDirty = true;
+	}
+
+	void UiLayer::SetPosition(WidgetId _widget, float _x, float _y)
+	{
+		assert(_widget < m_Widgets.size() && m_Widgets[_widget].alive); // Error: Invalid widget.
+
+		m_Widgets[_widget].x = _x;
+		m_Widgets[_widget].y = _y;
+	}
+
+	void UiLayer::SetSize(WidgetId _widget, float _width, float _height)
+	{
+		assert(_widget < m_Widgets.size() && m_Widgets[_widget].alive && !m_Widgets[_widget].text); // Error: Invalid panel.
+
+		Widget& widget = m_Widgets[_widget];
+		if (widget.width == _width && widget.height == _height)
+			return;
+
+		widget.width = _width;
+		widget.height = _height;
+		widget.quadsDirty = true;
+	}
+
+	void UiLayer::SetColor(WidgetId _widget, uint32_t _color)
+	{
+		assert(_widget < m_Widgets.size() && m_Widgets[_widget].alive); // Error: Invalid widget.
+
+		Widget& widget = m_Widgets[_widget];
+		if (widget.color == _color)
+			return;
+
+		widget.color = _color;
+		widget.quadsDirty = true;
+	}
+
+	void UiLayer::SetVisible(WidgetId _widget, bool _visible)
+	{
+		assert(_widget < m_Widgets.size() && m_Widgets[_widget].alive); // Error: Invalid widget.
+
+		m_Widgets[_widget].visible = _visible;
+	}
+
+	void UiLayer::GetSize(WidgetId _widget, float& _outWidth, float& _outHeight)
+	{
+		assert(_widget < m_Widgets.size() && m_Widgets[_widget].alive); // Error: Invalid widget.
+
+		Widget& widget = m_Widgets[_widget];
+		if (widget.layoutDirty)
+			Layout(widget);
+
+		_outWidth = widget.width;
+		_outHeight = widget.height;
+	}
+
+	void UiLayer::Build(std::vector<UiQuad>& _outQuads)
+	{
+		m_Atlas.BeginFrame();
+
+		// Mark the glyphs of unchanged widgets used before anything is rebuilt, so rebuilding can only
+		// evict glyphs nothing on screen needs. A widget whose glyph was evicted while it was hidden
+		// is rebuilt with the rest.
+		for (Widget& widget : m_Widgets)
+		{
+			if (!widget.alive || !widget.visible || widget.quadsDirty)
+				continue;
+
+			for (const AtlasGlyph& glyph : widget.glyphs)
+			{
+				if (!m_Atlas.Touch(glyph))
+				{
+					widget.quadsDirty = true;
+					break;
+				}
+			}
+		}
+
+		size_t total = 0;
+
+		for (Widget& widget : m_Widgets)
+		{
+			if (!widget.alive || !widget.visible)
+				continue;
+
+			if (widget.layoutDirty)
+				Layout(widget);
+
+			if (widget.quadsDirty)
+				BuildQuads(widget);
+
+			total += widget.quads.size();
+		}
+
+		// One batch, in drawing order.
+		_outQuads.resize(total);
+		UiQuad* out = _outQuads.data();
+
+		for (const Widget& widget : m_Widgets)
+		{
+			if (!widget.alive || !widget.visible)
+				continue;
+
+			for (const UiQuad& quad : widget.quads)
+			{
+				*out = quad;
+				out->x += widget.x;
+				out->y += widget.y;
+				++out;
+			}
+		}
+	}
+
+	UiAtlasImage UiLayer::TakeAtlasImage()
+	{
+		return m_Atlas.TakeImage();
+	}
+
+	const GlyphAtlas& UiLayer::GetAtlas() const
+	{
+		return m_Atlas;
+	}
+
+	uint64_t UiLayer::GetRebuildCount() const
+	{
+		return m_Rebuilds;
+	}
+
+	uint64_t UiLayer::GetMissingGlyphCount() const
+	{
+		return m_MissingGlyphs;
+	}
+}
@@ -0,0 +1,176 @@
+/*
+-------------------------------------------------------------------------------------------------------
+	File: UiLayer.h
+	Author: Ozzie Mercado
+	Created: October 18, 2026
+	Modified: October 18, 2026
+	Description: Retained on-screen panels and text, for HUDs, unit cards and tooltips. Every widget keeps
+		its laid-out text and its quads between frames and only rebuilds them when it changes, so a
+		frame where nothing changed costs one copy of the quads. Quads are stored relative to their
+		widget, so moving a widget never rebuilds it. Everything is drawn as one batch of UiQuads
+		sampling a shared GlyphAtlas.
+-------------------------------------------------------------------------------------------------------
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "GlyphAtlas.h"
+
+namespace OC
+{
+	typedef uint32_t WidgetId; // Identifies a widget. Reused once the widget is removed.
+
+	constexpr WidgetId INVALID_WIDGET = 0xFFFFFFFF; // Never a valid widget. Use it to mean "no widget".
+
+	class UiLayer
+	{
+	private:
+		// A character placed by layout, relative to its widget.
+		struct PlacedGlyph
+		{
+			uint32_t codepoint; // The character.
+			float x, y; // The top-left of the glyph.
+		};
+
+		struct Widget
+		{
+			bool alive; // If the widget is in use.
+			bool visible; // If the widget is drawn.
+			bool text; // If the widget is a label, otherwise a panel.
+			bool layoutDirty; // If the text must be laid out again.
+			bool quadsDirty; // If the quads must be built again.
+			float x, y; // The top-left corner, in pixels.
+			float width, height; // The size of a panel, or the measured size of a label's text.
+			float wrapWidth; // The width a label wraps at. 0 never wraps.
+			uint32_t pixelSize; // The size of a label's font.
+			uint32_t color; // RGBA, 8 bits each, red in the lowest byte.
+			std::string string; // A label's text.
+			std::vector<PlacedGlyph> layout; // A label's laid-out characters. Spaces are skipped.
+			std::vector<UiQuad> quads; // The widget's quads, relative to its corner.
+			std::vector<AtlasGlyph> glyphs; // The atlas glyph of every quad, to keep them cached.
+		};
+
+		GlyphAtlas m_Atlas; // Every glyph drawn.
+		std::vector<Widget> m_Widgets; // Every widget, live or not, in drawing order.
+		std::vector<WidgetId> m_FreeWidgets; // Removed widgets ready for reuse.
+		uint64_t m_Rebuilds; // Widgets whose quads were built again.
+		uint64_t m_MissingGlyphs; // Characters skipped because the atlas was full.
+
+		// Description: Claims a widget slot and resets it.
+		// Returns: The widget.
+		WidgetId Allocate();
+
+		// Description: Lays out a label's text, wrapping at spaces.
+		// Parameters: 
+		//    Widget& _widget, the label.
+		void Layout(Widget& _widget);
+
+		// Description: Builds a widget's quads, looking its glyphs up in the atlas.
+		// Parameters: 
+		//    Widget& _widget, the widget.
+		void BuildQuads(Widget& _widget);
+
+	public:
+		// Description: Constructs an empty UI layer.
+		// Parameters: 
+		//    uint32_t _atlasSize, the width and height of the glyph atlas, in pixels.
+		explicit UiLayer(uint32_t _atlasSize = 1024);
+
+		// Description: UiLayer's cannot be created from other UiLayer's.
+		UiLayer(const UiLayer& _layer) = delete;
+
+		// Description: UiLayer's cannot be assigned to other UiLayer's.
+		void operator=(const UiLayer& _layer) = delete;
+
+		// Description: Adds a solid rectangle.
+		// Parameters: 
+		//    float _x, the left edge, in pixels.
+		//    float _y, the top edge, in pixels.
+		//    float _width, the width, in pixels.
+		//    float _height, the height, in pixels.
+		//    uint32_t _color, the color. See PackColor.
+		// Returns: The panel.
+		WidgetId AddPanel(float _x, float _y, float _width, float _height, uint32_t _color);
+
+		// Description: Adds a line or block of text.
+		// Parameters: 
+		//    float _x, the left edge, in pixels.
+		//    float _y, the top edge, in pixels.
+		//    const std::string& _text, the text. '\n' starts a new line.
+		//    uint32_t _pixelSize, the size of the font, in pixels.
+		//    uint32_t _color, the color. See PackColor.
+		//    float _wrapWidth, the width to wrap at, in pixels. 0 never wraps.
+		// Returns: The label.
+		WidgetId AddLabel(float _x, float _y, const std::string& _text, uint32_t _pixelSize, uint32_t _color, float _wrapWidth = 0.0f);
+
+		// Description: Removes a widget.
+		// Parameters: 
+		//    WidgetId _widget, the widget.
+		void Remove(WidgetId _widget);
+
+		// Description: Changes a label's text. Setting the same text again costs nothing.
+		// Parameters: 
+		//    WidgetId _widget, the label.
+		//    const std::string& _text, the new text.
+		void SetText(WidgetId _widget, const std::string& _text);
+
+		// Description: Moves a widget. Never rebuilds it.
+		// Parameters: 
+		//    WidgetId _widget, the widget.
+		//    float _x, the left edge, in pixels.
+		//    float _y, the top edge, in pixels.
+		void SetPosition(WidgetId _widget, float _x, float _y);
+
+		// Description: Resizes a panel.
+		// Parameters: 
+		//    WidgetId _widget, the panel.
+		//    float _width, the width, in pixels.
+		//    float _height, the height, in pixels.
+		void SetSize(WidgetId _widget, float _width, float _height);
+
+		// Description: Changes a widget's color.
+		// Parameters: 
+		//    WidgetId _widget, the widget.
+		//    uint32_t _color, the color. See PackColor.
+		void SetColor(WidgetId _widget, uint32_t _color);
+
+		// Description: Shows or hides a widget. Hidden widgets keep their quads.
+		// Parameters: 
+		//    WidgetId _widget, the widget.
+		//    bool _visible, if the widget is drawn.
+		void SetVisible(WidgetId _widget, bool _visible);
+
+		// Description: Returns the size of a widget. Labels are laid out first if they changed.
+		// Parameters: 
+		//    WidgetId _widget, the widget.
+		//    float& _outWidth, receives the width, in pixels.
+		//    float& _outHeight, receives the height, in pixels.
+		void GetSize(WidgetId _widget, float& _outWidth, float& _outHeight);
+
+		// Description: Rebuilds the widgets that changed and writes the quads of every visible widget,
+		//    in the order they were added.
+		// Parameters: 
+		//    std::vector<UiQuad>& _outQuads, replaced with the quads, in screen pixels.
+		void Build(std::vector<UiQuad>& _outQuads);
+
+		// Description: Returns the atlas the quads sample, with the region that changed since the last
+		//    call. Call after Build.
+		// Returns: The atlas image.
+		UiAtlasImage TakeAtlasImage();
+
+		// Description: Returns the glyph atlas.
+		// Returns: The atlas.
+		const GlyphAtlas& GetAtlas() const;
+
+		// Description: Returns the number of times a widget's quads were built.
+		// Returns: The number of rebuilds.
+		uint64_t GetRebuildCount() const;
+
+		// Description: Returns the number of characters skipped because the atlas was full.
+		// Returns: The number of characters.
+		uint64_t GetMissingGlyphCount() const;
+	};
+}
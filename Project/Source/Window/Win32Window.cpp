@@ -3,7 +3,7 @@
 	File: Win32Window.cpp	
 	Author: Ozzie Mercado
 	Created: December 6, 2020
-	Modified: December 7, 2020
+	Modified: October 18, 2026
 	Note: See header for more documentation.
 -------------------------------------------------------------------------------------------------------
 */
@@ -45,7 +45,9 @@ namespace OC
 		WindowInterface(_name, _x, _y, _width, _height),
 		m_WindowHandle(nullptr),
 		m_DeviceContextHandle(nullptr),
-		m_InstanceHandle(nullptr)
+		m_InstanceHandle(nullptr),
+		m_MessagesHandled(nullptr),
+		m_MessagesPerUpdate(nullptr)
 	{
 		Open();
 	}
@@ -136,10 +138,13 @@ namespace OC
 		MSG message;
 		ZeroMemory(&message, sizeof(message));
 
+		uint64_t messageCount = 0;
+
 		while (PeekMessage(&message, 0, 0, 0, PM_REMOVE))
 		{
 			TranslateMessage(&message);
 			DispatchMessageW(&message);
+			++messageCount;
 
 			if (message.message == WM_QUIT)
 			{
@@ -148,6 +153,11 @@ namespace OC
 			}
 		}
 
+		if (m_MessagesHandled)
+		{
+			m_MessagesHandled->Add(messageCount);
+			m_MessagesPerUpdate->Record(messageCount);
+		}
 
 		return true;
 	}
@@ -158,4 +168,10 @@ namespace OC
 
 		return reinterpret_cast<void*>(m_WindowHandle);
 	}
+
+	void Window::RegisterMetrics(MetricsRegistry& _registry)
+	{
+		m_MessagesHandled = &_registry.GetCounter("window_messages_total", "Window messages dispatched.");
+		m_MessagesPerUpdate = &_registry.GetHistogram("window_messages_per_update", "Window messages dispatched by one update.");
+	}
 }
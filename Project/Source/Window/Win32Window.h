@@ -3,7 +3,7 @@
 	File: Win32Window.h
 	Author: Ozzie Mercado
 	Created: December 6, 2020
-	Modified: December 7, 2020
+	Modified: October 18, 2026
 	Description: The Win32 implementation of the window interface. Opens, closes, and updates a window.
 -------------------------------------------------------------------------------------------------------
 */
@@ -14,6 +14,7 @@
 
 #include <windows.h>
 #include "WindowInterface.h"
+#include "../Metrics/Metrics.h"
 
 namespace OC
 {
@@ -23,6 +24,8 @@ namespace OC
 		HWND m_WindowHandle; // Handle to the window.
 		HDC m_DeviceContextHandle; // Handle to the window's device context.
 		HINSTANCE m_InstanceHandle; // Handle to the window's instance.
+		Counter* m_MessagesHandled; // Counts dispatched messages. nullptr until metrics are registered.
+		Histogram* m_MessagesPerUpdate; // The number of messages dispatched by each update.
 
 		// Description: Handles window messages.
 		// Parameters: 
@@ -65,6 +68,11 @@ namespace OC
 		// Description: Returns a handle to the window.
 		// Returns: Pointer to the window handle.
 		void* GetHandle() const;
+
+		// Description: Registers the window's metrics and starts updating them.
+		// Parameters: 
+		//    MetricsRegistry& _registry, the registry to add the metrics to. Must outlive the window.
+		void RegisterMetrics(MetricsRegistry& _registry);
 	};
 }
 
@@ -3,7 +3,7 @@
 	File: WindowInterface.h
 	Author: Ozzie Mercado
 	Created: December 6, 2020
-	Modified: December 7, 2020
+	Modified: October 18, 2026
 	Description: The interface that all window implementations share. Interface for opening, closing, 
 	             and updating a window.
 -------------------------------------------------------------------------------------------------------
@@ -13,6 +13,8 @@
 
 namespace OC
 {
+	class MetricsRegistry;
+
 	class WindowInterface
 	{
 	protected:
@@ -60,5 +62,10 @@ namespace OC
 		// Description: Returns a handle to the window.
 		// Returns: Pointer to the window handle.
 		virtual void* GetHandle() const = 0;
+
+		// Description: Registers the window's metrics and starts updating them.
+		// Parameters: 
+		//    MetricsRegistry& _registry, the registry to add the metrics to. Must outlive the window.
+		virtual void RegisterMetrics(MetricsRegistry& _registry) = 0;
 	};
 }
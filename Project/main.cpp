@@ -3,24 +3,130 @@
 	File: main.cpp
 	Author: Ozzie Mercado
 	Created: December 5, 2020
-	Modified: December 7, 2020
+	Modified: October 18, 2026
 	Description: Entry point for the application.
 -------------------------------------------------------------------------------------------------------
 */
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <math.h>
+#include <stdio.h>
 #include "Source/Window/Window.h"
 #include "Source/Input/Input.h"
+#include "Source/Logging/Log.h"
 #include "Source/Renderer/Renderer.h"
+#include "Source/Camera/Camera.h"
+#include "Source/Culling/LooseQuadtree.h"
+#include "Source/Metrics/MetricsExporter.h"
+#include "Source/Orders/OrderSystem.h"
+#include "Source/Particles/ParticleSystem.h"
+#include "Source/Performance/FrameGovernor.h"
+#include "Source/Simulation/OccupancyMap.h"
+#include "Source/Simulation/World.h"
+#include "Source/Terrain/TerrainStreamer.h"
+#include "Source/Threading/JobSystem.h"
+#include "Source/UI/UiLayer.h"
 
 int main(int _argc, char** _argv)
 {
+	// Console output is written by a background thread, so logging never stalls a frame.
+	OC::LogSettings logSettings;
+	logSettings.path = "OpenConquer.log";
+	OC::Log::Start(logSettings);
+
+	OC::MetricsRegistry metrics; // Outlives everything that records into it.
 	OC::Window win(L"Open Conquer", 400, 200, 960, 600);
 	OC::Input input(win);
 	OC::Renderer renderer(win);
+	OC::Camera camera(960, 600);
+	OC::ParticleSystem particles(100000);
+	std::vector<OC::ParticleVertex> particleVertices;
+
+	OC::ParticleEffect explosion;
+	explosion.startColor = OC::PackColor(255, 200, 80, 255);
+	explosion.endColor = OC::PackColor(120, 40, 20, 0);
+	OC::EffectId explosionEffect = particles.AddEffect(explosion);
+
+	// Two armies to order around. The player commands team 0.
+	OC::World world(1);
+	OC::OrderSystem orders(0);
+	std::vector<OC::Command> commands;
+	std::vector<OC::ParticleVertex> unitVertices;
+	float tickTime = 0.0f;
+	float dragX = 0.0f, dragY = 0.0f;
+
+	// B toggles placing buildings. The footprint under the cursor is checked every frame for the preview.
+	constexpr uint32_t BUILDING_SIZE = 3; // The footprint of a building, in tiles.
+	OC::OccupancyMap occupancy;
+	const OC::OccupancySettings& tiles = occupancy.GetSettings();
+	std::vector<int32_t> buildings; // The top-left tile of every building, as x and y pairs.
+	bool placing = false;
+	bool capturing = false; // If F12 is capturing frames.
+
+	// Units and buildings are kept in a quadtree over the map, so only the ones the camera sees are drawn.
+	// Buildings are told apart from units by the top bit of their user data.
+	constexpr float UNIT_SIZE = 6.0f; // The width and height units are drawn at, in world units.
+	constexpr uint32_t BUILDING_BIT = 0x80000000U;
+	OC::LooseQuadtree visibility({ tiles.originX, tiles.originY, tiles.originX + tiles.width * tiles.tileSize, tiles.originY + tiles.height * tiles.tileSize });
+	std::vector<OC::CullHandle> unitHandles; // Each unit's object in the quadtree, or INVALID_CULL_HANDLE once dead.
+	std::vector<uint32_t> visibleObjects;
+
+	// The open world is generated around the camera on worker threads and cached next to the game.
+	OC::JobSystem jobs;
+	OC::StreamerSettings terrainSettings;
+	terrainSettings.cachePath = "TerrainCache";
+	terrainSettings.tileSize = tiles.tileSize;
+	OC::TerrainStreamer terrain(OC::TerrainSettings(), terrainSettings, &jobs);
+	std::vector<OC::ParticleVertex> terrainVertices;
+
+	for (uint8_t team = 0; team < 2; ++team)
+	{
+		OC::Command spawn = {};
+		spawn.type = OC::CommandType::SPAWN;
+		spawn.team = team;
+		spawn.count = 300;
+		spawn.x = team == 0 ? 200.0f : 1400.0f;
+		spawn.y = 300.0f;
+		spawn.radius = 150.0f;
+		world.Queue(spawn);
+	}
+
+	// A HUD in the top-left corner in place of printing to the console.
+	OC::UiLayer ui;
+	std::vector<OC::UiQuad> uiQuads;
+	char hudText[128];
+	ui.AddPanel(4.0f, 4.0f, 260.0f, 44.0f, OC::PackColor(0, 0, 0, 160));
+	OC::WidgetId cursorLabel = ui.AddLabel(10.0f, 10.0f, "", 12, OC::PackColor(255, 255, 255, 255));
+	OC::WidgetId particleLabel = ui.AddLabel(10.0f, 28.0f, "", 12, OC::PackColor(255, 220, 120, 255));
+
+	// Sheds optional work, like particles, when frames run over budget, and restores it when they don't.
+	OC::FrameGovernor governor;
+
+	// Frame statistics are rewritten to a file next to the game every second.
+	win.RegisterMetrics(metrics);
+	input.RegisterMetrics(metrics);
+	renderer.RegisterMetrics(metrics);
+	governor.RegisterMetrics(metrics);
+
+	OC::MetricsExportSettings metricsSettings;
+	metricsSettings.path = "OpenConquer.metrics";
+	OC::MetricsExporter metricsExporter(metrics, metricsSettings);
+
+	// The governor scales the AI's settings, so it's given these rather than the ones it last set.
+	const OC::AISettings aiSettings = world.GetAI().GetSettings();
+	auto lastFrameStart = std::chrono::steady_clock::now();
 	
 	while (true)
 	{
+		auto frameStart = std::chrono::steady_clock::now();
+
+		// Time passes by the real time since the last frame. Stalls, like dragging the window, are capped
+		// so the world doesn't race to catch up afterwards.
+		const float frameSeconds = fminf(std::chrono::duration<float>(frameStart - lastFrameStart).count(), 0.25f);
+		lastFrameStart = frameStart;
+
 		// Input
 		input.Update(); // Input must be updated before window for JustPressed and JustReleased to work properly.
 		if (!win.Update())
@@ -28,34 +134,282 @@ int main(int _argc, char** _argv)
 
 		// Logic
 		if (input.JustPressed(OC::Key::A))
-			std::cout << "Just Pressed: A\n";
+			OC_LOG(INFO, INPUT, "Just Pressed: %c", 'A');
 		else if (input.JustReleased(OC::Key::A))
-			std::cout << "Just Released: A\n";
+			OC_LOG(INFO, INPUT, "Just Released: %c", 'A');
 
 		if (input.JustPressed(OC::Key::S))
-			std::cout << "Just Pressed: S\n";
+			OC_LOG(INFO, INPUT, "Just Pressed: %c", 'S');
 		else if (input.JustReleased(OC::Key::S))
-			std::cout << "Just Released: S\n";
+			OC_LOG(INFO, INPUT, "Just Released: %c", 'S');
 		else if (input.Pressed(OC::Key::S))
-			std::cout << "Pressed: S\n";
+			OC_LOG(TRACE, INPUT, "Pressed: %c", 'S'); // Every frame, so only in builds with TRACE compiled in.
 		//else if (input.Released(OC::Key::S))
-		//	std::cout << "Released: S\n"; // Commented out so it doesn't spam the console.
+		//	OC_LOG(TRACE, INPUT, "Released: %c", 'S'); // Commented out so it doesn't spam the log.
 
 		static int x, y, difX, difY, wheelDelta;
 		input.GetCursorPosition(x, y);
 		input.GetCursorDelta(difX, difY);
 		input.GetWheelDelta(wheelDelta);
 
-		if (difX != 0 || difY != 0)
-			printf("Mouse: x=%d y=%d dX=%d dY=%d\n", x, y, difX, difY);
+		// Camera: drag the world with the middle mouse button, zoom toward the cursor with the wheel.
+		if (input.Pressed(OC::Key::MOUSE_MIDDLE))
+			camera.Pan(difX, difY);
+
+		camera.Zoom(wheelDelta, x, y);
+
+		float cursorX, cursorY;
+		camera.ScreenToWorld(x, y, cursorX, cursorY);
+
+		int32_t buildX, buildY;
+		occupancy.WorldToTile(cursorX, cursorY, buildX, buildY);
+		buildX -= static_cast<int32_t>(BUILDING_SIZE / 2);
+		buildY -= static_cast<int32_t>(BUILDING_SIZE / 2);
+		bool canBuild = occupancy.CanPlace(buildX, buildY, BUILDING_SIZE, BUILDING_SIZE);
+
+		if (input.JustPressed(OC::Key::B))
+			placing = !placing;
+
+		// Buildings: left click places one where it fits, right click stops placing.
+		if (placing)
+		{
+			if (input.JustPressed(OC::Key::MOUSE_LEFT) && canBuild)
+			{
+				occupancy.Fill(OC::OccupancyLayer::BUILDINGS, buildX, buildY, BUILDING_SIZE, BUILDING_SIZE, true);
+				visibility.Insert({
+					tiles.originX + buildX * tiles.tileSize, tiles.originY + buildY * tiles.tileSize,
+					tiles.originX + (buildX + BUILDING_SIZE) * tiles.tileSize, tiles.originY + (buildY + BUILDING_SIZE) * tiles.tileSize
+				}, BUILDING_BIT | static_cast<uint32_t>(buildings.size() / 2));
+				buildings.push_back(buildX);
+				buildings.push_back(buildY);
+			}
+			else if (input.JustPressed(OC::Key::MOUSE_RIGHT))
+				placing = false;
+		}
+		// Orders: drag with the left button to select (hold shift to add), right click to move the selection.
+		else if (input.JustPressed(OC::Key::MOUSE_LEFT))
+		{
+			dragX = cursorX;
+			dragY = cursorY;
+		}
+		else if (input.JustReleased(OC::Key::MOUSE_LEFT))
+		{
+			OC::Rect area = { fminf(dragX, cursorX), fminf(dragY, cursorY), fmaxf(dragX, cursorX), fmaxf(dragY, cursorY) };
+			orders.Select(world.GetUnits(), area, input.Pressed(OC::Key::SHIFT));
+		}
+
+		if (!placing && input.JustPressed(OC::Key::MOUSE_RIGHT))
+		{
+			commands.clear();
+			if (orders.Move(world.GetUnits(), cursorX, cursorY, world.GetTick(), commands))
+				world.Queue(commands);
+		}
+
+		// The world ticks at its own fixed rate, however fast frames are.
+		tickTime += frameSeconds;
+		bool ticked = false;
+		for (; tickTime >= OC::TICK_SECONDS && !world.HasEnded(); tickTime -= OC::TICK_SECONDS, ticked = true)
+			world.Tick();
+
+		occupancy.UpdateUnits(world.GetUnits());
+
+		// Units only spawn, move and die when the world ticks, so the quadtree is only updated then. New
+		// units are added and dead ones removed.
+		const OC::UnitData& units = world.GetUnits();
+		unitHandles.resize(units.Count(), OC::INVALID_CULL_HANDLE);
+
+		for (OC::UnitId unit = 0; ticked && unit < units.Count(); ++unit)
+		{
+			OC::CullHandle& handle = unitHandles[unit];
 
-		if (wheelDelta != 0)
-			printf("Wheel: %d\n", wheelDelta);
+			if (!units.IsAlive(unit))
+			{
+				if (handle != OC::INVALID_CULL_HANDLE)
+				{
+					visibility.Remove(handle);
+					handle = OC::INVALID_CULL_HANDLE;
+				}
+
+				continue;
+			}
+
+			const OC::Rect bounds = {
+				units.positionX[unit] - UNIT_SIZE * 0.5f, units.positionY[unit] - UNIT_SIZE * 0.5f,
+				units.positionX[unit] + UNIT_SIZE * 0.5f, units.positionY[unit] + UNIT_SIZE * 0.5f
+			};
+
+			if (handle == OC::INVALID_CULL_HANDLE)
+				handle = visibility.Insert(bounds, unit);
+			else
+				visibility.Update(handle, bounds);
+		}
+
+		// Terrain: chunks coming into reach are made in the background. Once ready, their water, rock,
+		// snow and resources are marked on the occupancy map. The terrain's tile 0 is at the world origin.
+		float centerX, centerY;
+		camera.ScreenToWorld(480, 300, centerX, centerY);
+		terrain.Update(centerX, centerY);
+
+		for (const OC::TerrainChunk* chunk : terrain.GetReadyChunks())
+		{
+			const int32_t firstX = chunk->x * static_cast<int32_t>(OC::CHUNK_SIZE) - static_cast<int32_t>(floorf(tiles.originX / tiles.tileSize));
+			const int32_t firstY = chunk->y * static_cast<int32_t>(OC::CHUNK_SIZE) - static_cast<int32_t>(floorf(tiles.originY / tiles.tileSize));
+
+			for (uint32_t tile = 0; tile < OC::CHUNK_SIZE * OC::CHUNK_SIZE; ++tile)
+			{
+				const int32_t tileX = firstX + static_cast<int32_t>(tile % OC::CHUNK_SIZE), tileY = firstY + static_cast<int32_t>(tile / OC::CHUNK_SIZE);
+				const OC::Biome biome = chunk->biome[tile];
+				occupancy.Fill(OC::OccupancyLayer::TERRAIN, tileX, tileY, 1, 1, biome == OC::Biome::WATER || biome == OC::Biome::ROCK || biome == OC::Biome::SNOW);
+				occupancy.Fill(OC::OccupancyLayer::RESOURCES, tileX, tileY, 1, 1, chunk->resources[tile] != 0);
+			}
+		}
+
+		// Particles: E sets off an explosion under the cursor.
+		if (input.JustPressed(OC::Key::E))
+			particles.Burst(explosionEffect, cursorX, cursorY, 500);
+
+		// Capture: F12 starts and stops writing the frames to "Captures". Frames are dropped rather than
+		// stalling the game when the encoder falls behind.
+		if (input.JustPressed(OC::Key::F12))
+		{
+			if (capturing)
+			{
+				renderer.StopCapture();
+				capturing = false;
+				OC::CaptureStats captureStats = renderer.GetCaptureStats();
+				OC_LOG(INFO, RENDERER, "Capture stopped: %llu frames written, %llu dropped",
+					static_cast<unsigned long long>(captureStats.written), static_cast<unsigned long long>(captureStats.dropped));
+			}
+			else
+			{
+				OC::CaptureSettings captureSettings;
+				captureSettings.folder = "Captures";
+				captureSettings.dropWhenBehind = true;
+
+				capturing = renderer.StartCapture(captureSettings);
+
+				if (capturing)
+					OC_LOG(INFO, RENDERER, "Capturing frames to %s", captureSettings.folder.c_str());
+				else
+					OC_LOG(FAILURE, RENDERER, "Could not capture frames to %s", captureSettings.folder.c_str());
+			}
+		}
+
+		particles.Update(frameSeconds);
+		particles.BuildVertices(camera, particleVertices);
+
+		// The visible terrain is drawn tile by tile under everything else. Zoomed out, tiles are skipped
+		// so none is drawn smaller than a few pixels.
+		static const uint32_t BIOME_COLORS[static_cast<uint32_t>(OC::Biome::_COUNT)] = {
+			OC::PackColor(40, 80, 160, 255), OC::PackColor(210, 200, 140, 255), OC::PackColor(90, 150, 70, 255),
+			OC::PackColor(40, 100, 50, 255), OC::PackColor(120, 115, 110, 255), OC::PackColor(240, 240, 245, 255)
+		};
+		const OC::Rect visible = camera.GetVisibleBounds();
+		int32_t minTileX, minTileY, maxTileX, maxTileY;
+		terrain.WorldToTile(visible.minX, visible.minY, minTileX, minTileY);
+		terrain.WorldToTile(visible.maxX, visible.maxY, maxTileX, maxTileY);
+		int32_t tileStep = 1;
+		while (tileStep < 64 && tileStep * tiles.tileSize * camera.GetZoom() < 4.0f)
+			tileStep *= 2;
+
+		terrainVertices.clear();
+		for (int32_t tileY = minTileY - (minTileY % tileStep + tileStep) % tileStep; tileY <= maxTileY; tileY += tileStep)
+		{
+			for (int32_t tileX = minTileX - (minTileX % tileStep + tileStep) % tileStep; tileX <= maxTileX; tileX += tileStep)
+			{
+				const int32_t chunkX = tileX >= 0 ? tileX / static_cast<int32_t>(OC::CHUNK_SIZE) : (tileX + 1) / static_cast<int32_t>(OC::CHUNK_SIZE) - 1;
+				const int32_t chunkY = tileY >= 0 ? tileY / static_cast<int32_t>(OC::CHUNK_SIZE) : (tileY + 1) / static_cast<int32_t>(OC::CHUNK_SIZE) - 1;
+				const OC::TerrainChunk* chunk = terrain.GetChunk(chunkX, chunkY);
+				if (!chunk)
+					continue;
+
+				const uint32_t tile = static_cast<uint32_t>(tileY - chunkY * static_cast<int32_t>(OC::CHUNK_SIZE)) * OC::CHUNK_SIZE + static_cast<uint32_t>(tileX - chunkX * static_cast<int32_t>(OC::CHUNK_SIZE));
+				OC::ParticleVertex vertex;
+				camera.WorldToScreen((tileX + tileStep * 0.5f) * tiles.tileSize, (tileY + tileStep * 0.5f) * tiles.tileSize, vertex.x, vertex.y);
+				vertex.size = tileStep * tiles.tileSize * camera.GetZoom();
+				vertex.color = chunk->resources[tile] ? OC::PackColor(230, 190, 40, 255) : BIOME_COLORS[static_cast<uint32_t>(chunk->biome[tile])];
+				terrainVertices.push_back(vertex);
+			}
+		}
+
+		// Units and buildings are drawn as particles until there are sprites, selected units brighter. Only
+		// the visible ones are drawn. Sorted, units come first in id order and buildings after them.
+		const std::vector<OC::UnitId>& selection = orders.GetSelection();
+		unitVertices.clear();
+		visibility.Query(visible, visibleObjects);
+		std::sort(visibleObjects.begin(), visibleObjects.end());
+		const auto firstBuilding = std::lower_bound(visibleObjects.begin(), visibleObjects.end(), BUILDING_BIT);
+
+		auto addSquare = [&](int32_t _x, int32_t _y, uint32_t _size, uint32_t _color)
+		{
+			OC::ParticleVertex vertex;
+			camera.WorldToScreen(tiles.originX + (_x + _size * 0.5f) * tiles.tileSize, tiles.originY + (_y + _size * 0.5f) * tiles.tileSize, vertex.x, vertex.y);
+			vertex.size = _size * tiles.tileSize * camera.GetZoom();
+			vertex.color = _color;
+			unitVertices.push_back(vertex);
+		};
+
+		// Buildings go under units.
+		for (auto object = firstBuilding; object != visibleObjects.end(); ++object)
+		{
+			const size_t building = (*object & ~BUILDING_BIT) * 2;
+			addSquare(buildings[building], buildings[building + 1], BUILDING_SIZE, OC::PackColor(150, 150, 160, 255));
+		}
+
+		size_t selected = 0;
+
+		for (auto object = visibleObjects.begin(); object != firstBuilding; ++object)
+		{
+			const OC::UnitId unit = *object;
+
+			while (selected < selection.size() && selection[selected] < unit)
+				++selected;
+
+			bool isSelected = selected < selection.size() && selection[selected] == unit;
+			OC::ParticleVertex vertex;
+			camera.WorldToScreen(units.positionX[unit], units.positionY[unit], vertex.x, vertex.y);
+			vertex.size = UNIT_SIZE * camera.GetZoom();
+			vertex.color = units.team[unit] != 0 ? OC::PackColor(220, 60, 60, 255) : isSelected ? OC::PackColor(140, 255, 140, 255) : OC::PackColor(60, 160, 60, 255);
+			unitVertices.push_back(vertex);
+		}
+
+		// The footprint being placed is drawn tile by tile over everything else.
+		for (uint32_t tile = 0; placing && tile < BUILDING_SIZE * BUILDING_SIZE; ++tile)
+			addSquare(buildX + static_cast<int32_t>(tile % BUILDING_SIZE), buildY + static_cast<int32_t>(tile / BUILDING_SIZE), 1, canBuild ? OC::PackColor(80, 255, 80, 120) : OC::PackColor(255, 80, 80, 120));
+
+		// HUD: only labels whose text changed are laid out again.
+		snprintf(hudText, sizeof(hudText), "Mouse: %d, %d  Zoom: %.2f  Selected: %u", x, y, camera.GetZoom(), static_cast<unsigned int>(orders.GetSelection().size()));
+		ui.SetText(cursorLabel, hudText);
+		snprintf(hudText, sizeof(hudText), "Particles: %u  Quality: %u", particles.Count(), governor.GetLevel());
+		ui.SetText(particleLabel, hudText);
+		ui.Build(uiQuads);
 
 		// Render
+		renderer.SubmitParticles(terrainVertices.data(), static_cast<uint32_t>(terrainVertices.size()));
+		renderer.SubmitParticles(unitVertices.data(), static_cast<uint32_t>(unitVertices.size()));
+		renderer.SubmitParticles(particleVertices.data(), static_cast<uint32_t>(particleVertices.size()));
+		renderer.SubmitUi(uiQuads.data(), static_cast<uint32_t>(uiQuads.size()), ui.TakeAtlasImage());
+
+		// Present is left out of the frame's cost, since it waits for vertical sync.
+		float frameMilliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+		if (governor.Record(frameMilliseconds))
+		{
+			const OC::QualityLevel& quality = governor.GetQuality();
+			particles.SetSpawnScale(quality.particleScale);
+			particles.SetMinPixelSize(quality.minParticlePixels);
+			renderer.SetResolutionScale(quality.renderScale);
+
+			OC::AISettings scaledAI = aiSettings;
+			scaledAI.thinkInterval *= quality.thinkIntervalScale;
+			scaledAI.maxThinksPerTick = scaledAI.maxThinksPerTick / quality.thinkIntervalScale > 0 ? scaledAI.maxThinksPerTick / quality.thinkIntervalScale : 1;
+			world.GetAI().SetSettings(scaledAI);
+			OC_LOG(INFO, RENDERER, "Quality level %u at %.2f ms per frame", governor.GetLevel(), governor.GetAverageMilliseconds());
+		}
+
 		renderer.Present();
 	}
 
+	OC::Log::Stop();
 	std::cin.ignore();
 
 	return 0;